@@ -13,6 +13,7 @@
 # enable_suggestions = true
 
 # additional_flags   = -DNO_FLEXIBILITY
+# additional_flags  += -DROUNDED_DETERMINISTICS
 
 include Makefile_configuration_compiler.mk
 include Makefile_configuration_variables.mk
@@ -19,6 +19,11 @@ $(dir_binary)/$(dir_test)/$(dir_log):
 	@echo "[Status] created $@";
 	@mkdir -p $(dir_binary)/$(dir_test)/$(dir_log)
 
+# create directory $(dir_binary)/$(dir_benchmark)
+$(dir_binary)/$(dir_benchmark):
+	@echo "[Status] created $@";
+	@mkdir -p $(dir_binary)/$(dir_benchmark)
+
 # create directory $(dir_library)
 $(dir_library):
 	@echo "[Status] created $@";
@@ -34,6 +39,11 @@ $(dir_object)/$(dir_test):
 	@echo "[Status] created $@";
 	@mkdir -p $(dir_object)/$(dir_test)
 
+# create directory $(dir_object)/$(dir_benchmark)
+$(dir_object)/$(dir_benchmark):
+	@echo "[Status] created $@";
+	@mkdir -p $(dir_object)/$(dir_benchmark)
+
 # link the main binary
 $(binary): $(objects)
 	@echo "[Status] linking $@";
@@ -44,6 +54,11 @@ $(dir_binary)/$(dir_test)/%.$(ext_binary): $(dir_object)/$(dir_test)/%.o $(dir_o
 	@echo "[Status] linking $@";
 	@$(COMPILER) -o $@ $< $(objects_without_main) $(flags_linkage)
 
+# link a benchmark binary
+$(dir_binary)/$(dir_benchmark)/%.$(ext_binary): $(dir_object)/$(dir_benchmark)/%.o $(binary)
+	@echo "[Status] linking $@";
+	@$(COMPILER) -o $@ $< $(objects_without_main) $(flags_linkage)
+
 # execute a test binary. this is done via updating the corresponding log
 $(dir_binary)/$(dir_test)/$(dir_log)/% : $(dir_binary)/$(dir_test)/%.$(ext_binary)
 	@echo "[Status] testing $<";
@@ -61,4 +76,5 @@ $(dir_object)/%.$(ext_object): $(dir_source)/%.$(ext_source) Makefile_configurat
 # compiler generated dependencies to automatically rebuild objects if necessary
 -include $(dependencies)
 -include $(dependencies_test)
+-include $(dependencies_benchmark)
 
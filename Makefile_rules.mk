@@ -15,6 +15,13 @@ archive:
 	tar --delete -f $(bin_short)-$${timestamp}.tar $(bin_short)/.gitignore $(bin_short)/revision && \
 	echo "[Status] created archive $(bin_short)-$${timestamp}.tar"
 
+# builds and runs the benchmarks (not part of "all", the timings depend on the machine)
+benchmark: $(dir_object)/$(dir_benchmark) $(dir_binary)/$(dir_benchmark) $(binaries_benchmark)
+	@for benchmark in $(binaries_benchmark); do \
+	   echo "[Status] running $$benchmark"; \
+	   ./$$benchmark || exit 1; \
+	 done
+
 # removes all files and directories this Makefile creates
 clean:
 	@rm -rf $(dir_object)
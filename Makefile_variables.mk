@@ -9,12 +9,13 @@ bin_short = panda
 library_name = polypanda
 
 # directories
-dir_binary  = bin
-dir_library = lib
-dir_object  = obj
-dir_source  = src
-dir_test    = test
-dir_log     = log
+dir_binary    = bin
+dir_library   = lib
+dir_object    = obj
+dir_source    = src
+dir_test      = test
+dir_benchmark = benchmark
+dir_log       = log
 
 # file extensions
 ext_binary     = bin
@@ -26,19 +27,23 @@ ext_header     = h
 # files to compile
 sources = $(wildcard $(dir_source)/*.$(ext_source))
 sources_test = $(wildcard $(dir_source)/$(dir_test)/*.$(ext_source))
+sources_benchmark = $(wildcard $(dir_source)/$(dir_benchmark)/*.$(ext_source))
 
 # object files corresponding to sources
 objects = $(sources:$(dir_source)%$(ext_source)=$(dir_object)%$(ext_object))
 objects_without_main = $(filter-out $(dir_object)/main.$(ext_object), $(objects))
 objects_test = $(sources_test:$(dir_source)%$(ext_source)=$(dir_object)%$(ext_object))
+objects_benchmark = $(sources_benchmark:$(dir_source)%$(ext_source)=$(dir_object)%$(ext_object))
 
 # dependency files corresponding to sources
 dependencies = $(objects:%$(ext_object)=%$(ext_dependency))
 dependencies_test = $(objects_test:%$(ext_object)=%$(ext_dependency))
+dependencies_benchmark = $(objects_benchmark:%$(ext_object)=%$(ext_dependency))
 
 # binary to produce
 binary = $(dir_binary)/$(bin_short)
 binaries_test = $(objects_test:$(dir_object)%.$(ext_object)=$(dir_binary)%.$(ext_binary))
+binaries_benchmark = $(objects_benchmark:$(dir_object)%.$(ext_object)=$(dir_binary)%.$(ext_binary))
 
 # logfiles the test binaries print to
 logs_test = $(binaries_test:$(dir_binary)/$(dir_test)/%.$(ext_binary)=$(dir_binary)/$(dir_test)/$(dir_log)/%)
@@ -56,5 +61,5 @@ deprecated_objects = $(filter-out \
 # all deprecated files
 deprecated_files = $(deprecated_dependencies) $(deprecated_objects)
 
-.PRECIOUS: $(objects) $(objects_test) $(binaries_test)
+.PRECIOUS: $(objects) $(objects_test) $(binaries_test) $(objects_benchmark) $(binaries_benchmark)
 
@@ -0,0 +1,79 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "adaptive_integer.h"
+
+#include <utility>
+
+using namespace panda;
+
+AdaptiveInteger& panda::AdaptiveInteger::promoted(const AdaptiveInteger& second, const Operation operation)
+{
+   auto value = toBigInteger();
+   if ( second.big )
+   {
+      (value.*operation)(*second.big);
+   }
+   else
+   {
+      (value.*operation)(BigInteger(second.small));
+   }
+   assign(std::move(value));
+   return *this;
+}
+
+AdaptiveInteger& panda::AdaptiveInteger::promotedModulo(const AdaptiveInteger& second)
+{
+   const auto divisor = second.toBigInteger();
+   auto value = toBigInteger();
+   auto quotient = value / divisor; // rounds towards zero, hence the remainder has the sign of the dividend.
+   quotient *= divisor;
+   value -= quotient;
+   assign(std::move(value));
+   return *this;
+}
+
+int panda::AdaptiveInteger::comparePromoted(const AdaptiveInteger& a, const AdaptiveInteger& b) noexcept
+{
+   // promoted numbers don't fit into int64_t, hence they are beyond all unpromoted numbers.
+   if ( !b.big )
+   {
+      return (*a.big > 0) ? 1 : -1;
+   }
+   if ( !a.big )
+   {
+      return (*b.big > 0) ? -1 : 1;
+   }
+   return (*a.big < *b.big) ? -1 : ((*b.big < *a.big) ? 1 : 0);
+}
+
+void panda::AdaptiveInteger::assign(BigInteger&& value)
+{
+   int64_t fitting;
+   if ( value.fitsInt64(fitting) )
+   {
+      small = fitting;
+      big.reset();
+   }
+   else
+   {
+      small = 0;
+      if ( big )
+      {
+         *big = std::move(value);
+      }
+      else
+      {
+         big.reset(new BigInteger(std::move(value)));
+      }
+   }
+}
+
+BigInteger panda::AdaptiveInteger::toBigInteger() const
+{
+   return big ? *big : BigInteger(small);
+}
+
@@ -0,0 +1,140 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "big_integer.h"
+
+namespace panda
+{
+   class AdaptiveInteger;
+
+   /// Absolute value.
+   inline AdaptiveInteger abs(const AdaptiveInteger&);
+   /// Hash value (equal numbers have equal hash values).
+   inline std::size_t hash(const AdaptiveInteger&) noexcept;
+
+   /// A 64 bit integer that continues with arbitrary precision instead of overflowing.
+   /// Each value is promoted to a BigInteger on its own when an operation overflows, and it returns
+   /// to 64 bit arithmetic as soon as it fits again. So all values that fit are as cheap as (checked) int64_t.
+   class AdaptiveInteger
+   {
+      public:
+         /// Default constructor (value zero).
+         inline AdaptiveInteger() noexcept;
+         /// Copy constructor.
+         inline AdaptiveInteger(const AdaptiveInteger&);
+         /// Default move constructor.
+         AdaptiveInteger(AdaptiveInteger&&) = default;
+         /// Copy assignment operator.
+         inline AdaptiveInteger& operator=(const AdaptiveInteger&);
+         /// Default move assignment operator.
+         AdaptiveInteger& operator=(AdaptiveInteger&&) = default;
+         #ifdef INT16_MAX
+         /// Constructor from int16_t.
+         explicit inline AdaptiveInteger(const int16_t) noexcept;
+         #endif
+         #ifdef INT32_MAX
+         /// Constructor from int32_t.
+         explicit inline AdaptiveInteger(const int32_t) noexcept;
+         #endif
+         #ifdef INT64_MAX
+         /// Constructor from int64_t.
+         explicit inline AdaptiveInteger(const int64_t);
+         #endif
+         #ifdef UINT16_MAX
+         /// Constructor from uint16_t.
+         explicit inline AdaptiveInteger(const uint16_t) noexcept;
+         #endif
+         #ifdef UINT32_MAX
+         /// Constructor from uint32_t.
+         explicit inline AdaptiveInteger(const uint32_t) noexcept;
+         #endif
+         #ifdef UINT64_MAX
+         /// Constructor from uint64_t.
+         explicit inline AdaptiveInteger(const uint64_t);
+         #endif
+         /// Conversion to int.
+         inline operator int() const;
+         /// Comparison "equals" with integer.
+         inline bool operator==(const int) const noexcept;
+         /// Comparison "not equals" with integer.
+         inline bool operator!=(const int) const noexcept;
+         /// Comparison "less than" with integer.
+         inline bool operator<(const int) const noexcept;
+         /// Comparison "greater than" with integer.
+         inline bool operator>(const int) const noexcept;
+         /// Comparison "less than or equal to" with integer.
+         inline bool operator<=(const int) const noexcept;
+         /// Comparison "greater than or equal to" with integer.
+         inline bool operator>=(const int) const noexcept;
+         /// Comparison "equals" with AdaptiveInteger.
+         inline bool operator==(const AdaptiveInteger&) const noexcept;
+         /// Comparison "not equals" with AdaptiveInteger.
+         inline bool operator!=(const AdaptiveInteger&) const noexcept;
+         /// Comparison "less than" with AdaptiveInteger.
+         inline bool operator<(const AdaptiveInteger&) const noexcept;
+         /// Comparison "greater than" with AdaptiveInteger.
+         inline bool operator>(const AdaptiveInteger&) const noexcept;
+         /// Comparison "less than or equal to" with AdaptiveInteger.
+         inline bool operator<=(const AdaptiveInteger&) const noexcept;
+         /// Comparison "greater than or equal to" with AdaptiveInteger.
+         inline bool operator>=(const AdaptiveInteger&) const noexcept;
+         /// Multiplication (a *= b).
+         inline AdaptiveInteger& operator*=(const AdaptiveInteger&);
+         /// Division (a /= b), rounds towards zero.
+         inline AdaptiveInteger& operator/=(const AdaptiveInteger&);
+         /// Addition (a += b).
+         inline AdaptiveInteger& operator+=(const AdaptiveInteger&);
+         /// Subtraction (a -= b).
+         inline AdaptiveInteger& operator-=(const AdaptiveInteger&);
+         /// Modulo (a %= b), the result has the sign of a (as for built-in integers).
+         inline AdaptiveInteger& operator%=(const AdaptiveInteger&);
+         /// Multiplication (a * b).
+         inline AdaptiveInteger operator*(const AdaptiveInteger&) const;
+         /// Division (a / b).
+         inline AdaptiveInteger operator/(const AdaptiveInteger&) const;
+         /// Addition (a + b).
+         inline AdaptiveInteger operator+(const AdaptiveInteger&) const;
+         /// Subtraction (a - b).
+         inline AdaptiveInteger operator-(const AdaptiveInteger&) const;
+         /// Modulo (a % b).
+         inline AdaptiveInteger operator%(const AdaptiveInteger&) const;
+         /// Negation (-a).
+         inline AdaptiveInteger operator-() const;
+         /// Returns whether the value is currently stored as a BigInteger.
+         inline bool isPromoted() const noexcept;
+         /// Absolute value.
+         friend AdaptiveInteger abs(const AdaptiveInteger&);
+         /// Hash value.
+         friend std::size_t hash(const AdaptiveInteger&) noexcept;
+      private:
+         /// Operation of BigInteger (e.g. &BigInteger::operator+=).
+         using Operation = BigInteger& (BigInteger::*)(const BigInteger&);
+         /// Does an operation with BigIntegers (after an overflow or if an operand is promoted).
+         AdaptiveInteger& promoted(const AdaptiveInteger&, const Operation);
+         /// Same as above for the remainder of the division.
+         AdaptiveInteger& promotedModulo(const AdaptiveInteger&);
+         /// Comparison of two numbers, of which at least one is promoted (-1, 0 or 1 as the sign of a - b).
+         static int comparePromoted(const AdaptiveInteger&, const AdaptiveInteger&) noexcept;
+         /// Stores a BigInteger, which is demoted to int64_t if it fits.
+         void assign(BigInteger&&);
+         /// The value as BigInteger.
+         BigInteger toBigInteger() const;
+      private:
+         /// The value, unless it is promoted. The smallest value of int64_t is never used, so negation can't overflow.
+         int64_t small;
+         /// The value if it doesn't fit into small, nullptr otherwise.
+         std::unique_ptr<BigInteger> big;
+   };
+}
+
+#include "adaptive_integer.tpp"
+
@@ -0,0 +1,360 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace panda
+{
+   namespace adaptive
+   {
+      /// Smallest value used for unpromoted numbers (the smallest value of int64_t is excluded).
+      constexpr int64_t minimum = -std::numeric_limits<int64_t>::max();
+      /// Largest value used for unpromoted numbers.
+      constexpr int64_t maximum = std::numeric_limits<int64_t>::max();
+
+      /// The following functions store a op b in result and return false iff the result is out of [minimum, maximum].
+      inline bool add(const int64_t a, const int64_t b, int64_t& result) noexcept
+      {
+         #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_add_overflow(a, b, &result) && result != std::numeric_limits<int64_t>::min();
+         #else
+         if ( (b > 0 && a > maximum - b) || (b < 0 && a < minimum - b) )
+         {
+            return false;
+         }
+         result = a + b;
+         return true;
+         #endif
+      }
+
+      inline bool subtract(const int64_t a, const int64_t b, int64_t& result) noexcept
+      {
+         #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_sub_overflow(a, b, &result) && result != std::numeric_limits<int64_t>::min();
+         #else
+         return add(a, -b, result); // b is never the smallest value of int64_t.
+         #endif
+      }
+
+      inline bool multiply(const int64_t a, const int64_t b, int64_t& result) noexcept
+      {
+         #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_mul_overflow(a, b, &result) && result != std::numeric_limits<int64_t>::min();
+         #else
+         if ( a == 0 || b == 0 )
+         {
+            result = 0;
+            return true;
+         }
+         const auto magnitude_a = (a < 0) ? -a : a;
+         const auto magnitude_b = (b < 0) ? -b : b;
+         if ( magnitude_a > maximum / magnitude_b )
+         {
+            return false;
+         }
+         result = a * b;
+         return true;
+         #endif
+      }
+   }
+}
+
+panda::AdaptiveInteger::AdaptiveInteger() noexcept
+:
+   small(0),
+   big()
+{
+}
+
+panda::AdaptiveInteger::AdaptiveInteger(const AdaptiveInteger& other)
+:
+   small(other.small),
+   big(other.big ? new BigInteger(*other.big) : nullptr)
+{
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator=(const AdaptiveInteger& other)
+{
+   if ( this != &other )
+   {
+      small = other.small;
+      big.reset(other.big ? new BigInteger(*other.big) : nullptr);
+   }
+   return *this;
+}
+
+#ifdef INT16_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const int16_t value) noexcept
+:
+   small(value),
+   big()
+{
+}
+#endif
+
+#ifdef INT32_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const int32_t value) noexcept
+:
+   small(value),
+   big()
+{
+}
+#endif
+
+#ifdef INT64_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const int64_t value)
+:
+   small(value),
+   big()
+{
+   if ( value < adaptive::minimum )
+   {
+      small = 0;
+      big.reset(new BigInteger(value));
+   }
+}
+#endif
+
+#ifdef UINT16_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const uint16_t value) noexcept
+:
+   small(value),
+   big()
+{
+}
+#endif
+
+#ifdef UINT32_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const uint32_t value) noexcept
+:
+   small(value),
+   big()
+{
+}
+#endif
+
+#ifdef UINT64_MAX
+panda::AdaptiveInteger::AdaptiveInteger(const uint64_t value)
+:
+   small(0),
+   big()
+{
+   if ( value > static_cast<uint64_t>(adaptive::maximum) )
+   {
+      big.reset(new BigInteger(value));
+   }
+   else
+   {
+      small = static_cast<int64_t>(value);
+   }
+}
+#endif
+
+panda::AdaptiveInteger::operator int() const
+{
+   if ( big )
+   {
+      return static_cast<int>(*big);
+   }
+   if ( small < std::numeric_limits<int>::min() || small > std::numeric_limits<int>::max() )
+   {
+      throw std::invalid_argument("Number doesn't fit into int.");
+   }
+   return static_cast<int>(small);
+}
+
+bool panda::AdaptiveInteger::operator==(const int second) const noexcept
+{
+   return big ? (*big == second) : (small == second);
+}
+
+bool panda::AdaptiveInteger::operator!=(const int second) const noexcept
+{
+   return !(*this == second);
+}
+
+bool panda::AdaptiveInteger::operator<(const int second) const noexcept
+{
+   return big ? (*big < second) : (small < second);
+}
+
+bool panda::AdaptiveInteger::operator>(const int second) const noexcept
+{
+   return big ? (*big > second) : (small > second);
+}
+
+bool panda::AdaptiveInteger::operator<=(const int second) const noexcept
+{
+   return !(*this > second);
+}
+
+bool panda::AdaptiveInteger::operator>=(const int second) const noexcept
+{
+   return !(*this < second);
+}
+
+bool panda::AdaptiveInteger::operator==(const AdaptiveInteger& second) const noexcept
+{
+   if ( !big && !second.big )
+   {
+      return small == second.small;
+   }
+   return comparePromoted(*this, second) == 0;
+}
+
+bool panda::AdaptiveInteger::operator!=(const AdaptiveInteger& second) const noexcept
+{
+   return !(*this == second);
+}
+
+bool panda::AdaptiveInteger::operator<(const AdaptiveInteger& second) const noexcept
+{
+   if ( !big && !second.big )
+   {
+      return small < second.small;
+   }
+   return comparePromoted(*this, second) < 0;
+}
+
+bool panda::AdaptiveInteger::operator>(const AdaptiveInteger& second) const noexcept
+{
+   return second < *this;
+}
+
+bool panda::AdaptiveInteger::operator<=(const AdaptiveInteger& second) const noexcept
+{
+   return !(second < *this);
+}
+
+bool panda::AdaptiveInteger::operator>=(const AdaptiveInteger& second) const noexcept
+{
+   return !(*this < second);
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator*=(const AdaptiveInteger& second)
+{
+   int64_t result;
+   if ( !big && !second.big && adaptive::multiply(small, second.small, result) )
+   {
+      small = result;
+      return *this;
+   }
+   return promoted(second, &BigInteger::operator*=);
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator/=(const AdaptiveInteger& second)
+{
+   if ( !big && !second.big )
+   {
+      if ( second.small == 0 )
+      {
+         throw std::invalid_argument("Integer division by 0 in \"AdaptiveInteger::operator/\".");
+      }
+      small /= second.small; // cannot overflow, as the smallest value of int64_t is never used.
+      return *this;
+   }
+   return promoted(second, &BigInteger::operator/=);
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator+=(const AdaptiveInteger& second)
+{
+   int64_t result;
+   if ( !big && !second.big && adaptive::add(small, second.small, result) )
+   {
+      small = result;
+      return *this;
+   }
+   return promoted(second, &BigInteger::operator+=);
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator-=(const AdaptiveInteger& second)
+{
+   int64_t result;
+   if ( !big && !second.big && adaptive::subtract(small, second.small, result) )
+   {
+      small = result;
+      return *this;
+   }
+   return promoted(second, &BigInteger::operator-=);
+}
+
+panda::AdaptiveInteger& panda::AdaptiveInteger::operator%=(const AdaptiveInteger& second)
+{
+   if ( !big && !second.big )
+   {
+      if ( second.small == 0 )
+      {
+         throw std::invalid_argument("Integer division by 0 in \"AdaptiveInteger::operator/\".");
+      }
+      small %= second.small;
+      return *this;
+   }
+   return promotedModulo(second);
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator*(const AdaptiveInteger& second) const
+{
+   auto result = *this;
+   result *= second;
+   return result;
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator/(const AdaptiveInteger& second) const
+{
+   auto result = *this;
+   result /= second;
+   return result;
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator+(const AdaptiveInteger& second) const
+{
+   auto result = *this;
+   result += second;
+   return result;
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator-(const AdaptiveInteger& second) const
+{
+   auto result = *this;
+   result -= second;
+   return result;
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator%(const AdaptiveInteger& second) const
+{
+   auto result = *this;
+   result %= second;
+   return result;
+}
+
+panda::AdaptiveInteger panda::AdaptiveInteger::operator-() const
+{
+   auto result = *this;
+   if ( result.big )
+   {
+      *result.big = -*result.big;
+   }
+   result.small = -result.small; // promoted numbers keep small at zero.
+   return result;
+}
+
+bool panda::AdaptiveInteger::isPromoted() const noexcept
+{
+   return static_cast<bool>(big);
+}
+
+panda::AdaptiveInteger panda::abs(const AdaptiveInteger& n)
+{
+   return (n < 0) ? -n : n;
+}
+
+std::size_t panda::hash(const AdaptiveInteger& n) noexcept
+{
+   return n.big ? hash(*n.big) : std::hash<int64_t>()(n.small);
+}
+
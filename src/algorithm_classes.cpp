@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <set>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <iostream>
 #include <cmath>
@@ -23,6 +24,26 @@
 
 using namespace panda;
 
+namespace
+{
+   /// Returns true if none of the rows has a common divisor of its entries.
+   template <typename Integer>
+   bool allNormalized(const std::set<Row<Integer>>&);
+   /// Shifts the values to a minimum of zero and divides them by their gcd.
+   /// Returns an empty row if all values are equal.
+   template <typename Integer>
+   Row<Integer> canonicalValues(Row<Integer>);
+#ifdef ROUNDED_DETERMINISTICS
+   /// Returns the values of the deterministic points for a row (without its last entry),
+   /// shifted to a minimum of zero, divided by the gap to the second smallest value and rounded.
+   template <typename Integer>
+   std::vector<double> rescaledDeterministics(const Row<Integer>&, const DenseMatrix<Integer>&);
+#endif
+   /// Returns a sorted copy.
+   template <typename T>
+   std::vector<T> sorted(std::vector<T>);
+}
+
 template <typename Integer, typename TagType>
 Row<Integer> panda::algorithm::classRepresentative(const Row<Integer>& row, const Maps& maps, TagType tag)
 {
@@ -32,10 +53,47 @@ Row<Integer> panda::algorithm::classRepresentative(const Row<Integer>& row, cons
    return *matrix.crbegin(); // Important detail: last element is chosen as the representative
 }
 
+template <typename Integer, typename TagType>
+Row<Integer> panda::algorithm::classRepresentative(const Row<Integer>& row, const Symmetries<Integer, TagType>& symmetries, TagType tag)
+{
+   assert( !row.empty() );
+   // the cache only holds normalized rows, the class of other rows contains the row itself and the normalized row.
+   const auto cacheable = !symmetries.maps.empty() && gcd(row) == 1;
+   if ( cacheable )
+   {
+      const auto cached = symmetries.cache.find(row);
+      if ( cached )
+      {
+         return *cached;
+      }
+      if ( symmetries.group )
+      {
+         const auto representative = symmetries.group->largestImage(row);
+         symmetries.cache.insert({row}, representative);
+         return representative;
+      }
+   }
+   const auto matrix = getClass(row, symmetries.compiled_maps, tag);
+   assert( !matrix.empty() );
+   if ( cacheable )
+   {
+      symmetries.cache.insert(matrix, *matrix.crbegin());
+   }
+   return *matrix.crbegin(); // Important detail: last element is chosen as the representative
+}
+
 template <typename Integer, typename TagType>
 std::set<Row<Integer>> panda::algorithm::getClass(const Row<Integer>& row, const Maps& maps, TagType tag)
+{
+   return getClass(row, compile(maps, tag), tag);
+}
+
+template <typename Integer, typename TagType>
+std::set<Row<Integer>> panda::algorithm::getClass(const Row<Integer>& row, const CompiledMaps& maps, TagType tag)
 {
    assert( !row.empty() );
+   // compiled permutations keep a common divisor, all other images of apply are divided by it.
+   const auto gcd_value = gcd(row);
    std::set<Row<Integer>> rows;
    rows.insert(row);
    using Iterator = typename std::set<Row<Integer>>::iterator;
@@ -47,7 +105,11 @@ std::set<Row<Integer>> panda::algorithm::getClass(const Row<Integer>& row, const
       iterators.pop_back();
       for ( const auto& map : maps )
       {
-         const auto new_row = apply(map, current_row, tag);
+         auto new_row = apply(map, current_row, tag);
+         if ( gcd_value > 1 && map.kind != MapKind::General )
+         {
+            new_row /= gcd_value;
+         }
          Iterator iterator;
          bool inserted;
          std::tie(iterator, inserted) = rows.insert(new_row);
@@ -77,6 +139,13 @@ Matrix<Integer> panda::algorithm::classesDeterministic(Matrix<Integer> input, co
 template <typename Integer, typename TagType>
 Matrix<Integer> panda::algorithm::classes(std::set<Row<Integer>> rows, const Maps& maps, TagType tag)
 {
+   return classes(std::move(rows), compile(maps, tag), tag);
+}
+
+template <typename Integer, typename TagType>
+Matrix<Integer> panda::algorithm::classes(std::set<Row<Integer>> rows, const CompiledMaps& maps, TagType tag)
+{
+   // each class is enumerated once and removed from the rows.
    Matrix<Integer> classes;
    while ( !rows.empty() )
    {
@@ -95,17 +164,80 @@ Matrix<Integer> panda::algorithm::classes(std::set<Row<Integer>> rows, const Map
    return classes;
 }
 
+template <typename Integer, typename TagType>
+Matrix<Integer> panda::algorithm::classes(const Matrix<Integer>& input, const Symmetries<Integer, TagType>& symmetries, TagType tag)
+{
+   return classes(std::set<Row<Integer>>(input.cbegin(), input.cend()), symmetries, tag);
+}
+
+template <typename Integer, typename TagType>
+Matrix<Integer> panda::algorithm::classes(std::set<Row<Integer>> rows, const Symmetries<Integer, TagType>& symmetries, TagType tag)
+{
+   if ( symmetries.maps.empty() || !allNormalized(rows) )
+   {
+      return classes(std::move(rows), symmetries.compiled_maps, tag);
+   }
+   Matrix<Integer> classes;
+   // same order of the classes as above: the smallest row of a class is always found first.
+   std::set<Row<Integer>> representatives;
+   const auto add = [&](const Row<Integer>& representative)
+   {
+      if ( representatives.insert(representative).second )
+      {
+         classes.push_back(representative);
+      }
+   };
+   while ( !rows.empty() )
+   {
+      const auto cached = symmetries.cache.find(*rows.begin());
+      if ( cached )
+      {
+         add(*cached);
+         rows.erase(rows.begin());
+         continue;
+      }
+      if ( symmetries.group )
+      {
+         const auto representative = symmetries.group->largestImage(*rows.begin());
+         symmetries.cache.insert({*rows.begin()}, representative);
+         add(representative);
+         rows.erase(rows.begin());
+         continue;
+      }
+      const auto row_class = getClass(*rows.begin(), symmetries.compiled_maps, tag);
+      assert( !row_class.empty() );
+      symmetries.cache.insert(row_class, *row_class.crbegin());
+      add(*row_class.crbegin());
+      for ( const auto& row : row_class )
+      {
+         const auto position = rows.find(row);
+         if ( position != rows.end() )
+         {
+            rows.erase(position);
+         }
+      }
+   }
+   return classes;
+}
+
 template <typename Integer, typename TagType>
 Matrix<Integer> panda::algorithm::classesDeterministic(std::set<Row<Integer>> rows, const Maps& maps, Matrix<Integer> dets, TagType tag)
+{
+   return classesDeterministic(std::move(rows), compile(maps, tag), std::move(dets), tag);
+}
+
+template <typename Integer, typename TagType>
+Matrix<Integer> panda::algorithm::classesDeterministic(std::set<Row<Integer>> rows, const CompiledMaps& compiled_maps, Matrix<Integer> dets, TagType tag)
 {
    // check if any deterministics are given -> otherwise let the usual algorithm run
    if ( dets.size() < 1)
    {
-      return classes(rows, maps, tag);
+      return classes(rows, compiled_maps, tag);
    }
    // std::cerr << "running deterministic version of classes algorithm \n";
    // std::cerr << "Number of deterministics: " << dets.size() << "\n";
 
+   const DenseMatrix<Integer> dense(dets);
    // class representatives to return
    Matrix<Integer> classes_repr;
    classes_repr.push_back(*rows.begin());
@@ -115,7 +247,7 @@ Matrix<Integer> panda::algorithm::classesDeterministic(std::set<Row<Integer>> ro
       //std::cerr << "classes_repr.size(): " << classes_repr.size() << "\n";
       for ( auto crow: classes_repr)
       {
-         if( panda::algorithm::checkEquivalenceMaps(crow, row, dets, maps, tag))
+         if( panda::algorithm::checkEquivalenceMaps(crow, row, dense, compiled_maps, tag))
          {
             isEquiv = true;
          }
@@ -128,6 +260,16 @@ Matrix<Integer> panda::algorithm::classesDeterministic(std::set<Row<Integer>> ro
    return classes_repr;
 }
 
+template <typename Integer, typename TagType>
+Matrix<Integer> panda::algorithm::classesDeterministic(std::set<Row<Integer>> rows, const Symmetries<Integer, TagType>& symmetries, Matrix<Integer> dets, TagType tag)
+{
+   if ( dets.empty() )
+   {
+      return classes(std::move(rows), symmetries, tag);
+   }
+   return classesDeterministic(std::move(rows), symmetries.compiled_maps, std::move(dets), tag);
+}
+
 template <typename  Integer>
 std::set<std::vector<double>> panda::algorithm::affineTransformation(const std::set<Row<Integer>>& input)
 {
@@ -157,6 +299,10 @@ template <typename  Integer>
 bool panda::algorithm::checkEquivalence(const Row<Integer>& row_one, const Row<Integer>& row_two, const Deterministics<Integer>& dets) {
    assert (row_one.size() == row_two.size());
    assert (*dets.begin().size() == row_one.size());
+#ifndef ROUNDED_DETERMINISTICS
+   const auto key_one = canonicalValues(dets * row_one);
+   return !key_one.empty() && key_one == canonicalValues(dets * row_two);
+#else
    // multiply the vectors by the deterministics
    Row<Integer> v_one = dets * row_one;
    Row<Integer> v_two = dets * row_two;
@@ -210,63 +356,79 @@ bool panda::algorithm::checkEquivalence(const Row<Integer>& row_one, const Row<I
       std::cerr << "\n";
    }*/
    return d_one == d_two;
+#endif
+}
+
+template <typename Integer>
+Row<Integer> panda::algorithm::canonicalForm(const Row<Integer>& row_ext, const Deterministics<Integer>& dets)
+{
+   return canonicalForm(row_ext, DenseMatrix<Integer>(dets));
+}
+
+template <typename Integer>
+Row<Integer> panda::algorithm::canonicalForm(const Row<Integer>& row_ext, const DenseMatrix<Integer>& dets)
+{
+   assert( !row_ext.empty() );
+   // cut off factor ( we don't need to scale by the factor, as we will scale v independently)
+   const Row<Integer> row(row_ext.begin(), row_ext.end() - 1);
+   return canonicalValues(dets * row);
+}
+
+template <typename Integer>
+Row<Integer> panda::algorithm::fingerprint(const Row<Integer>& row, const Deterministics<Integer>& dets)
+{
+   return fingerprint(row, DenseMatrix<Integer>(dets));
+}
+
+template <typename Integer>
+Row<Integer> panda::algorithm::fingerprint(const Row<Integer>& row, const DenseMatrix<Integer>& dets)
+{
+   return sorted(canonicalForm(row, dets));
 }
 
 template <typename  Integer, typename TagType>
 bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, const Row<Integer>& row_two_ext, const Deterministics<Integer>& dets, const Maps& maps, TagType tag)
 {
-   // Copy row vectors and cut off factor ( we don't need to scale by the factor, as we will scale v independently)
-   Row<Integer> row_one;
-   Row<Integer> row_two;
-   for ( int i = 0; i < row_one_ext.size()-1; i++)
-   {
-      row_one.push_back(row_one_ext[i]);
-      row_two.push_back(row_two_ext[i]);
-   }
+   return checkEquivalenceMaps(row_one_ext, row_two_ext, DenseMatrix<Integer>(dets), compile(maps, tag), tag);
+}
 
+template <typename  Integer, typename TagType>
+bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, const Row<Integer>& row_two_ext, const Deterministics<Integer>& dets, const CompiledMaps& maps, TagType tag)
+{
+   return checkEquivalenceMaps(row_one_ext, row_two_ext, DenseMatrix<Integer>(dets), maps, tag);
+}
 
-   // std::cerr << "Num dets: " << dets.size() << "\n";
-   // multiply the vectors by the deterministics
-   Row<Integer> v_one = dets * row_one;
-   Row<Integer> v_two = dets * row_two;
-   // std::cerr << "Length v_one: " << v_one.size() << "\n";
-   // Generate double vectors from the v_vectors and the factor obtained before
-   std::vector<double> d_one;
-   std::vector<double> d_two;
-   for ( int i = 0; i < dets.size(); i++){
-      d_one.push_back(v_one[i] ); // we need to divide here by the factor
-      d_two.push_back(v_two[i] );
+template <typename  Integer, typename TagType>
+bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, const Row<Integer>& row_two_ext, const DenseMatrix<Integer>& dets, const CompiledMaps& maps, TagType tag)
+{
+#ifndef ROUNDED_DETERMINISTICS
+   const auto key_one = canonicalForm(row_one_ext, dets);
+   if ( key_one.empty() )
+   {
+      return false;
    }
-   // find the two lowest values in each vector
-   std::vector<double> sorted_one(d_one.size());
-   std::vector<double> sorted_two(d_two.size());
-   std::partial_sort_copy(d_one.begin(), d_one.end(), sorted_one.begin(), sorted_one.end());
-   std::partial_sort_copy(d_two.begin(), d_two.end(), sorted_two.begin(), sorted_two.end());
-   double f_one = sorted_one[0];
-   double f_two = sorted_two[0];
-   double g_one = f_one;
-   double g_two = f_two;
-   int i = 0;
-   while (f_one == g_one && i < d_one.size()) {
-      g_one = sorted_one[i];
-      i++;
+   const auto key_two = canonicalForm(row_two_ext, dets);
+   if ( key_one == key_two )
+   {
+      return true;
    }
-   i = 0;
-   while (f_two == g_two && i < d_two.size()) {
-      g_two = sorted_two[i];
-      i++;
+   // perform tally check if relabels are given
+   if ( maps.empty() || sorted(key_one) != sorted(key_two) )
+   {
+      return false;
    }
-   g_one = g_one - f_one;
-   g_two = g_two - f_two;
-
-   // rescale vectors (also sorted ones to compare)
-   for (int i = 0; i < d_one.size(); i++) {
-      d_one[i] = (d_one[i] - f_one) / g_one;
-      d_two[i] = (d_two[i] - f_two) / g_two;
-      // round the values
-      d_one[i] = round(d_one[i] * 1000) / 1000;
-      d_two[i] = round(d_two[i] * 1000) / 1000;
+   for ( const auto& map : maps )
+   {
+      const auto new_row = panda::algorithm::apply(map, row_two_ext, tag);
+      if ( new_row != row_two_ext && canonicalForm(new_row, dets) == key_one )
+      {
+         return true;
+      }
    }
+   return false;
+#else
+   const auto d_one = rescaledDeterministics(row_one_ext, dets);
+   const auto d_two = rescaledDeterministics(row_two_ext, dets);
    // check if the two vectors are the same
    if ( d_one == d_two)
    {
@@ -276,9 +438,7 @@ bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, con
    // perform tally check if relabels are given
    if (maps.size() > 0)
    {
-      std::partial_sort_copy(d_one.begin(), d_one.end(), sorted_one.begin(), sorted_one.end());
-      std::partial_sort_copy(d_two.begin(), d_two.end(), sorted_two.begin(), sorted_two.end());
-      if ( !(sorted_one == sorted_two))
+      if ( !(sorted(d_one) == sorted(d_two)))
       {
          return false;
       }
@@ -292,7 +452,7 @@ bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, con
       // Check if new row is different from row_two_ext -> if not, no rerun neededs
       if ( !(new_row == row_two_ext)){
          // generate empty maps to call the same functions
-         Maps empty_maps;
+         CompiledMaps empty_maps;
          // check if the new rows are equivalent
          if( panda::algorithm::checkEquivalenceMaps(row_one_ext, new_row, dets, empty_maps, tag))
          {
@@ -302,4 +462,75 @@ bool panda::algorithm::checkEquivalenceMaps(const Row<Integer>& row_one_ext, con
 
    }
    return false;
-}
\ No newline at end of file
+#endif
+}
+
+namespace
+{
+   template <typename Integer>
+   bool allNormalized(const std::set<Row<Integer>>& rows)
+   {
+      return std::all_of(rows.cbegin(), rows.cend(), [](const Row<Integer>& row)
+      {
+         return algorithm::gcd(row) == 1;
+      });
+   }
+
+   template <typename Integer>
+   Row<Integer> canonicalValues(Row<Integer> values)
+   {
+      assert( !values.empty() );
+      const auto minimum = *std::min_element(values.cbegin(), values.cend());
+      for ( auto& value : values )
+      {
+         value -= minimum;
+      }
+      // the differences are non-negative and scaled by the same factor for all equivalent rows.
+      const auto gcd_value = algorithm::gcd(values);
+      if ( gcd_value == 0 )
+      {
+         return Row<Integer>();
+      }
+      if ( gcd_value > 1 )
+      {
+         values /= gcd_value;
+      }
+      return values;
+   }
+
+#ifdef ROUNDED_DETERMINISTICS
+   template <typename Integer>
+   std::vector<double> rescaledDeterministics(const Row<Integer>& row_ext, const DenseMatrix<Integer>& dets)
+   {
+      // cut off factor ( we don't need to scale by the factor, as we will scale v independently)
+      const Row<Integer> row(row_ext.begin(), row_ext.end() - 1);
+      // multiply the vector by the deterministics
+      const Row<Integer> v = dets * row;
+      std::vector<double> d(v.begin(), v.begin() + static_cast<typename Row<Integer>::difference_type>(dets.rows()));
+      // find the two lowest values
+      const auto sorted_d = sorted(d);
+      const double f = sorted_d[0];
+      double g = f;
+      for ( std::size_t i = 0; f == g && i < d.size(); ++i )
+      {
+         g = sorted_d[i];
+      }
+      g = g - f;
+      // rescale and round the values
+      for ( auto& value : d )
+      {
+         value = (value - f) / g;
+         value = round(value * 1000) / 1000;
+      }
+      return d;
+   }
+#endif
+
+   template <typename T>
+   std::vector<T> sorted(std::vector<T> values)
+   {
+      std::sort(values.begin(), values.end());
+      return values;
+   }
+}
+
@@ -7,10 +7,14 @@
 #pragma once
 
 #include <set>
+#include <vector>
 
+#include "compiled_map.h"
+#include "dense_matrix.h"
 #include "maps.h"
 #include "matrix.h"
 #include "row.h"
+#include "symmetries.h"
 #include "tags.h"
 
 namespace panda
@@ -21,10 +25,17 @@ namespace panda
       /// Precondition: if input is a facet, the facet must be normalized.
       template <typename Integer, typename TagType>
       Row<Integer> classRepresentative(const Row<Integer>&, const Maps&, TagType);
+      /// Same as above, but the representative is found in the group of the symmetries if possible.
+      /// Every class that is determined is stored in the cache of the symmetries, later rows of the class are looked up.
+      template <typename Integer, typename TagType>
+      Row<Integer> classRepresentative(const Row<Integer>&, const Symmetries<Integer, TagType>&, TagType);
       /// Creates a set of rows which is the complete class containing the input row.
       /// Precondition: if input is a facet, the facet must be normalized.
       template <typename Integer, typename TagType>
       std::set<Row<Integer>> getClass(const Row<Integer>&, const Maps&, TagType);
+      /// Same as above with maps compiled for the tag.
+      template <typename Integer, typename TagType>
+      std::set<Row<Integer>> getClass(const Row<Integer>&, const CompiledMaps&, TagType);
       /// Reduces a list of rows to just the representatives.
       /// Precondition: if input are facets, then these facets must be normalized.
       template <typename Integer, typename TagType>
@@ -37,10 +48,25 @@ namespace panda
       /// Precondition: if input are facets, then these facets must be normalized.
       template <typename Integer, typename TagType>
       Matrix<Integer> classes(std::set<Row<Integer>>, const Maps&, TagType);
+      /// Same as above with maps compiled for the tag.
+      template <typename Integer, typename TagType>
+      Matrix<Integer> classes(std::set<Row<Integer>>, const CompiledMaps&, TagType);
+      /// Same as above, but uses the group and the cache of the symmetries (see classRepresentative).
+      template <typename Integer, typename TagType>
+      Matrix<Integer> classes(const Matrix<Integer>&, const Symmetries<Integer, TagType>&, TagType);
+      /// Same as above, but uses the group and the cache of the symmetries (see classRepresentative).
+      template <typename Integer, typename TagType>
+      Matrix<Integer> classes(std::set<Row<Integer>>, const Symmetries<Integer, TagType>&, TagType);
       /// Reduces a list of rows to just the representative using deterministic points.
       /// Precondition: deterministics must be given
       template <typename Integer, typename TagType>
       Matrix<Integer> classesDeterministic(std::set<Row<Integer>>, const Maps&, Matrix<Integer>, TagType);
+      /// Same as above with maps compiled for the tag.
+      template <typename Integer, typename TagType>
+      Matrix<Integer> classesDeterministic(std::set<Row<Integer>>, const CompiledMaps&, Matrix<Integer>, TagType);
+      /// Same as above, but without deterministic points the classes are determined with the symmetries.
+      template <typename Integer, typename TagType>
+      Matrix<Integer> classesDeterministic(std::set<Row<Integer>>, const Symmetries<Integer, TagType>&, Matrix<Integer>, TagType);
       /// Transforms a list of rows under affine transformation
       /// Precondition: None?
       template <typename Integer>
@@ -53,6 +79,27 @@ namespace panda
       /// Precondition: None
       template <typename  Integer, typename TagType>
       bool checkEquivalenceMaps(const Row<Integer>&, const Row<Integer>&, const Deterministics<Integer>&, const Maps&, TagType);
+      /// Same as above with maps compiled for the tag.
+      template <typename  Integer, typename TagType>
+      bool checkEquivalenceMaps(const Row<Integer>&, const Row<Integer>&, const Deterministics<Integer>&, const CompiledMaps&, TagType);
+      /// Same as above with the deterministic points in contiguous memory (for repeated tests).
+      template <typename  Integer, typename TagType>
+      bool checkEquivalenceMaps(const Row<Integer>&, const Row<Integer>&, const DenseMatrix<Integer>&, const CompiledMaps&, TagType);
+      /// Returns the exact key of a row (without its last entry) for checkEquivalenceMaps: the values of the
+      /// deterministic points, shifted to a minimum of zero and divided by their gcd.
+      /// Rows with the same key are equivalent. The key is empty if all values are equal (never equivalent).
+      template <typename Integer>
+      Row<Integer> canonicalForm(const Row<Integer>&, const Deterministics<Integer>&);
+      /// Same as above with the deterministic points in contiguous memory.
+      template <typename Integer>
+      Row<Integer> canonicalForm(const Row<Integer>&, const DenseMatrix<Integer>&);
+      /// Returns an invariant of a row for checkEquivalenceMaps: the sorted canonical form.
+      /// Rows that are equivalent there have equal fingerprints.
+      template <typename Integer>
+      Row<Integer> fingerprint(const Row<Integer>&, const Deterministics<Integer>&);
+      /// Same as above with the deterministic points in contiguous memory.
+      template <typename Integer>
+      Row<Integer> fingerprint(const Row<Integer>&, const DenseMatrix<Integer>&);
    }
 }
 
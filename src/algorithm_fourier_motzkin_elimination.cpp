@@ -9,18 +9,28 @@
 #undef COMPILE_TEMPLATE_ALGORITHM_FOURIER_MOTZKIN_ELIMINATION
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
 #include <forward_list>
 #include <iostream>
 #include <limits>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <random>
 #include <utility>
 
+#include "algorithm_integer_operations.h"
 #include "algorithm_matrix_operations.h"
 #include "algorithm_row_operations.h"
 #include "bitset_fixed_size.h"
-#include "bitset_variable_size.h"
+#include "bitset_wide.h"
 #include "delayed_action.h"
+#include "dense_matrix.h"
+#include "joining_thread.h"
 #include "range.h"
+#include "subset_index.h"
 
 using namespace panda;
 
@@ -29,12 +39,27 @@ namespace
    using Index = std::size_t;
    using Indices = std::vector<Index>;
    using ColumnIndex = std::size_t;
+   /// Pairs of a negative and a positive row together with the bitset of their combination.
+   template <typename Bitset>
+   using PNRs = std::forward_list<std::tuple<Index, Index, Bitset>>;
+   /// Below this number of pairs (or new rows) in a projection step, threads are not worth starting.
+   constexpr std::size_t minimum_parallel_work = 1024;
+   /// Calls the function for 0, ..., count - 1 on the given number of threads (including the caller).
+   /// If any call throws, the remaining calls are skipped and the first exception is rethrown.
+   template <typename Function>
+   void parallelFor(const std::size_t, const std::size_t, Function);
    /// Chooses the correct Bitset type.
    template <typename Integer>
-   void phaseTwoDispatch(Matrix<Integer>&, const Vertices<Integer>&);
+   void phaseTwoDispatch(Matrix<Integer>&, const Vertices<Integer>&, const std::size_t, const InsertionOrder);
    /// The actual FME, named phase Two in Christof.
    template <typename Bitset, typename Integer>
-   void phaseTwo(Matrix<Integer>&, const Vertices<Integer>&);
+   void phaseTwo(Matrix<Integer>&, const Vertices<Integer>&, const std::size_t, const InsertionOrder);
+   /// Returns the vertex indices in order of insertion. The first indices (the initial simplex) stay in place.
+   template <typename Integer>
+   Indices insertionSequence(const Vertices<Integer>&, const std::size_t, const InsertionOrder);
+   /// Moves the vertex that cuts off the fewest rows of the matrix to the given position of the insertion sequence.
+   template <typename Integer>
+   void selectMinCutoff(const DenseMatrix<Integer>&, const Vertices<Integer>&, Indices&, const std::size_t, const std::size_t);
    /// Abortable phase Two.
    template <typename Bitset, typename Integer>
    void phaseTwoHeuristic(Matrix<Integer>&, const Vertices<Integer>&);
@@ -46,13 +71,14 @@ namespace
    std::tuple<Indices, Indices, Indices> getIndicesNZP(const Row<Integer>&, const std::vector<Bitset>&, const std::size_t);
    /// Replaces the system of matrix and indices.
    template <typename Bitset, typename Integer>
-   std::pair<Matrix<Integer>, std::vector<Bitset>> updateSystem(
-      const Matrix<Integer>&,
+   std::pair<DenseMatrix<Integer>, std::vector<Bitset>> updateSystem(
+      const DenseMatrix<Integer>&,
       const std::vector<Bitset>&,
       const Index,
       const std::tuple<Indices, Indices, Indices>&,
       const Row<Integer>&,
-      const std::forward_list<std::tuple<Index, Index, Bitset>>&);
+      const PNRs<Bitset>&,
+      const std::size_t);
    /// Checks minimality of the new system.
    template <typename Bitset>
    bool isMinimal(const Bitset&, const std::forward_list<std::tuple<Index, Index, Bitset>>&, const std::size_t);
@@ -67,11 +93,23 @@ namespace
    std::vector<Bitset> initializeR(const Matrix<Integer>&, const Vertices<Integer>&);
    /// Elimination of one ray.
    template <typename Bitset, typename Integer>
-   void projection(Matrix<Integer>&, std::vector<Bitset>&, const Vertex<Integer>&, const Index);
+   void projection(DenseMatrix<Integer>&, std::vector<Bitset>&, const Vertex<Integer>&, const Index, const std::size_t);
+   /// Returns the scalar product of a row of the matrix and a vertex.
+   template <typename Integer>
+   Integer scalarProduct(const DenseMatrix<Integer>&, const Index, const Vertex<Integer>&);
+   /// Merges the minimal pairs found independently for consecutive blocks of negative rows.
+   template <typename Bitset>
+   PNRs<Bitset> mergeMinimal(const std::vector<PNRs<Bitset>>&, const std::size_t, const std::size_t);
 }
 
 template <typename Integer>
 Matrix<Integer> panda::algorithm::fourierMotzkinElimination(Matrix<Integer> input)
+{
+   return fourierMotzkinElimination(std::move(input), 1, InsertionOrder::MinIndex);
+}
+
+template <typename Integer>
+Matrix<Integer> panda::algorithm::fourierMotzkinElimination(Matrix<Integer> input, const std::size_t threads, const InsertionOrder order)
 {
    assert( !input.empty() );
    auto matrix = input;
@@ -95,7 +133,7 @@ Matrix<Integer> panda::algorithm::fourierMotzkinElimination(Matrix<Integer> inpu
       input.erase(input.begin() + static_cast<typename Matrix<Integer>::difference_type>(*it));
    }
    input.insert(input.begin(), used.cbegin(), used.cend());
-   phaseTwoDispatch(matrix, input);
+   phaseTwoDispatch(matrix, input, threads, order);
    reinsertZeroColumns(matrix, zero_columns);
    return matrix;
 }
@@ -125,7 +163,7 @@ Matrix<Integer> panda::algorithm::fourierMotzkinEliminationHeuristic(Matrix<Inte
       input.erase(input.begin() + static_cast<typename Matrix<Integer>::difference_type>(*it));
    }
    input.insert(input.begin(), used.cbegin(), used.cend());
-   phaseTwoHeuristic<BitsetVariableSize>(matrix, input);
+   phaseTwoHeuristic<BitsetWide>(matrix, input);
    reinsertZeroColumns(matrix, zero_columns);
    return matrix;
 }
@@ -140,99 +178,67 @@ namespace
 
    ///  As the stack size is limited, using fixed size bitsets is not scalable.
    ///  Hence, only for a small number of vertices, a fixed size bitset is used.
-   ///  For all other, a generalized, heap-based, bitset is used.
+   ///  For all other, a heap-based bitset with 64 bit words and vectorized kernels is used,
+   ///  which is faster than the fixed size bitsets beyond 512 bits (16 words, see src/benchmark/bitset.cpp).
 
    /// This method automatically chooses the optimal bitset type and executes the phase 2.
    template <typename Integer>
-   void phaseTwoDispatch(Matrix<Integer>& matrix, const Vertices<Integer>& vertices)
+   void phaseTwoDispatch(Matrix<Integer>& matrix, const Vertices<Integer>& vertices, const std::size_t threads, const InsertionOrder order)
    {
       assert( !vertices.empty() );
-      static_assert(std::is_same<BitsetFixedSize<1u>::DataType, BitsetVariableSize::DataType>::value, "The datatypes of BitsetFixedSize and BitsetVariableSize do not match. This is crucial for the optimal choice of type.");
       const auto bitset_size = 1 + (vertices.size() - 1) / std::numeric_limits<typename BitsetFixedSize<1u>::DataType>::digits;
       if ( bitset_size <= 1u )
       {
-         phaseTwo<BitsetFixedSize<1u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<1u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 2u )
       {
-         phaseTwo<BitsetFixedSize<2u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<2u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 3u )
       {
-         phaseTwo<BitsetFixedSize<3u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<3u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 4u )
       {
-         phaseTwo<BitsetFixedSize<4u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<4u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 6u )
       {
-         phaseTwo<BitsetFixedSize<6u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<6u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 8u )
       {
-         phaseTwo<BitsetFixedSize<8u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<8u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 10u )
       {
-         phaseTwo<BitsetFixedSize<10u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<10u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 12u )
       {
-         phaseTwo<BitsetFixedSize<12u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<12u>>(matrix, vertices, threads, order);
       }
       else if ( bitset_size <= 16u )
       {
-         phaseTwo<BitsetFixedSize<16u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 20u )
-      {
-         phaseTwo<BitsetFixedSize<20u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 30u )
-      {
-         phaseTwo<BitsetFixedSize<30u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 40u )
-      {
-         phaseTwo<BitsetFixedSize<40u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 50u )
-      {
-         phaseTwo<BitsetFixedSize<50u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 75u )
-      {
-         phaseTwo<BitsetFixedSize<75u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 100u )
-      {
-         phaseTwo<BitsetFixedSize<100u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 150u )
-      {
-         phaseTwo<BitsetFixedSize<150u>>(matrix, vertices);
-      }
-      else if ( bitset_size <= 200u )
-      {
-         phaseTwo<BitsetFixedSize<200u>>(matrix, vertices);
+         phaseTwo<BitsetFixedSize<16u>>(matrix, vertices, threads, order);
       }
       else
       {
-         phaseTwo<BitsetVariableSize>(matrix, vertices);
+         phaseTwo<BitsetWide>(matrix, vertices, threads, order);
       }
    }
 
    template <typename Integer>
-   Facets<Integer> extractFacets(const Matrix<Integer>& matrix, const Vertices<Integer>& vertices, const std::size_t start)
+   Facets<Integer> extractFacets(const DenseMatrix<Integer>& matrix, const Vertices<Integer>& vertices, const std::size_t start)
    {
       const auto& vs = vertices;
       Facets<Integer> facets;
-      for ( const auto& row : matrix )
+      for ( std::size_t j = 0; j < matrix.rows(); ++j )
       {
-         if ( std::all_of(vs.cbegin() + static_cast<typename Vertices<Integer>::difference_type>(start), vs.cend(), [&row](const Row<Integer>& v) { return row * v <= 0; }) )
+         if ( std::all_of(vs.cbegin() + static_cast<typename Vertices<Integer>::difference_type>(start), vs.cend(), [&matrix, &j](const Row<Integer>& v) { return scalarProduct(matrix, j, v) <= 0; }) )
          {
-            facets.push_back(row);
+            facets.push_back(matrix[j].toRow());
          }
       }
       return facets;
@@ -244,13 +250,11 @@ namespace
       return Bitset::unionCount(Rn, Rp, max) <= max_count;
    }
 
+   /// The pair is adjacent iff no row that is zero on the vertex is tight on all vertices the pair is tight on.
    template <typename Bitset>
-   bool containmentCheck(const Bitset& Rn, const Bitset& Rp, const std::size_t max, const std::vector<Bitset>& R, const Indices& indices_zero)
+   bool containmentCheck(const Bitset& Rn, const Bitset& Rp, const SubsetIndex<Bitset>& zero_sets)
    {
-      return std::all_of(indices_zero.cbegin(), indices_zero.cend(), [&](const std::size_t index_z)
-      {
-         return !Bitset::unionContains(Rn, Rp, R[index_z], max);
-      });
+      return !zero_sets.containsSubsetOfUnion(Rn, Rp);
    }
 
    template <typename Bitset>
@@ -281,12 +285,107 @@ namespace
       pnrs.push_front(std::make_tuple(index_n, index_p, u));
    }
 
+   template <typename Function>
+   void parallelFor(const std::size_t count, const std::size_t threads, Function function)
+   {
+      const auto thread_count = std::min(threads, count);
+      if ( thread_count <= 1 )
+      {
+         for ( std::size_t i = 0; i < count; ++i )
+         {
+            function(i);
+         }
+         return;
+      }
+      std::atomic<std::size_t> next(0);
+      std::exception_ptr error;
+      std::mutex error_mutex;
+      const auto work = [&]()
+      {
+         try
+         {
+            for ( auto i = next++; i < count; i = next++ )
+            {
+               function(i);
+            }
+         }
+         catch ( ... )
+         {
+            next = count;
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if ( !error )
+            {
+               error = std::current_exception();
+            }
+         }
+      };
+      {
+         std::list<JoiningThread> helpers;
+         for ( std::size_t i = 1; i < thread_count; ++i )
+         {
+            helpers.emplace_back(work);
+         }
+         work();
+      }
+      if ( error )
+      {
+         std::rethrow_exception(error);
+      }
+   }
+
+   /// The pairs of block b are the ones the sequential loop would keep if it only knew the negative rows of block b.
+   /// A pair survives the merge iff no other block has a pair with a strictly smaller bitset and
+   /// no earlier block has a pair with the same bitset, which is exactly the sequential result.
+   /// The sequential loop pushes to the front, so the blocks are concatenated from the last to the first.
+   template <typename Bitset>
+   PNRs<Bitset> mergeMinimal(const std::vector<PNRs<Bitset>>& blocks, const std::size_t max, const std::size_t threads)
+   {
+      std::vector<std::vector<const std::tuple<Index, Index, Bitset>*>> survivors(blocks.size());
+      parallelFor(blocks.size(), threads, [&](const std::size_t b)
+      {
+         for ( const auto& pnr : blocks[b] )
+         {
+            const auto& u = std::get<2>(pnr);
+            bool minimal = true;
+            for ( std::size_t c = 0; c < blocks.size() && minimal; ++c )
+            {
+               if ( c == b )
+               {
+                  continue;
+               }
+               for ( const auto& other : blocks[c] )
+               {
+                  const auto& v = std::get<2>(other);
+                  if ( u.contains(v, max) && (c < b || !v.contains(u, max)) )
+                  {
+                     minimal = false;
+                     break;
+                  }
+               }
+            }
+            if ( minimal )
+            {
+               survivors[b].push_back(&pnr);
+            }
+         }
+      });
+      PNRs<Bitset> pnrs;
+      for ( const auto& block : survivors )
+      {
+         for ( const auto pnr : makeReverseRange(block) )
+         {
+            pnrs.push_front(*pnr);
+         }
+      }
+      return pnrs;
+   }
+
    template <typename Bitset, typename Integer>
-   void projection(Matrix<Integer>& matrix, std::vector<Bitset>& R, const Vertex<Integer>& vertex, const Index index)
+   void projection(DenseMatrix<Integer>& matrix, std::vector<Bitset>& R, const Vertex<Integer>& vertex, const Index index, const std::size_t threads)
    {
       assert( !matrix.empty() );
       const auto d = vertex.size();
-      assert( matrix.back().size() == d );
+      assert( matrix.columns() == d );
       assert( index >= d );
       const auto max_count = index + 2 - d;
       auto s = matrix * vertex;
@@ -294,24 +393,36 @@ namespace
       const auto& indices_negative = std::get<0>(indices);
       const auto& indices_zero = std::get<1>(indices);
       const auto& indices_positive = std::get<2>(indices);
-      std::forward_list<std::tuple<Index, Index, Bitset>> pnrs;
-      for ( const auto& index_n : indices_negative )
-      {
-         const auto& Rn = R[index_n];
-         for ( const auto& index_p : indices_positive )
+      const SubsetIndex<Bitset> zero_sets(R, indices_zero, index);
+      // each block of consecutive negative rows gets its own list of pairs, which are merged afterwards.
+      const auto work = indices_negative.size() * indices_positive.size();
+      const auto block_count = ( work < minimum_parallel_work ) ? std::size_t{1} : std::max(std::min(threads, indices_negative.size()), std::size_t{1});
+      std::vector<PNRs<Bitset>> blocks(block_count);
+      parallelFor(block_count, threads, [&](const std::size_t b)
+      {
+         auto& pnrs = blocks[b];
+         const auto first = b * indices_negative.size() / block_count;
+         const auto last = (b + 1) * indices_negative.size() / block_count;
+         for ( auto n = first; n < last; ++n )
          {
-            const auto& Rp = R[index_p];
-            if ( countCheck(Rn, Rp, max_count, index) )
+            const auto& index_n = indices_negative[n];
+            const auto& Rn = R[index_n];
+            for ( const auto& index_p : indices_positive )
             {
-               if ( containmentCheck(Rn, Rp, index, R, indices_zero) )
+               const auto& Rp = R[index_p];
+               if ( countCheck(Rn, Rp, max_count, index) )
                {
-                  const auto u = Rn.merge(Rp, index);
-                  pnrIteration(pnrs, index_n, index_p, u, index);
+                  if ( containmentCheck(Rn, Rp, zero_sets) )
+                  {
+                     const auto u = Rn.merge(Rp, index);
+                     pnrIteration(pnrs, index_n, index_p, u, index);
+                  }
                }
             }
          }
-      }
-      std::tie(matrix, R) = updateSystem(matrix, R, index, indices, s, pnrs);
+      });
+      const auto pnrs = ( block_count == 1 ) ? std::move(blocks.front()) : mergeMinimal(blocks, index, threads);
+      std::tie(matrix, R) = updateSystem(matrix, R, index, indices, s, pnrs, threads);
    }
 
    template <typename Integer>
@@ -333,21 +444,30 @@ namespace
    }
 
    template <typename Bitset, typename Integer>
-   void phaseTwo(Matrix<Integer>& matrix, const Vertices<Integer>& vertices)
+   void phaseTwo(Matrix<Integer>& matrix, const Vertices<Integer>& vertices, const std::size_t threads, const InsertionOrder order)
    {
       assert( !matrix.empty() );
       const auto d = matrix.back().size();
       auto R = initializeR<Bitset>(matrix, vertices);
       assert( d <= vertices.size() );
+      // every projection scans the whole system, which is therefore kept in contiguous memory.
+      DenseMatrix<Integer> system(matrix);
+      // bit i of the bitsets refers to the i-th inserted vertex, which is vertices[sequence[i]].
+      auto sequence = insertionSequence(vertices, d, order);
       for ( std::size_t i = d; i < vertices.size(); ++i )
       {
-         const auto& vertex = vertices[i];
+         if ( order == InsertionOrder::MinCutoff )
+         {
+            selectMinCutoff(system, vertices, sequence, i, threads);
+         }
+         const auto& vertex = vertices[sequence[i]];
          auto action = makeDelayedAction([&]()
          {
-            std::cerr << "Fourier-Motzkin Elimination step " << i + 1 << " / " << vertices.size() << ": " << matrix.size() << '\n';
+            std::cerr << "Fourier-Motzkin Elimination step " << i + 1 << " / " << vertices.size() << ": " << system.rows() << '\n';
          }, std::chrono::seconds(2));
-         projection(matrix, R, vertex, i);
+         projection(system, R, vertex, i, threads);
       }
+      matrix = system.toMatrix();
       detectBadRow(matrix);
    }
 
@@ -357,17 +477,80 @@ namespace
       const auto d = matrix.size();
       auto R = initializeR<Bitset>(matrix, vertices);
       assert( d <= vertices.size() );
+      DenseMatrix<Integer> system(matrix);
       for ( std::size_t i = d; i < vertices.size(); ++i )
       {
-         auto facets = extractFacets(matrix, vertices, i);
+         auto facets = extractFacets(system, vertices, i);
          detectBadRow(facets);
          if ( !facets.empty() )
          {
             matrix = facets;
+            return;
+         }
+         projection(system, R, vertices[i], i, 1);
+      }
+      matrix = system.toMatrix();
+   }
+
+   template <typename Integer>
+   Indices insertionSequence(const Vertices<Integer>& vertices, const std::size_t d, const InsertionOrder order)
+   {
+      Indices sequence(vertices.size());
+      std::iota(sequence.begin(), sequence.end(), 0);
+      const auto first = sequence.begin() + static_cast<Indices::difference_type>(d);
+      switch ( order )
+      {
+         case InsertionOrder::MinIndex:
+         case InsertionOrder::MinCutoff:
+         {
+            break;
+         }
+         case InsertionOrder::MaxIndex:
+         {
+            std::reverse(first, sequence.end());
+            break;
+         }
+         case InsertionOrder::LexMin:
+         {
+            std::stable_sort(first, sequence.end(), [&vertices](const Index a, const Index b)
+            {
+               return vertices[a] < vertices[b];
+            });
+            break;
+         }
+         case InsertionOrder::Random:
+         {
+            // a default constructed engine has a fixed seed, so every run inserts in the same order.
+            std::mt19937 generator;
+            std::shuffle(first, sequence.end(), generator);
             break;
          }
-         projection(matrix, R, vertices[i], i);
       }
+      return sequence;
+   }
+
+   template <typename Integer>
+   void selectMinCutoff(const DenseMatrix<Integer>& matrix, const Vertices<Integer>& vertices, Indices& sequence, const std::size_t position, const std::size_t threads)
+   {
+      // rows with a positive product are violated by the vertex and removed in its projection.
+      const auto remaining = sequence.size() - position;
+      std::vector<std::size_t> cutoffs(remaining);
+      const auto work = matrix.rows() * remaining;
+      parallelFor(remaining, ( work < minimum_parallel_work ) ? std::size_t{1} : threads, [&](const std::size_t k)
+      {
+         const auto& vertex = vertices[sequence[position + k]];
+         std::size_t count = 0;
+         for ( std::size_t j = 0; j < matrix.rows(); ++j )
+         {
+            if ( scalarProduct(matrix, j, vertex) > 0 )
+            {
+               ++count;
+            }
+         }
+         cutoffs[k] = count;
+      });
+      const auto best = std::min_element(cutoffs.cbegin(), cutoffs.cend()) - cutoffs.cbegin();
+      std::swap(sequence[position], sequence[position + static_cast<std::size_t>(best)]);
    }
 
    template <typename Integer>
@@ -405,44 +588,76 @@ namespace
    }
 
    template <typename Bitset, typename Integer>
-   std::pair<Matrix<Integer>, std::vector<Bitset>> updateSystem(
-      const Matrix<Integer>& matrix,
+   std::pair<DenseMatrix<Integer>, std::vector<Bitset>> updateSystem(
+      const DenseMatrix<Integer>& matrix,
       const std::vector<Bitset>& R,
       const Index i,
       const std::tuple<Indices, Indices, Indices>& indices,
       const Row<Integer>& s,
-      const std::forward_list<std::tuple<Index, Index, Bitset>>& pnrs)
+      const PNRs<Bitset>& pnrs,
+      const std::size_t threads)
    {
       const auto& indices_negative = std::get<0>(indices);
       const auto& indices_zero = std::get<1>(indices);
-      Matrix<Integer> new_matrix;
+      std::vector<const std::tuple<Index, Index, Bitset>*> combinations;
+      for ( const auto& pnr : pnrs )
+      {
+         combinations.push_back(&pnr);
+      }
+      const auto columns = matrix.columns();
+      DenseMatrix<Integer> new_matrix(indices_negative.size() + indices_zero.size() + combinations.size(), columns);
       std::vector<Bitset> new_R;
-      new_matrix.reserve(indices_negative.size() + indices_zero.size());
-      new_R.reserve(indices_negative.size() + indices_zero.size());
+      new_R.reserve(new_matrix.rows());
+      std::size_t offset = 0;
       for ( const auto index_z : indices_zero )
       {
-         new_matrix.push_back(matrix[index_z]);
+         std::copy(matrix.data(index_z), matrix.data(index_z) + columns, new_matrix.data(offset++));
          new_R.push_back(R[index_z]);
       }
       for ( const auto index_n : indices_negative )
       {
-         new_matrix.push_back(matrix[index_n]);
+         std::copy(matrix.data(index_n), matrix.data(index_n) + columns, new_matrix.data(offset++));
          new_R.push_back(R[index_n]);
          new_R.back().set(i);
       }
-      for ( const auto& pnr : pnrs )
+      // the new rows are written to their final positions, so any thread may compute any of them.
+      const auto combine = [&](const std::size_t k)
       {
+         const auto& pnr = *combinations[k];
          const auto& index_n = std::get<0>(pnr);
          const auto& index_p = std::get<1>(pnr);
-         new_matrix.push_back(s[index_p] * matrix[index_n] - s[index_n] * matrix[index_p]);
-         const auto gcd_value = algorithm::gcd(new_matrix.back());
+         const auto row_n = matrix.data(index_n);
+         const auto row_p = matrix.data(index_p);
+         const auto row = new_matrix.data(offset + k);
+         Integer gcd_value(0);
+         for ( std::size_t c = 0; c < columns; ++c )
+         {
+            row[c] = s[index_p] * row_n[c] - s[index_n] * row_p[c];
+            if ( gcd_value != 1 )
+            {
+               gcd_value = algorithm::gcd(row[c], gcd_value);
+            }
+         }
+         assert( gcd_value != 0 );
          if ( gcd_value > 1 )
          {
-            new_matrix.back() /= gcd_value;
+            std::for_each(row, row + columns, [&gcd_value](Integer& value) { value /= gcd_value; });
          }
-         new_R.push_back(std::get<2>(pnr));
+      };
+      parallelFor(combinations.size(), ( combinations.size() < minimum_parallel_work ) ? std::size_t{1} : threads, combine);
+      for ( const auto pnr : combinations )
+      {
+         new_R.push_back(std::get<2>(*pnr));
       }
-      return std::make_pair(new_matrix, new_R);
+      return std::make_pair(std::move(new_matrix), std::move(new_R));
+   }
+
+   template <typename Integer>
+   Integer scalarProduct(const DenseMatrix<Integer>& matrix, const Index j, const Vertex<Integer>& vertex)
+   {
+      assert( matrix.columns() == vertex.size() );
+      const auto row = matrix.data(j);
+      return std::inner_product(row, row + matrix.columns(), vertex.cbegin(), Integer(0));
    }
 
    template <typename Bitset>
@@ -10,6 +10,7 @@
 #include <tuple>
 #include <vector>
 
+#include "insertion_order.h"
 #include "matrix.h"
 #include "row.h"
 
@@ -22,6 +23,10 @@ namespace panda
       /// extremal vertices/rays is returned.
       template <typename Integer>
       Matrix<Integer> fourierMotzkinElimination(Matrix<Integer>);
+      /// Same as above, using the given number of threads and inserting the rows in the given order.
+      /// The result doesn't depend on the number of threads.
+      template <typename Integer>
+      Matrix<Integer> fourierMotzkinElimination(Matrix<Integer>, const std::size_t, const InsertionOrder);
       /// Heuristic using Fourier-Motzkin elimination to identify some facets.
       /// Output is guaranteed to contain only facets, but it is highly likely
       /// that it is not the complete set of facets.
@@ -13,6 +13,9 @@
 #include <functional>
 #include <numeric>
 
+#include "distance_kernels.h"
+#include "safe_integer.h"
+
 using namespace panda;
 
 namespace
@@ -20,6 +23,55 @@ namespace
    /// Calculates the scalar product of the left hand side coefficients of an inequality with a vertex.
    template <typename Integer>
    Integer scalarProduct(const Inequality<Integer>&, const Vertex<Integer>&) noexcept;
+   /// Calculates the distance of the i-th vertex.
+   template <typename Integer>
+   Integer rowDistance(const DenseMatrix<Integer>&, const std::size_t, const Inequality<Integer>&);
+   /// The specializations for SafeInteger check for overflow once per scalar product.
+   template <>
+   SafeInteger scalarProduct(const Inequality<SafeInteger>& inequality, const Vertex<SafeInteger>& vertex) noexcept
+   {
+      assert( inequality.size() == vertex.size() );
+      return SafeInteger::scalarProduct(vertex.data(), vertex.data() + vertex.size(), inequality.data());
+   }
+   template <>
+   SafeInteger rowDistance(const DenseMatrix<SafeInteger>& vertices, const std::size_t i, const Inequality<SafeInteger>& inequality)
+   {
+      const auto vertex = vertices.data(i);
+      return -SafeInteger::scalarProduct(vertex, vertex + vertices.columns(), inequality.data());
+   }
+   /// Finds the vertices with smallest and largest scalar product with the vectorized kernels.
+   /// Returns false if there is no kernel for the integer type or if the kernel detects an overflow.
+   template <typename Integer>
+   bool extremalRows(const DenseMatrix<Integer>&, const Inequality<Integer>&, algorithm::ExtremalRows&) noexcept
+   {
+      return false;
+   }
+   template <>
+   bool extremalRows(const DenseMatrix<int32_t>& vertices, const Inequality<int32_t>& inequality, algorithm::ExtremalRows& rows) noexcept
+   {
+      return algorithm::extremalScalarProducts(vertices.data(0), vertices.rows(), vertices.columns(), vertices.stride(), inequality.data(), rows);
+   }
+   template <>
+   bool extremalRows(const DenseMatrix<int64_t>& vertices, const Inequality<int64_t>& inequality, algorithm::ExtremalRows& rows) noexcept
+   {
+      return algorithm::extremalScalarProducts(vertices.data(0), vertices.rows(), vertices.columns(), vertices.stride(), inequality.data(), rows);
+   }
+   /// Finds the vertices with distance zero with the vectorized kernels, same restrictions as above.
+   template <typename Integer>
+   bool zeroRows(const DenseMatrix<Integer>&, const Inequality<Integer>&, std::vector<std::size_t>&)
+   {
+      return false;
+   }
+   template <>
+   bool zeroRows(const DenseMatrix<int32_t>& vertices, const Inequality<int32_t>& inequality, std::vector<std::size_t>& indices)
+   {
+      return algorithm::zeroScalarProducts(vertices.data(0), vertices.rows(), vertices.columns(), vertices.stride(), inequality.data(), indices);
+   }
+   template <>
+   bool zeroRows(const DenseMatrix<int64_t>& vertices, const Inequality<int64_t>& inequality, std::vector<std::size_t>& indices)
+   {
+      return algorithm::zeroScalarProducts(vertices.data(0), vertices.rows(), vertices.columns(), vertices.stride(), inequality.data(), indices);
+   }
 }
 
 template <typename Integer>
@@ -55,6 +107,31 @@ namespace
       }
       return *best_vertex;
    }
+
+   template <typename Integer, typename Comparator>
+   Vertex<Integer> extremalVertex(const DenseMatrix<Integer>& vertices, const Inequality<Integer>& inequality, Comparator&& comparator)
+   {
+      assert( !vertices.empty() && vertices.columns() == inequality.size() );
+      algorithm::ExtremalRows rows;
+      if ( extremalRows(vertices, inequality, rows) )
+      {
+         // the row with the smallest product has the largest distance and vice versa.
+         const auto better = comparator(rowDistance(vertices, rows.maximum, inequality), rowDistance(vertices, rows.minimum, inequality));
+         return vertices[better ? rows.maximum : rows.minimum].toRow();
+      }
+      auto extremum = rowDistance(vertices, 0, inequality);
+      std::size_t best_vertex = 0;
+      for ( std::size_t i = 1; i < vertices.rows(); ++i )
+      {
+         const auto d = rowDistance(vertices, i, inequality);
+         if ( comparator(d, extremum) )
+         {
+            best_vertex = i;
+            extremum = d;
+         }
+      }
+      return vertices[best_vertex].toRow();
+   }
 }
 
 template <typename Integer>
@@ -69,6 +146,37 @@ Vertex<Integer> algorithm::nearestVertex(const Vertices<Integer>& vertices, cons
    return extremalVertex(vertices, inequality, std::less<Integer>{});
 }
 
+template <typename Integer>
+Vertex<Integer> algorithm::furthestVertex(const DenseMatrix<Integer>& vertices, const Inequality<Integer>& inequality)
+{
+   return extremalVertex(vertices, inequality, std::greater<Integer>{});
+}
+
+template <typename Integer>
+Vertex<Integer> algorithm::nearestVertex(const DenseMatrix<Integer>& vertices, const Inequality<Integer>& inequality)
+{
+   return extremalVertex(vertices, inequality, std::less<Integer>{});
+}
+
+template <typename Integer>
+std::vector<std::size_t> algorithm::incidence(const DenseMatrix<Integer>& vertices, const Inequality<Integer>& inequality)
+{
+   assert( vertices.empty() || vertices.columns() == inequality.size() );
+   std::vector<std::size_t> indices;
+   if ( vertices.empty() || zeroRows(vertices, inequality, indices) )
+   {
+      return indices;
+   }
+   for ( std::size_t i = 0; i < vertices.rows(); ++i )
+   {
+      if ( rowDistance(vertices, i, inequality) == 0 )
+      {
+         indices.push_back(i);
+      }
+   }
+   return indices;
+}
+
 namespace
 {
    template <typename Integer>
@@ -77,5 +185,12 @@ namespace
       assert( inequality.size() == vertex.size() );
       return std::inner_product(vertex.cbegin(), vertex.cend(), inequality.cbegin(), Integer{0});
    }
+
+   template <typename Integer>
+   Integer rowDistance(const DenseMatrix<Integer>& vertices, const std::size_t i, const Inequality<Integer>& inequality)
+   {
+      const auto vertex = vertices.data(i);
+      return -std::inner_product(vertex, vertex + vertices.columns(), inequality.cbegin(), Integer{0});
+   }
 }
 
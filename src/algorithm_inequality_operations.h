@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include "dense_matrix.h"
 #include "matrix.h"
 #include "row.h"
 
@@ -26,6 +30,15 @@ namespace panda
       /// returns a vertex that minimizes the distance function.
       template <typename Integer>
       Vertex<Integer> nearestVertex(const Vertices<Integer>&, const Inequality<Integer>&);
+      /// returns a vertex that maximizes the distance function.
+      template <typename Integer>
+      Vertex<Integer> furthestVertex(const DenseMatrix<Integer>&, const Inequality<Integer>&);
+      /// returns a vertex that minimizes the distance function.
+      template <typename Integer>
+      Vertex<Integer> nearestVertex(const DenseMatrix<Integer>&, const Inequality<Integer>&);
+      /// returns the indices of the vertices with distance zero (the vertices on the face defined by an inequality).
+      template <typename Integer>
+      std::vector<std::size_t> incidence(const DenseMatrix<Integer>&, const Inequality<Integer>&);
    }
 }
 
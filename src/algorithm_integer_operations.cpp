@@ -25,6 +25,7 @@ template <typename Integer>
 Integer panda::algorithm::gcd(Integer a, Integer b) noexcept
 {
    using std::abs;
+   using algorithm::abs;
    return unsigned_gcd(static_cast<Integer>(abs(a)), static_cast<Integer>(abs(b)));
 }
 
@@ -33,6 +34,7 @@ Integer panda::algorithm::lcm(Integer a, Integer b) noexcept
 {
    const auto gcd_value = gcd(a, b);
    using std::abs;
+   using algorithm::abs;
    return static_cast<Integer>(abs(a) * static_cast<Integer>(abs(b) / gcd_value));
 }
 
@@ -41,6 +43,13 @@ short panda::algorithm::abs(const short n)
    return (n < 0) ? -n : n;
 }
 
+#ifdef __SIZEOF_INT128__
+panda::int128_t panda::algorithm::abs(const int128_t n) noexcept
+{
+   return (n < 0) ? -n : n;
+}
+#endif
+
 namespace
 {
    template <typename Integer>
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "int128.h"
+
 namespace panda
 {
    namespace algorithm
@@ -18,6 +20,10 @@ namespace panda
       Integer lcm(Integer, Integer) noexcept;
       /// overload for short, as the standard library lacks this one.
       short abs(const short);
+      #ifdef __SIZEOF_INT128__
+      /// overload for int128_t, as the standard library lacks this one in strict ISO mode.
+      int128_t abs(const int128_t) noexcept;
+      #endif
    }
 }
 
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <iterator>
 
 #include "algorithm_row_operations.h"
 
@@ -21,6 +22,11 @@ namespace
    /// Normalize a single map using equations.
    template <typename Integer>
    Map normalizeMap(Map, const Equations<Integer>&);
+   /// Returns the kind of a map. Only (signed) permutations need the gather of a compiled map.
+   MapKind kind(const Map&);
+   /// Returns the row divided by the common divisor of its entries.
+   template <typename Integer>
+   Row<Integer> withoutCommonDivisor(Row<Integer>);
    /// Output a single term in an image of a map.
    std::ostream& operator<<(std::ostream&, const Term&);
    /// Output a single image in a map.
@@ -77,6 +83,155 @@ Row<Integer> algorithm::apply(const Map& map, const Row<Integer>& row, TagType t
    return result;
 }
 
+CompiledMap algorithm::compile(const Map& map, tag::facet)
+{
+   CompiledMap result{kind(map), {}, {}, {}};
+   if ( result.kind == MapKind::General )
+   {
+      result.map = map;
+      return result;
+   }
+   // facets are mapped by the transposed map: the coefficient of i becomes the coefficient of its image.
+   result.indices.resize(map.size());
+   result.signs.resize(map.size());
+   for ( std::size_t i = 0; i < map.size(); ++i )
+   {
+      const auto& term = map[i].front();
+      result.indices[term.first] = i;
+      result.signs[term.first] = term.second;
+   }
+   return result;
+}
+
+CompiledMap algorithm::compile(const Map& map, tag::vertex)
+{
+   CompiledMap result{kind(map), {}, {}, {}};
+   if ( result.kind == MapKind::General )
+   {
+      result.map = map;
+      return result;
+   }
+   result.indices.resize(map.size());
+   result.signs.resize(map.size());
+   for ( std::size_t i = 0; i < map.size(); ++i )
+   {
+      const auto& term = map[i].front();
+      result.indices[i] = term.first;
+      result.signs[i] = term.second;
+   }
+   return result;
+}
+
+template <typename TagType>
+CompiledMaps algorithm::compile(const Maps& maps, TagType tag)
+{
+   CompiledMaps result;
+   result.reserve(maps.size());
+   for ( const auto& map : maps )
+   {
+      result.push_back(compile(map, tag));
+   }
+   return result;
+}
+
+template CompiledMaps algorithm::compile(const Maps&, tag::facet);
+template CompiledMaps algorithm::compile(const Maps&, tag::vertex);
+
+template <typename Integer, typename TagType>
+Row<Integer> algorithm::apply(const CompiledMap& map, const Row<Integer>& row, TagType tag)
+{
+   switch ( map.kind )
+   {
+      case MapKind::Permutation:
+      {
+         assert( row.size() == map.indices.size() );
+         Row<Integer> result;
+         result.reserve(row.size());
+         for ( const auto index : map.indices )
+         {
+            result.push_back(row[index]);
+         }
+         return result;
+      }
+      case MapKind::SignedPermutation:
+      {
+         assert( row.size() == map.indices.size() );
+         Row<Integer> result;
+         result.reserve(row.size());
+         for ( std::size_t i = 0; i < map.indices.size(); ++i )
+         {
+            result.push_back(map.signs[i] < 0 ? -row[map.indices[i]] : row[map.indices[i]]);
+         }
+         return result;
+      }
+      default:
+         return apply(map.map, row, tag);
+   }
+}
+
+template <typename Integer, typename TagType>
+Maps algorithm::stabilizer(const Maps& maps, const Row<Integer>& row, TagType tag)
+{
+   // apply returns rows without common divisor, hence, the row is compared in the same form.
+   const auto normalized = withoutCommonDivisor(row);
+   Maps result;
+   std::copy_if(maps.cbegin(), maps.cend(), std::back_inserter(result), [&](const Map& map)
+   {
+      return apply(map, normalized, tag) == normalized;
+   });
+   return result;
+}
+
+template <typename Integer, typename TagType>
+CompiledMaps algorithm::stabilizer(const CompiledMaps& maps, const Row<Integer>& row, TagType tag)
+{
+   // compiled permutations keep a common divisor, the row doesn't have one, so all images are comparable.
+   const auto normalized = withoutCommonDivisor(row);
+   CompiledMaps result;
+   std::copy_if(maps.cbegin(), maps.cend(), std::back_inserter(result), [&](const CompiledMap& map)
+   {
+      return apply(map, normalized, tag) == normalized;
+   });
+   return result;
+}
+
+namespace
+{
+   template <typename Integer>
+   Row<Integer> withoutCommonDivisor(Row<Integer> row)
+   {
+      const auto gcd_value = algorithm::gcd(row);
+      if ( gcd_value > 1 )
+      {
+         row /= gcd_value;
+      }
+      return row;
+   }
+
+   MapKind kind(const Map& map)
+   {
+      auto result = MapKind::Permutation;
+      std::vector<bool> hit(map.size(), false);
+      for ( const auto& image : map )
+      {
+         if ( image.size() != 1 || image.front().first >= map.size() || hit[image.front().first] )
+         {
+            return MapKind::General;
+         }
+         hit[image.front().first] = true;
+         if ( image.front().second == -1 )
+         {
+            result = MapKind::SignedPermutation;
+         }
+         else if ( image.front().second != 1 )
+         {
+            return MapKind::General;
+         }
+      }
+      return result;
+   }
+}
+
 std::ostream& operator<<(std::ostream& stream, const panda::Map& map)
 {
    stream << '[';
@@ -8,6 +8,7 @@
 
 #include <iosfwd>
 
+#include "compiled_map.h"
 #include "maps.h"
 #include "matrix.h"
 #include "tags.h"
@@ -22,6 +23,24 @@ namespace panda
       /// Applies a Map onto a row.
       template <typename Integer, typename TagType>
       Row<Integer> apply(const Map&, const Row<Integer>&, TagType);
+      /// Classifies a map and prepares it for application onto rows of the given type (facets / vertices).
+      CompiledMap compile(const Map&, tag::facet);
+      /// Classifies a map and prepares it for application onto rows of the given type (facets / vertices).
+      CompiledMap compile(const Map&, tag::vertex);
+      /// Compiles all maps.
+      template <typename TagType>
+      CompiledMaps compile(const Maps&, TagType);
+      /// Applies a compiled map onto a row. The tag has to be the same as for compile.
+      /// (Signed) permutations don't change the common divisor of the entries, hence, the result
+      /// is the same as for the map itself only if the row doesn't have a common divisor.
+      template <typename Integer, typename TagType>
+      Row<Integer> apply(const CompiledMap&, const Row<Integer>&, TagType);
+      /// Returns the maps that map a row onto itself. They generate a subgroup of the stabiliser of the row.
+      template <typename Integer, typename TagType>
+      Maps stabilizer(const Maps&, const Row<Integer>&, TagType);
+      /// Same as above with maps compiled for the tag.
+      template <typename Integer, typename TagType>
+      CompiledMaps stabilizer(const CompiledMaps&, const Row<Integer>&, TagType);
    }
 }
 
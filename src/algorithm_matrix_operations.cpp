@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <numeric>
 #include <tuple>
 
 #include "algorithm_integer_operations.h"
@@ -49,6 +50,19 @@ Row<Integer> operator*(const Matrix<Integer>& matrix, const Row<Integer>& vector
    return result;
 }
 
+template <typename Integer>
+Row<Integer> operator*(const DenseMatrix<Integer>& matrix, const Row<Integer>& vector)
+{
+   assert( !matrix.empty() && matrix.columns() == vector.size() );
+   Row<Integer> result(matrix.rows());
+   for ( std::size_t i = 0; i < matrix.rows(); ++i )
+   {
+      const auto row = matrix.data(i);
+      result[i] = std::inner_product(vector.cbegin(), vector.cend(), row, Integer{0});
+   }
+   return result;
+}
+
 template <typename Integer>
 Matrix<Integer> algorithm::transpose(const Matrix<Integer>& matrix)
 {
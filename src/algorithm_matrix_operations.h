@@ -10,6 +10,7 @@
 #include <iosfwd>
 #include <vector>
 
+#include "dense_matrix.h"
 #include "matrix.h"
 #include "names.h"
 #include "row.h"
@@ -20,6 +21,9 @@ std::ostream& operator<<(std::ostream&, const panda::Matrix<Integer>&);
 /// Matrix-vector product.
 template <typename Integer>
 panda::Row<Integer> operator*(const panda::Matrix<Integer>&, const panda::Row<Integer>&);
+/// Matrix-vector product.
+template <typename Integer>
+panda::Row<Integer> operator*(const panda::DenseMatrix<Integer>&, const panda::Row<Integer>&);
 
 namespace panda
 {
@@ -9,14 +9,22 @@
 #undef COMPILE_TEMPLATE_ALGORITHM_ROTATION
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <iostream>
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
 
 #include "algorithm_classes.h"
 #include "algorithm_fourier_motzkin_elimination.h"
 #include "algorithm_inequality_operations.h"
 #include "algorithm_integer_operations.h"
+#include "algorithm_map_operations.h"
 #include "algorithm_row_operations.h"
+#include "dense_matrix.h"
+#include "permutation_group.h"
 
 
 using namespace panda;
@@ -25,62 +33,84 @@ namespace
 {
    /// Rotates a facet around a ridge. It's the exact same algorithm as for vertices.
    template <typename Integer>
-   Facet<Integer> rotate(const Vertices<Integer>&, Vertex<Integer>, const Facet<Integer>&, Facet<Integer>);
-   /// Returns all ridges on a facet (equivalent to all facets of the facet).
+   Facet<Integer> rotate(const DenseMatrix<Integer>&, Vertex<Integer>, const Facet<Integer>&, Facet<Integer>);
+   /// Rotates a facet around all given ridges, using the given number of threads (the caller and helpers of the pool).
    template <typename Integer>
-   Inequalities<Integer> getRidges(const Vertices<Integer>&, const Facet<Integer>&);
+   std::set<Row<Integer>> rotateAll(const DenseMatrix<Integer>&, const Vertex<Integer>&, const Facet<Integer>&, const Inequalities<Integer>&, const HelperPool&, const std::size_t);
+   /// Returns all ridges on a facet (equivalent to all facets of the facet).
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> getRidges(const DenseMatrix<Integer>&, const Facet<Integer>&, const Symmetries<Integer, TagType>&, const Recursion&, TagType);
+   /// Implementation of algorithm::ridges for vertices in contiguous memory.
+   /// The group has to be generated by the maps, or nullptr if they aren't signed permutations.
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> ridgesOfFacet(const DenseMatrix<Integer>&, const Facet<Integer>&, const CompiledMaps&, const PermutationGroup*, const Recursion&, TagType);
+   /// Returns generators of the maps that fix the facet, the whole stabiliser if the group is given.
+   template <typename Integer, typename TagType>
+   CompiledMaps stabilizer(const CompiledMaps&, const PermutationGroup*, const Facet<Integer>&, TagType);
+   /// Adjacency decomposition of the convex hull of the vertices (which may be lower dimensional).
+   /// Returns one facet of each class under the maps.
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> decomposition(const Vertices<Integer>&, const CompiledMaps&, const Recursion&, TagType);
+   /// Returns the smallest incidence (see algorithm::incidence) of all faces in the class of a face.
+   /// Different inequalities may define the same face of a lower dimensional polytope, but the incidence is unique.
+   template <typename Integer, typename TagType>
+   std::vector<std::size_t> classIncidence(const DenseMatrix<Integer>&, const Inequality<Integer>&, const CompiledMaps&, TagType);
    /// Returns all vertices that lie on the facet (satisfy the inequality with equality).
    template <typename Integer>
-   Vertices<Integer> verticesWithZeroDistance(const Vertices<Integer>&, const Facet<Integer>&);
+   Vertices<Integer> verticesWithZeroDistance(const DenseMatrix<Integer>&, const Facet<Integer>&);
 }
 
 template <typename Integer, typename TagType>
-Matrix<Integer> panda::algorithm::rotation(const Matrix<Integer>& matrix,
+Matrix<Integer> panda::algorithm::rotation(const DenseMatrix<Integer>& vertices,
                                     const Row<Integer>& input,
-                                    const Maps& maps,
+                                    const Symmetries<Integer, TagType>& symmetries,
+                                    const HelperPool& helpers,
+                                    const std::size_t parallelism,
+                                    const Recursion& recursion,
                                     TagType tag)
 {
    // as the first step of the rotation, the furthest Vertex w.r.t. the input facet is calculated.
    // this will be the same vertex for all neighbouring ridges, hence, only needs to be computed once.
-   const auto furthest_vertex = furthestVertex(matrix, input);
-   const auto ridges = getRidges(matrix, input);
-   std::set<Row<Integer>> output;
-   for ( const auto& ridge : ridges )
-   {
-      const auto new_row = rotate(matrix, furthest_vertex, input, ridge);
-      output.insert(new_row);
-   }
-   return classes(output, maps, tag);
+   const auto furthest_vertex = furthestVertex(vertices, input);
+   const auto ridges = getRidges(vertices, input, symmetries, recursion, tag);
+   const auto output = rotateAll(vertices, furthest_vertex, input, ridges, helpers, parallelism);
+   return classes(output, symmetries, tag);
 }
 
 template <typename Integer, typename TagType>
-Matrix<Integer> panda::algorithm::rotationDeterministic(const Matrix<Integer>& matrix,
+Matrix<Integer> panda::algorithm::rotationDeterministic(const DenseMatrix<Integer>& vertices,
                                            const Row<Integer>& input,
-                                           const Maps& maps,
+                                           const Symmetries<Integer, TagType>& symmetries,
                                            const Matrix<Integer>& deterministics,
+                                           const HelperPool& helpers,
+                                           const std::size_t parallelism,
+                                           const Recursion& recursion,
                                            TagType tag)
 {
    // as the first step of the rotation, the furthest Vertex w.r.t. the input facet is calculated.
    // this will be the same vertex for all neighbouring ridges, hence, only needs to be computed once.
-   const auto furthest_vertex = furthestVertex(matrix, input);
-   const auto ridges = getRidges(matrix, input);
-   std::set<Row<Integer>> output;
-   for ( const auto& ridge : ridges )
-   {
-      const auto new_row = rotate(matrix, furthest_vertex, input, ridge);
-      output.insert(new_row);
-   }
+   const auto furthest_vertex = furthestVertex(vertices, input);
+   const auto ridges = getRidges(vertices, input, symmetries, recursion, tag);
+   const auto output = rotateAll(vertices, furthest_vertex, input, ridges, helpers, parallelism);
    // Calculate the classes using deterministic points
    // TODO: give the input here as well, so we can return none?
    Matrix<Integer> output_matrix(output.begin(), output.end());
    // return output_matrix;
-   return classesDeterministic(output, maps, deterministics, tag);
+   return classesDeterministic(output, symmetries, deterministics, tag);
+}
+
+template <typename Integer, typename TagType>
+Inequalities<Integer> panda::algorithm::ridges(const Vertices<Integer>& vertices, const Facet<Integer>& facet, const Maps& maps, const Recursion& recursion, TagType tag)
+{
+   const auto compiled_maps = compile(maps, tag);
+   const std::unique_ptr<const PermutationGroup> group(PermutationGroup::accepts(maps) ? new PermutationGroup(compiled_maps) : nullptr);
+   return ridgesOfFacet(DenseMatrix<Integer>(vertices), facet, compiled_maps, group.get(), recursion, tag);
 }
 
 namespace
 {
    template <typename Integer>
-   Facet<Integer> rotate(const Vertices<Integer>& vertices, Vertex<Integer> vertex, const Facet<Integer>& facet, Facet<Integer> ridge)
+   Facet<Integer> rotate(const DenseMatrix<Integer>& vertices, Vertex<Integer> vertex, const Facet<Integer>& facet, Facet<Integer> ridge)
    {
       // the calculation of the initial vertex, which has to be the furthest vertex w.r.t. "facet", is calculated outside of this function as it is the same for all rotations.
       auto d_f = algorithm::distance(facet, vertex);
@@ -109,30 +139,157 @@ namespace
    }
 
    template <typename Integer>
-   Inequalities<Integer> getRidges(const Vertices<Integer>& vertices, const Facet<Integer>& facet)
+   std::set<Row<Integer>> rotateAll(const DenseMatrix<Integer>& vertices, const Vertex<Integer>& vertex, const Facet<Integer>& facet, const Inequalities<Integer>& ridges, const HelperPool& helpers, const std::size_t parallelism)
+   {
+      std::set<Row<Integer>> output;
+      const auto thread_count = std::min(parallelism, ridges.size());
+      if ( thread_count <= 1 )
+      {
+         for ( const auto& ridge : ridges )
+         {
+            output.insert(rotate(vertices, vertex, facet, ridge));
+         }
+         return output;
+      }
+      // the ridges are handed out one by one, as the number of steps of a rotation varies a lot.
+      std::vector<Row<Integer>> rotated(ridges.size());
+      std::atomic<std::size_t> next(0);
+      helpers.run([&]()
+      {
+         try
+         {
+            for ( auto i = next++; i < ridges.size(); i = next++ )
+            {
+               rotated[i] = rotate(vertices, vertex, facet, ridges[i]);
+            }
+         }
+         catch ( ... )
+         {
+            // the other threads stop as well, the exception is passed on by the pool.
+            next = ridges.size();
+            throw;
+         }
+      }, thread_count - 1);
+      output.insert(rotated.cbegin(), rotated.cend());
+      return output;
+   }
+
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> getRidges(const DenseMatrix<Integer>& vertices, const Facet<Integer>& facet, const Symmetries<Integer, TagType>& symmetries, const Recursion& recursion, TagType tag)
+   {
+      return ridgesOfFacet(vertices, facet, symmetries.compiled_maps, symmetries.group.get(), recursion, tag);
+   }
+
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> ridgesOfFacet(const DenseMatrix<Integer>& vertices, const Facet<Integer>& facet, const CompiledMaps& maps, const PermutationGroup* group, const Recursion& recursion, TagType tag)
    {
       const auto vertices_on_facet = verticesWithZeroDistance(vertices, facet);
       assert( !vertices_on_facet.empty() );
-      std::cerr << "Vertices on facet \n";
-      for ( auto v : vertices_on_facet)
+      // a single vertex has no facets, there is nothing to decompose.
+      if ( recursion.depth == 0 || vertices_on_facet.size() <= recursion.threshold || vertices_on_facet.size() < 2 )
       {
-         std::cerr << v << "\n";
+         // TODO: Why do we need FourierMotzkinElimination here -> we need facets instead of vertices, so transform V to H representation
+         return algorithm::fourierMotzkinElimination(vertices_on_facet);
+      }
+      // the facets of the facet are equivalent if they are mapped onto each other by maps that keep the facet in place.
+      const Recursion next{recursion.threshold, recursion.depth - 1};
+      return decomposition(vertices_on_facet, stabilizer(maps, group, facet, tag), next, tag);
+   }
 
+   template <typename Integer, typename TagType>
+   CompiledMaps stabilizer(const CompiledMaps& maps, const PermutationGroup* group, const Facet<Integer>& facet, TagType tag)
+   {
+      if ( group == nullptr )
+      {
+         // general maps: only the maps that fix the facet themselves are known to be in the stabiliser.
+         return algorithm::stabilizer(maps, facet, tag);
+      }
+      // the group compares rows without common divisor (like the maps that are applied).
+      auto normalized = facet;
+      const auto gcd_value = algorithm::gcd(normalized);
+      if ( gcd_value > 1 )
+      {
+         normalized /= gcd_value;
       }
-      std::cerr << "Stopping PANDA algorithm \n";
-      exit(0);
-      // TODO: Why do we need FourierMotzkinElimination here -> we need facets instead of vertices, so transform V to H representation
-      return algorithm::fourierMotzkinElimination(vertices_on_facet);
+      return group->stabilizer(normalized);
+   }
+
+   template <typename Integer, typename TagType>
+   Inequalities<Integer> decomposition(const Vertices<Integer>& vertices, const CompiledMaps& maps, const Recursion& recursion, TagType tag)
+   {
+      std::set<std::vector<std::size_t>> known;
+      Inequalities<Integer> result;
+      const DenseMatrix<Integer> dense(vertices);
+      // the stabiliser of a facet of the facet is found in the group generated by the maps of this level.
+      const std::unique_ptr<const PermutationGroup> group(PermutationGroup::signedPermutations(maps) ? new PermutationGroup(maps) : nullptr);
+      std::deque<Inequality<Integer>> jobs;
+      const auto add = [&](const Inequality<Integer>& inequality)
+      {
+         if ( known.insert(classIncidence(dense, inequality, maps, tag)).second )
+         {
+            result.push_back(inequality);
+            jobs.push_back(inequality);
+         }
+      };
+      // the heuristic only returns facets, all of them are used as starting points.
+      for ( const auto& inequality : algorithm::fourierMotzkinEliminationHeuristic(vertices) )
+      {
+         add(inequality);
+      }
+      if ( jobs.empty() )
+      {
+         const auto facets = algorithm::fourierMotzkinElimination(vertices);
+         if ( facets.empty() )
+         {
+            return result;
+         }
+         add(facets.front());
+      }
+      while ( !jobs.empty() )
+      {
+         const auto inequality = jobs.front();
+         jobs.pop_front();
+         const auto furthest_vertex = algorithm::furthestVertex(dense, inequality);
+         for ( const auto& ridge : ridgesOfFacet(dense, inequality, maps, group.get(), recursion, tag) )
+         {
+            add(rotate(dense, furthest_vertex, inequality, ridge));
+         }
+      }
+      return result;
+   }
+
+   template <typename Integer, typename TagType>
+   std::vector<std::size_t> classIncidence(const DenseMatrix<Integer>& vertices, const Inequality<Integer>& inequality, const CompiledMaps& maps, TagType tag)
+   {
+      // breadth-first search on the faces of the class, each face is represented by one of its inequalities.
+      std::map<std::vector<std::size_t>, Inequality<Integer>> faces;
+      std::deque<const Inequality<Integer>*> todo;
+      todo.push_back(&faces.emplace(algorithm::incidence(vertices, inequality), inequality).first->second);
+      while ( !todo.empty() )
+      {
+         const auto current = todo.front();
+         todo.pop_front();
+         for ( const auto& map : maps )
+         {
+            const auto image = algorithm::apply(map, *current, tag);
+            const auto insertion = faces.emplace(algorithm::incidence(vertices, image), image);
+            if ( insertion.second )
+            {
+               todo.push_back(&insertion.first->second);
+            }
+         }
+      }
+      return faces.cbegin()->first;
    }
 
    template <typename Integer>
-   Vertices<Integer> verticesWithZeroDistance(const Vertices<Integer>& vertices, const Facet<Integer>& facet)
+   Vertices<Integer> verticesWithZeroDistance(const DenseMatrix<Integer>& vertices, const Facet<Integer>& facet)
    {
       Vertices<Integer> selection;
-      std::copy_if(vertices.cbegin(), vertices.cend(), std::back_inserter(selection), [&facet](const Vertex<Integer>& vertex)
+      for ( const auto i : algorithm::incidence(vertices, facet) )
       {
-         return (algorithm::distance(facet, vertex) == 0);
-      });
+         selection.push_back(vertices[i].toRow());
+      }
       return selection;
    }
 }
@@ -6,9 +6,15 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "dense_matrix.h"
+#include "helper_pool.h"
 #include "maps.h"
 #include "matrix.h"
+#include "recursion.h"
 #include "row.h"
+#include "symmetries.h"
 #include "tags.h"
 
 namespace panda
@@ -16,11 +22,23 @@ namespace panda
    namespace algorithm
    {
       /// Returns all adjacent rows (or class representatives) of a row by using the rotation algorithm.
+      /// The vertices are scanned over and over again, hence, they are given in contiguous memory.
+      /// The classes are determined with the symmetries of the problem.
+      /// The ridges are rotated by the given number of threads: the caller and helpers of the pool.
       template <typename Integer, typename TagType>
-      Facets<Integer> rotation(const Vertices<Integer>&, const Facet<Integer>&, const Maps&, TagType);
+      Facets<Integer> rotation(const DenseMatrix<Integer>&, const Facet<Integer>&, const Symmetries<Integer, TagType>&, const HelperPool&, const std::size_t, const Recursion&, TagType);
       /// Returns all adjacent rows by rotation with deterministics
       template <typename Integer, typename TagType>
-      Facets<Integer> rotationDeterministic(const Vertices<Integer>&, const Facet<Integer>&, const Maps&, const Deterministics<Integer>&, TagType);
+      Facets<Integer> rotationDeterministic(const DenseMatrix<Integer>&, const Facet<Integer>&, const Symmetries<Integer, TagType>&, const Deterministics<Integer>&, const HelperPool&, const std::size_t, const Recursion&, TagType);
+      /// Returns the ridges of a facet, i.e. the facets of the convex hull of the vertices on the facet.
+      /// If there are more vertices on the facet than the threshold, the ridges are found by adjacency
+      /// decomposition of the facet, using the stabiliser of the facet. Then, only one ridge of each
+      /// class is returned. If the maps are signed permutations, the whole stabiliser is used
+      /// (see PermutationGroup::stabilizer). Otherwise, only the maps that fix the facet are known,
+      /// which may generate a part of the stabiliser (see algorithm::stabilizer), so a class may be
+      /// represented by several ridges.
+      template <typename Integer, typename TagType>
+      Inequalities<Integer> ridges(const Vertices<Integer>&, const Facet<Integer>&, const Maps&, const Recursion&, TagType);
    }
 }
 
@@ -11,16 +11,61 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <stdexcept>
 
+#include "adaptive_integer.h"
 #include "algorithm_inequality_operations.h"
 #include "algorithm_integer_operations.h"
+#include "big_integer.h"
 #include "cast.h"
+#include "int128.h"
+#include "safe_integer.h"
+#include "safe_integer_128.h"
 
 using namespace panda;
 
+namespace
+{
+   /// Hash value of a single entry of a row.
+   template <typename Integer>
+   std::size_t hashValue(const Integer&) noexcept;
+   /// Hash value of a single entry of a row (arbitrary precision).
+   std::size_t hashValue(const BigInteger&) noexcept;
+   /// Hash value of a single entry of a row (overflow checked).
+   std::size_t hashValue(const SafeInteger&) noexcept;
+   /// Hash value of a single entry of a row (adaptive precision).
+   std::size_t hashValue(const AdaptiveInteger&) noexcept;
+   #ifdef __SIZEOF_INT128__
+   /// Hash value of a single entry of a row (128 bit, as std::hash lacks this one in strict ISO mode).
+   std::size_t hashValue(const int128_t&) noexcept;
+   /// Hash value of a single entry of a row (128 bit, overflow checked).
+   std::size_t hashValue(const SafeInteger128&) noexcept;
+   #endif
+   /// Adds the second row to the first one.
+   template <typename Integer>
+   void add(Row<Integer>&, const Row<Integer>&);
+   /// Same as above, checks for overflow once per row.
+   void add(Row<SafeInteger>&, const Row<SafeInteger>&);
+   /// Subtracts the second row from the first one.
+   template <typename Integer>
+   void subtract(Row<Integer>&, const Row<Integer>&);
+   /// Same as above, checks for overflow once per row.
+   void subtract(Row<SafeInteger>&, const Row<SafeInteger>&);
+   /// Multiplies all entries of a row with a factor.
+   template <typename Integer>
+   void scale(Row<Integer>&, const Integer&);
+   /// Same as above, checks for overflow once per row.
+   void scale(Row<SafeInteger>&, const SafeInteger&);
+   /// Scalar product of two rows.
+   template <typename Integer>
+   Integer scalarProduct(const Row<Integer>&, const Row<Integer>&);
+   /// Same as above, checks for overflow once per row.
+   SafeInteger scalarProduct(const Row<SafeInteger>&, const Row<SafeInteger>&);
+}
+
 template <typename Integer>
 std::ostream& operator<<(std::ostream& output, const Row<Integer>& row)
 {
@@ -134,7 +179,7 @@ template <typename Integer>
 Row<Integer>& operator+=(Row<Integer>& first, const Row<Integer>& second) noexcept
 {
    assert( first.size() == second.size() );
-   std::transform(first.cbegin(), first.cend(), second.cbegin(), first.begin(), std::plus<Integer>());
+   add(first, second);
    return first;
 }
 
@@ -150,7 +195,7 @@ template <typename Integer>
 Row<Integer>& operator-=(Row<Integer>& first, const Row<Integer>& second) noexcept
 {
    assert( first.size() == second.size() );
-   std::transform(first.cbegin(), first.cend(), second.cbegin(), first.begin(), std::minus<Integer>());
+   subtract(first, second);
    return first;
 }
 
@@ -167,10 +212,7 @@ Row<Integer>& operator*=(Row<Integer>& row, const Integer factor) noexcept
 {
    if ( factor != 1 )
    {
-      for ( auto& entry : row )
-      {
-         entry *= factor;
-      }
+      scale(row, factor);
    }
    return row;
 }
@@ -216,7 +258,7 @@ template <typename Integer>
 Integer operator*(const Row<Integer>& first, const Row<Integer>& second) noexcept
 {
    assert( first.size() == second.size() );
-   return std::inner_product(first.cbegin(), first.cend(), second.cbegin(), Integer(0));
+   return scalarProduct(first, second);
 }
 
 template <typename Integer>
@@ -286,3 +328,96 @@ Integer panda::algorithm::lcm(const Row<Integer>& row) noexcept
    return value;
 }
 
+template <typename Integer>
+std::size_t panda::algorithm::hash(const Row<Integer>& row) noexcept
+{
+   std::size_t value = row.size();
+   for ( const auto& entry : row )
+   {
+      value ^= hashValue(entry) + 0x9e3779b9u + (value << 6) + (value >> 2);
+   }
+   return value;
+}
+
+namespace
+{
+   template <typename Integer>
+   std::size_t hashValue(const Integer& value) noexcept
+   {
+      return std::hash<Integer>()(value);
+   }
+
+   std::size_t hashValue(const BigInteger& value) noexcept
+   {
+      return panda::hash(value);
+   }
+
+   std::size_t hashValue(const SafeInteger& value) noexcept
+   {
+      return panda::hash(value);
+   }
+
+   std::size_t hashValue(const AdaptiveInteger& value) noexcept
+   {
+      return panda::hash(value);
+   }
+
+   #ifdef __SIZEOF_INT128__
+   std::size_t hashValue(const int128_t& value) noexcept
+   {
+      const auto bits = static_cast<uint128_t>(value);
+      return std::hash<uint64_t>()(static_cast<uint64_t>(bits)) ^ (std::hash<uint64_t>()(static_cast<uint64_t>(bits >> 64)) * 31);
+   }
+
+   std::size_t hashValue(const SafeInteger128& value) noexcept
+   {
+      return panda::hash(value);
+   }
+   #endif
+   template <typename Integer>
+   void add(Row<Integer>& first, const Row<Integer>& second)
+   {
+      std::transform(first.cbegin(), first.cend(), second.cbegin(), first.begin(), std::plus<Integer>());
+   }
+
+   void add(Row<SafeInteger>& first, const Row<SafeInteger>& second)
+   {
+      SafeInteger::add(first.data(), first.data() + first.size(), second.data());
+   }
+
+   template <typename Integer>
+   void subtract(Row<Integer>& first, const Row<Integer>& second)
+   {
+      std::transform(first.cbegin(), first.cend(), second.cbegin(), first.begin(), std::minus<Integer>());
+   }
+
+   void subtract(Row<SafeInteger>& first, const Row<SafeInteger>& second)
+   {
+      SafeInteger::subtract(first.data(), first.data() + first.size(), second.data());
+   }
+
+   template <typename Integer>
+   void scale(Row<Integer>& row, const Integer& factor)
+   {
+      for ( auto& entry : row )
+      {
+         entry *= factor;
+      }
+   }
+
+   void scale(Row<SafeInteger>& row, const SafeInteger& factor)
+   {
+      SafeInteger::scale(row.data(), row.data() + row.size(), factor);
+   }
+
+   template <typename Integer>
+   Integer scalarProduct(const Row<Integer>& first, const Row<Integer>& second)
+   {
+      return std::inner_product(first.cbegin(), first.cend(), second.cbegin(), Integer(0));
+   }
+
+   SafeInteger scalarProduct(const Row<SafeInteger>& first, const Row<SafeInteger>& second)
+   {
+      return SafeInteger::scalarProduct(first.data(), first.data() + first.size(), second.data());
+   }
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iosfwd>
 #include <type_traits>
 
@@ -63,6 +64,9 @@ namespace panda
       /// Calculates the least common multiple of all entries of a row.
       template <typename Integer>
       Integer lcm(const Row<Integer>&) noexcept;
+      /// Calculates a hash value of a row (equal rows have equal hash values).
+      template <typename Integer>
+      std::size_t hash(const Row<Integer>&) noexcept;
       /// Named output of a row (last entry is delimited by a sequence of characters (last argument)).
       template <typename Integer>
       void prettyPrint(std::ostream&, const Row<Integer>&, const Names&, const char*);
@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+/// Seconds since the given point in time.
+inline double secondsSince(const std::chrono::steady_clock::time_point start)
+{
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   return elapsed.count();
+}
+
+/// Calls the function repeatedly (doubling the number of calls) until the calls take at least the given time.
+/// Returns the average time of one call in seconds.
+template <typename Function>
+double secondsPerCall(Function function, const double minimum = 0.2)
+{
+   for ( std::size_t calls = 1; true; calls *= 2 )
+   {
+      const auto start = std::chrono::steady_clock::now();
+      for ( std::size_t i = 0; i < calls; ++i )
+      {
+         function();
+      }
+      const auto seconds = secondsSince(start);
+      if ( seconds >= minimum )
+      {
+         return seconds / static_cast<double>(calls);
+      }
+   }
+}
+
+/// Keeps the compiler from removing computations whose results are otherwise unused.
+template <typename T>
+void keep(const T& value)
+{
+   static volatile std::uintptr_t sink;
+   sink = sink + static_cast<std::uintptr_t>(value);
+}
+
+/// Prints a right aligned column of the given width.
+template <typename T>
+void printColumn(const T& value, const int width = 11)
+{
+   std::cout << std::setw(width) << value;
+}
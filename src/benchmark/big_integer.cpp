@@ -0,0 +1,215 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+// Compares multiplication and division of BigInteger against the bit-serial algorithms it used before
+// (shift-and-add multiplication, restoring division with one bit per step). The previous algorithms are
+// reproduced here on plain words, without the failing int fallbacks of every step that the previous
+// BigInteger additionally paid for, so their timings are a lower bound. The divisor has half the bits
+// of the dividend, similar to the gcd normalization of FME and rotation rows.
+
+#include "benchmark_gear.h"
+
+#include "big_integer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   /// Magnitude of a number in 32 bit words, least significant first.
+   using Words = std::vector<uint32_t>;
+   /// Previous multiplication: adds the shifted first factor for every set bit of the second.
+   Words multiplyBitSerial(const Words&, const Words&);
+   /// Previous division: one bit of the quotient per step. Returns the quotient.
+   Words divideBitSerial(const Words&, const Words&);
+   void addAssign(Words&, const Words&);
+   void subtractAssign(Words&, const Words&);
+   void shiftLeftOnce(Words&);
+   bool isSmaller(const Words&, const Words&);
+   /// Random magnitude with the given number of bits (the highest bit is set).
+   Words random(std::mt19937&, const std::size_t);
+   BigInteger toBigInteger(const Words&);
+   /// Prints a row of the table.
+   void compare(const std::size_t);
+}
+
+int main()
+try
+{
+   std::cout << "Microseconds per operation (the divisor has half the bits):\n";
+   printColumn("bits", 8);
+   printColumn("mul old");
+   printColumn("mul new");
+   printColumn("div old");
+   printColumn("div new");
+   std::cout << '\n' << std::fixed << std::setprecision(2);
+   for ( const std::size_t bits : {64, 128, 256, 512, 1024, 2048, 4096} )
+   {
+      compare(bits);
+   }
+}
+catch ( const std::exception& e )
+{
+   std::cerr << "Exception caught: " << e.what() << '\n';
+   return 1;
+}
+
+namespace
+{
+   Words multiplyBitSerial(const Words& first, const Words& second)
+   {
+      Words result{0};
+      auto copy = first;
+      for ( const auto word : second )
+      {
+         for ( int bit = 0; bit < 32; ++bit, shiftLeftOnce(copy) )
+         {
+            if ( ((word >> bit) & 1) != 0 )
+            {
+               addAssign(result, copy);
+            }
+         }
+      }
+      return result;
+   }
+
+   Words divideBitSerial(const Words& dividend, const Words& divisor)
+   {
+      Words quotient{0};
+      Words remainder{0};
+      for ( std::size_t position = 32 * dividend.size(); position > 0; --position )
+      {
+         shiftLeftOnce(remainder);
+         shiftLeftOnce(quotient);
+         remainder.front() |= (dividend[(position - 1) / 32] >> ((position - 1) % 32)) & 1;
+         if ( !isSmaller(remainder, divisor) )
+         {
+            subtractAssign(remainder, divisor);
+            quotient.front() |= 1;
+         }
+      }
+      return quotient;
+   }
+
+   void addAssign(Words& first, const Words& second)
+   {
+      if ( first.size() < second.size() )
+      {
+         first.resize(second.size(), 0);
+      }
+      uint64_t carry = 0;
+      for ( std::size_t i = 0; i < first.size(); ++i )
+      {
+         const auto sum = carry + first[i] + (i < second.size() ? second[i] : 0);
+         first[i] = static_cast<uint32_t>(sum);
+         carry = sum >> 32;
+         if ( carry == 0 && i >= second.size() )
+         {
+            return;
+         }
+      }
+      if ( carry != 0 )
+      {
+         first.push_back(static_cast<uint32_t>(carry));
+      }
+   }
+
+   void subtractAssign(Words& first, const Words& second)
+   {
+      // first >= second.
+      int64_t borrow = 0;
+      for ( std::size_t i = 0; i < first.size(); ++i )
+      {
+         const auto difference = static_cast<int64_t>(first[i]) - (i < second.size() ? second[i] : 0) - borrow;
+         borrow = ( difference < 0 ) ? 1 : 0;
+         first[i] = static_cast<uint32_t>(difference + (borrow << 32));
+      }
+      while ( first.size() > 1 && first.back() == 0 )
+      {
+         first.pop_back();
+      }
+   }
+
+   void shiftLeftOnce(Words& words)
+   {
+      if ( (words.back() >> 31) != 0 )
+      {
+         words.push_back(0);
+      }
+      for ( std::size_t i = words.size(); i > 1; --i )
+      {
+         words[i - 1] = (words[i - 1] << 1) | (words[i - 2] >> 31);
+      }
+      words.front() <<= 1;
+   }
+
+   bool isSmaller(const Words& first, const Words& second)
+   {
+      auto size = std::max(first.size(), second.size());
+      for ( ; size > 0; --size )
+      {
+         const auto a = size <= first.size() ? first[size - 1] : 0;
+         const auto b = size <= second.size() ? second[size - 1] : 0;
+         if ( a != b )
+         {
+            return a < b;
+         }
+      }
+      return false;
+   }
+
+   Words random(std::mt19937& generator, const std::size_t bits)
+   {
+      Words words(bits / 32);
+      for ( auto& word : words )
+      {
+         word = static_cast<uint32_t>(generator());
+      }
+      words.back() |= 0x80000000u;
+      return words;
+   }
+
+   BigInteger toBigInteger(const Words& words)
+   {
+      const BigInteger base(uint64_t(1) << 32);
+      BigInteger result(int32_t(0));
+      for ( auto it = words.crbegin(); it != words.crend(); ++it )
+      {
+         result = result * base + BigInteger(uint32_t(*it));
+      }
+      return result;
+   }
+
+   void compare(const std::size_t bits)
+   {
+      std::mt19937 generator(static_cast<std::mt19937::result_type>(bits));
+      const auto first = random(generator, bits);
+      const auto second = random(generator, bits);
+      const auto divisor = random(generator, bits / 2);
+      const auto big_first = toBigInteger(first);
+      const auto big_second = toBigInteger(second);
+      const auto big_divisor = toBigInteger(divisor);
+      if ( !(toBigInteger(multiplyBitSerial(first, second)) == big_first * big_second)
+           || !(toBigInteger(divideBitSerial(first, divisor)) == big_first / big_divisor) )
+      {
+         throw std::logic_error("The algorithms disagree on " + std::to_string(bits) + " bits.");
+      }
+      const auto microseconds = [](const double seconds) { return seconds * 1e6; };
+      printColumn(bits, 8);
+      printColumn(microseconds(secondsPerCall([&]() { keep(multiplyBitSerial(first, second).size()); })));
+      printColumn(microseconds(secondsPerCall([&]() { keep((big_first * big_second) == 0); })));
+      printColumn(microseconds(secondsPerCall([&]() { keep(divideBitSerial(first, divisor).size()); })));
+      printColumn(microseconds(secondsPerCall([&]() { keep((big_first / big_divisor) == 0); })));
+      std::cout << '\n';
+   }
+}
@@ -0,0 +1,186 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+// Compares the bitsets of the FME adjacency tests: BitsetFixedSize and BitsetVariableSize (32 bit words,
+// scalar loops) against BitsetWide (64 bit words, AVX2 / AVX-512 kernels). Every pair of bitsets is
+// tested like in phase two of the FME: one unionCount and 16 unionContains, half of them on subsets of
+// the union (these scan all words) and half of them on random bitsets (these usually stop early).
+
+#include "benchmark_gear.h"
+
+#include "bitset_fixed_size.h"
+#include "bitset_variable_size.h"
+#include "bitset_wide.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   /// Indices of the set bits of every bitset. The bitsets of pair i are 2i and 2i + 1, followed by the 16 bitsets tested for containment.
+   using Patterns = std::vector<std::vector<std::size_t>>;
+   constexpr std::size_t pairs = 64;
+   constexpr std::size_t candidates = 16;
+   /// Returns the patterns for bitsets of the given size (random, the same on every machine).
+   Patterns patterns(const std::size_t);
+   /// Returns nanoseconds per pair and a checksum of the results.
+   template <typename Bitset>
+   std::pair<double, std::size_t> measure(const Patterns&, const std::size_t);
+   /// Prints a row of the table, the fixed size bitsets are measured if the number of words is given.
+   template <std::size_t Words>
+   void compare(const std::size_t);
+   void compare(const std::size_t);
+}
+
+int main()
+try
+{
+   std::cout << "Nanoseconds per pair (unionCount and " << candidates << " unionContains), BitsetWide uses "
+             << BitsetWide::instructionSet() << ":\n";
+   printColumn("bits", 8);
+   printColumn("fixed");
+   printColumn("variable");
+   printColumn("wide");
+   std::cout << '\n' << std::fixed << std::setprecision(1);
+   compare<8>(256);
+   compare<12>(384);
+   compare<14>(448);
+   compare<16>(512);
+   compare<20>(640);
+   compare<24>(768);
+   compare<32>(1024);
+   compare<64>(2048);
+   compare<200>(6400);
+   compare(65536);
+}
+catch ( const std::exception& e )
+{
+   std::cerr << "Exception caught: " << e.what() << '\n';
+   return 1;
+}
+
+namespace
+{
+   Patterns patterns(const std::size_t size)
+   {
+      std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+      Patterns result;
+      const auto random = [&]()
+      {
+         std::vector<std::size_t> pattern;
+         for ( std::size_t i = 0; i < size; ++i )
+         {
+            if ( generator() % 4 == 0 )
+            {
+               pattern.push_back(i);
+            }
+         }
+         return pattern;
+      };
+      for ( std::size_t i = 0; i < pairs; ++i )
+      {
+         const auto first = random();
+         const auto second = random();
+         result.push_back(first);
+         result.push_back(second);
+         for ( std::size_t j = 0; j < candidates; ++j )
+         {
+            if ( j % 2 == 0 )
+            {
+               // every other bit of the union.
+               std::vector<std::size_t> subset;
+               for ( const auto& source : {first, second} )
+               {
+                  for ( std::size_t k = j / 2 % 2; k < source.size(); k += 2 )
+                  {
+                     subset.push_back(source[k]);
+                  }
+               }
+               result.push_back(subset);
+            }
+            else
+            {
+               result.push_back(random());
+            }
+         }
+      }
+      return result;
+   }
+
+   template <typename Bitset>
+   std::pair<double, std::size_t> measure(const Patterns& patterns, const std::size_t size)
+   {
+      std::vector<Bitset> bitsets;
+      bitsets.reserve(patterns.size());
+      for ( const auto& pattern : patterns )
+      {
+         bitsets.emplace_back(size);
+         for ( const auto index : pattern )
+         {
+            bitsets.back().set(index);
+         }
+      }
+      std::size_t checksum = 0;
+      const auto run = [&]()
+      {
+         checksum = 0;
+         for ( std::size_t i = 0; i < pairs; ++i )
+         {
+            const auto base = i * (2 + candidates);
+            const auto& first = bitsets[base];
+            const auto& second = bitsets[base + 1];
+            checksum += Bitset::unionCount(first, second, size);
+            for ( std::size_t j = 0; j < candidates; ++j )
+            {
+               checksum += Bitset::unionContains(first, second, bitsets[base + 2 + j], size) ? 1 : 0;
+            }
+         }
+         keep(checksum);
+      };
+      const auto seconds = secondsPerCall(run);
+      return std::make_pair(seconds * 1e9 / static_cast<double>(pairs), checksum);
+   }
+
+   template <std::size_t Words>
+   void compare(const std::size_t size)
+   {
+      const auto data = patterns(size);
+      const auto fixed = measure<BitsetFixedSize<Words>>(data, size);
+      const auto variable = measure<BitsetVariableSize>(data, size);
+      const auto wide = measure<BitsetWide>(data, size);
+      if ( fixed.second != variable.second || wide.second != variable.second )
+      {
+         throw std::logic_error("The bitsets disagree on " + std::to_string(size) + " bits.");
+      }
+      printColumn(size, 8);
+      printColumn(fixed.first);
+      printColumn(variable.first);
+      printColumn(wide.first);
+      std::cout << '\n';
+   }
+
+   void compare(const std::size_t size)
+   {
+      const auto data = patterns(size);
+      const auto variable = measure<BitsetVariableSize>(data, size);
+      const auto wide = measure<BitsetWide>(data, size);
+      if ( wide.second != variable.second )
+      {
+         throw std::logic_error("The bitsets disagree on " + std::to_string(size) + " bits.");
+      }
+      printColumn(size, 8);
+      printColumn("-");
+      printColumn(variable.first);
+      printColumn(wide.first);
+      std::cout << '\n';
+   }
+}
@@ -0,0 +1,240 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+// Runs the adjacency decomposition of a fixed instance with every job order and reports the time until
+// 2^k classes are found. Classes are counted from the progress lines of the job pool
+// ("Processing #i of at least n classes"), which are printed whenever a job is handed out.
+// Usage: job_order [<input file> [<options>...]], without input file a random 0/1-polytope is used
+// (dimension 10, 60 vertices). Runs single threaded unless the options say otherwise.
+
+#include "benchmark_gear.h"
+
+#include "input.h"
+#include "job_manager.h"
+#include "message_passing_interface_session.h"
+#include "method_adjacency_decomposition_implementation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <set>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   /// Receives std::cerr during a run. Notes the time at which the classes announced by the job pool reach
+   /// the next power of two. Other text is passed on.
+   class ProgressCounter : public std::streambuf
+   {
+      public:
+         /// Seconds until 2^k classes were found (index k).
+         std::vector<double> times() const;
+         ProgressCounter(std::streambuf*, const std::chrono::steady_clock::time_point);
+         ProgressCounter(const ProgressCounter&) = delete;
+         ProgressCounter& operator=(const ProgressCounter&) = delete;
+      protected:
+         int_type overflow(int_type) override;
+         std::streamsize xsputn(const char*, std::streamsize) override;
+      private:
+         /// Appends a character, lines are evaluated once they are complete.
+         void append(const char);
+         mutable std::mutex mutex;
+         std::streambuf* const original;
+         const std::chrono::steady_clock::time_point start;
+         std::string line;
+         std::vector<double> reached;
+   };
+   /// Writes a random 0/1-polytope (the same on every machine) and returns the file name.
+   std::string writeInstance(const std::string&);
+   /// Runs the decomposition with the options and returns the seconds until 2^k classes and the total seconds.
+   std::pair<std::vector<double>, double> run(std::vector<std::string>);
+   /// Job orders to compare.
+   const std::vector<std::string> orders{"fifo", "inc_asc", "inc_desc"};
+   const std::string output = "job_order_benchmark.out";
+}
+
+int main(int argc, char** argv)
+try
+{
+   const bool own_instance = ( argc < 2 );
+   const auto filename = own_instance ? writeInstance("job_order_benchmark.poi") : std::string(argv[1]);
+   std::vector<std::string> options{"panda", filename, "--output=" + output, "-t", "1"};
+   for ( int i = 2; i < argc; ++i )
+   {
+      options.push_back(argv[i]);
+   }
+   // the session is opened before the first run, otherwise it would be timed (MPI_Init is slow).
+   mpi::getSession();
+   std::vector<std::pair<std::vector<double>, double>> results;
+   std::size_t columns = 0;
+   for ( const auto& order : orders )
+   {
+      auto arguments = options;
+      arguments.push_back("--job-order=" + order);
+      results.push_back(run(arguments));
+      columns = std::max(columns, results.back().first.size());
+   }
+   std::cout << "Seconds until 2^k classes are found:\n";
+   printColumn("job order", 10);
+   for ( std::size_t k = 0; k < columns; ++k )
+   {
+      printColumn("2^" + std::to_string(k), 9);
+   }
+   printColumn("total", 9);
+   std::cout << '\n' << std::fixed << std::setprecision(3);
+   for ( std::size_t i = 0; i < orders.size(); ++i )
+   {
+      printColumn(orders[i], 10);
+      for ( std::size_t k = 0; k < columns; ++k )
+      {
+         if ( k < results[i].first.size() )
+         {
+            printColumn(results[i].first[k], 9);
+         }
+         else
+         {
+            printColumn("-", 9);
+         }
+      }
+      printColumn(results[i].second, 9);
+      std::cout << '\n';
+   }
+   if ( own_instance )
+   {
+      std::remove(filename.c_str());
+   }
+   std::remove(output.c_str());
+}
+catch ( const std::exception& e )
+{
+   std::remove(output.c_str());
+   std::cerr << "Exception caught: " << e.what() << '\n';
+   return 1;
+}
+
+namespace
+{
+   std::vector<double> ProgressCounter::times() const
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      return reached;
+   }
+
+   ProgressCounter::ProgressCounter(std::streambuf* original_, const std::chrono::steady_clock::time_point start_)
+   :
+      std::streambuf(),
+      mutex(),
+      original(original_),
+      start(start_),
+      line(),
+      reached()
+   {
+   }
+
+   ProgressCounter::int_type ProgressCounter::overflow(const int_type character)
+   {
+      if ( !traits_type::eq_int_type(character, traits_type::eof()) )
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         append(traits_type::to_char_type(character));
+      }
+      return traits_type::not_eof(character);
+   }
+
+   std::streamsize ProgressCounter::xsputn(const char* text, const std::streamsize size)
+   {
+      // the job pool writes every line at once, so lines of different threads don't interleave.
+      std::lock_guard<std::mutex> lock(mutex);
+      for ( std::streamsize i = 0; i < size; ++i )
+      {
+         append(text[i]);
+      }
+      return size;
+   }
+
+   void ProgressCounter::append(const char character)
+   {
+      line.push_back(character);
+      if ( character != '\n' )
+      {
+         return;
+      }
+      const std::string marker = " of at least ";
+      const auto position = line.find(marker);
+      if ( line.compare(0, 10, "Processing") == 0 && position != std::string::npos )
+      {
+         const auto classes = std::strtoull(line.c_str() + position + marker.size(), nullptr, 10);
+         while ( reached.size() < 64 && (1ull << reached.size()) <= classes )
+         {
+            reached.push_back(secondsSince(start));
+         }
+      }
+      else if ( line.compare(0, 4, "Done") != 0 )
+      {
+         original->sputn(line.data(), static_cast<std::streamsize>(line.size()));
+      }
+      line.clear();
+   }
+
+   std::string writeInstance(const std::string& filename)
+   {
+      const std::size_t dimension = 10;
+      const std::size_t vertices = 60;
+      std::mt19937 generator(1);
+      std::set<unsigned long> points;
+      while ( points.size() < vertices )
+      {
+         points.insert(generator() % (1ul << dimension));
+      }
+      std::ofstream file(filename.c_str());
+      file << "DIM=" << dimension << "\nCONV_SECTION\n";
+      for ( const auto point : points )
+      {
+         for ( std::size_t i = 0; i < dimension; ++i )
+         {
+            file << ((point >> i) & 1) << (i + 1 < dimension ? ' ' : '\n');
+         }
+      }
+      file << "END\n";
+      return filename;
+   }
+
+   std::pair<std::vector<double>, double> run(std::vector<std::string> options)
+   {
+      std::vector<char*> argv;
+      for ( auto& option : options )
+      {
+         argv.push_back(&option[0]);
+      }
+      argv.push_back(nullptr);
+      const auto argc = static_cast<int>(options.size());
+      const auto data = input::vertices<int>(argc, argv.data());
+      const auto start = std::chrono::steady_clock::now();
+      ProgressCounter counter(std::cerr.rdbuf(), start);
+      const auto original = std::cerr.rdbuf(&counter);
+      try
+      {
+         implementation::adjacencyDecomposition<JobManager>(argc, argv.data(), data, tag::facet{});
+      }
+      catch ( ... )
+      {
+         std::cerr.rdbuf(original);
+         throw;
+      }
+      const auto total = secondsSince(start);
+      std::cerr.rdbuf(original);
+      return std::make_pair(counter.times(), total);
+   }
+}
@@ -6,71 +6,39 @@
 
 #include "big_integer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
 #include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 using namespace panda;
 
-BigInteger& panda::BigInteger::operator<<=(const std::size_t distance)
+namespace
 {
-   if ( isZero() )
-   {
-      return *this;
-   }
-   const auto block_distance = distance / std::numeric_limits<DataType>::digits;
-   const auto residual_distance = distance % std::numeric_limits<DataType>::digits;
-   if ( residual_distance > 0 )
-   {
-      const auto mask = static_cast<DataType>(1) << (std::numeric_limits<DataType>::digits - residual_distance);
-      const auto old_size = data.size();
-      if ( (data.back() & mask) != 0 )
-      {
-         data.push_back(0);
-      }
-      for ( std::size_t i = old_size; i > 0; )
-      {
-         --i;
-         if ( (data[i] & mask) != 0 )
-         {
-            data[i + 1] += (data[i] >> (std::numeric_limits<DataType>::digits - residual_distance));
-         }
-         data[i] <<= residual_distance;
-      }
-   }
-   for ( std::size_t i = 0; i < block_distance; ++i )
-   {
-      data.insert(data.begin(), 0);
-   }
-   return *this;
-}
+   /// Magnitudes are multiplied and divided in 32 bit digits, so that every intermediate value fits into 64 bits.
+   using Digit = uint32_t;
+   using Digits = std::vector<Digit>;
+   constexpr int digit_bits = std::numeric_limits<Digit>::digits;
+   constexpr uint64_t digit_mask = std::numeric_limits<Digit>::max();
+   /// Products of operands with at least this many digits use Karatsuba's method.
+   constexpr std::size_t karatsuba_threshold = 40;
 
-BigInteger& panda::BigInteger::operator>>=(const std::size_t distance)
-{
-   const auto block_distance = distance / std::numeric_limits<DataType>::digits;
-   const auto residual_distance = distance % std::numeric_limits<DataType>::digits;
-   data.erase(data.begin(), data.begin() + static_cast<Magnitude::difference_type>(block_distance));
-   if ( residual_distance > 0 )
-   {
-      const auto bound = static_cast<DataType>(1) << (residual_distance);
-      data[0] >>= residual_distance;
-      for ( std::size_t i = 1; i < data.size(); ++i )
-      {
-         data[i - 1] += (data[i] % bound) << (std::numeric_limits<DataType>::digits - residual_distance);
-         data[i] >>= residual_distance;
-      }
-   }
-   shrinkToFit();
-   return *this;
-}
-
-BigInteger panda::BigInteger::operator<<(const std::size_t distance)
-{
-   BigInteger result = *this;
-   result <<= distance;
-   return result;
+   /// Splits a magnitude into digits (least significant first, without leading zeros).
+   template <typename Magnitude>
+   Digits toDigits(const Magnitude&);
+   /// Joins digits to a magnitude (without leading zeros).
+   template <typename Magnitude>
+   void fromDigits(const Digits&, Magnitude&);
+   /// Removes leading zeros, keeping at least one digit.
+   void trim(Digits&) noexcept;
+   /// Product of two digit sequences.
+   Digits multiplyDigits(const Digit*, std::size_t, const Digit*, std::size_t);
+   /// Quotient and remainder of two digit sequences (Knuth's algorithm D), the divisor must not be zero.
+   void divideDigits(const Digits&, const Digits&, Digits&, Digits&);
 }
 
 BigInteger panda::BigInteger::operator-() const
@@ -86,49 +54,47 @@ BigInteger panda::abs(BigInteger input) noexcept
    return input;
 }
 
+std::size_t panda::hash(const BigInteger& input) noexcept
+{
+   std::size_t value = (input.isNegative()) ? 1 : 0;
+   auto end = input.data.size();
+   while ( end > 1 && input.data[end - 1] == 0 ) // leading zeros do not change the number.
+   {
+      --end;
+   }
+   for ( std::size_t i = 0; i < end; ++i )
+   {
+      value ^= static_cast<std::size_t>(input.data[i]) + 0x9e3779b9u + (value << 6) + (value >> 2);
+   }
+   return value;
+}
+
 BigInteger panda::BigInteger::divideMagnitudesWithRemainder(const BigInteger& second)
 {
+   sign = Sign::Positive;
    if ( isMagnitudeSmallerThan(second) )
    {
       BigInteger remainder = *this;
       *this = BigInteger(0);
       return remainder;
    }
-   if ( *this == second )
-   {
-      *this = BigInteger(1);
-      return BigInteger(0);
-   }
-   const auto is_negative = isNegative();
-   if ( is_negative )
-   {
-      flipSign();
-   }
-   BigInteger result(0);
-   BigInteger remainder(0);
-   for ( std::size_t it = std::numeric_limits<DataType>::digits * data.size(); it > 0; --it )
-   {
-      const auto bit = (it - 1) % std::numeric_limits<DataType>::digits;
-      const auto& block = data[(it - 1) / std::numeric_limits<DataType>::digits];
-      remainder <<= 1;
-      result <<= 1;
-      remainder.data.front() |= ((block >> bit) & 1);
-      if ( !remainder.isMagnitudeSmallerThan(second) )
-      {
-         remainder.subtractMagnitude(second.data);
-         result.data.front() |= 1;
-      }
-   }
-   if ( is_negative )
-   {
-      result.flipSign();
-      remainder.flipSign();
-      remainder += second;
-   }
-   *this = result;
+   Digits quotient;
+   Digits rest;
+   divideDigits(toDigits(data), toDigits(second.data), quotient, rest);
+   fromDigits(quotient, data);
+   BigInteger remainder;
+   fromDigits(rest, remainder.data);
    return remainder;
 }
 
+BigInteger& panda::BigInteger::multiplyMagnitude(const Magnitude& second)
+{
+   const auto first = toDigits(data);
+   const auto other = toDigits(second);
+   fromDigits(multiplyDigits(first.data(), first.size(), other.data(), other.size()), data);
+   return *this;
+}
+
 BigInteger& panda::BigInteger::addMagnitude(const Magnitude& second)
 {
    bool carry = false; // carry can only ever be 0 or 1.
@@ -188,6 +154,41 @@ BigInteger& panda::BigInteger::subtractMagnitude(const Magnitude& second)
    return *this;
 }
 
+bool panda::BigInteger::fitsInt64(int64_t& value) const noexcept
+{
+   constexpr auto digits = static_cast<std::size_t>(std::numeric_limits<DataType>::digits);
+   if ( data.size() * digits > 64 )
+   {
+      return false;
+   }
+   uint64_t magnitude = 0;
+   for ( std::size_t i = data.size(); i > 0; --i )
+   {
+      magnitude = (magnitude << (digits % 64)) | static_cast<uint64_t>(data[i - 1]);
+   }
+   if ( magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) )
+   {
+      return false;
+   }
+   value = ( sign == Sign::Negative ) ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+   return true;
+}
+
+void panda::BigInteger::setValue(const int64_t value) noexcept
+{
+   constexpr auto digits = static_cast<std::size_t>(std::numeric_limits<DataType>::digits);
+   sign = ( value < 0 ) ? Sign::Negative : Sign::Positive;
+   // the magnitude is computed unsigned, as -value overflows for the smallest value.
+   auto magnitude = ( value < 0 ) ? uint64_t{0} - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+   data.clear();
+   do
+   {
+      data.push_back(static_cast<DataType>(magnitude));
+      magnitude = ( digits < 64 ) ? magnitude >> (digits % 64) : 0;
+   }
+   while ( magnitude != 0 );
+}
+
 bool panda::BigInteger::isNegative() const noexcept
 {
    return sign == Sign::Negative;
@@ -249,3 +250,252 @@ void panda::BigInteger::setZero()
    sign = Sign::Positive;
 }
 
+namespace
+{
+   template <typename Magnitude>
+   Digits toDigits(const Magnitude& words)
+   {
+      using Word = typename Magnitude::value_type;
+      static_assert(std::numeric_limits<Word>::digits % digit_bits == 0, "Words must consist of whole digits.");
+      constexpr auto digits_per_word = std::numeric_limits<Word>::digits / digit_bits;
+      Digits result;
+      result.reserve(words.size() * digits_per_word);
+      for ( const auto word : words )
+      {
+         for ( int k = 0; k < digits_per_word; ++k )
+         {
+            result.push_back(static_cast<Digit>((word >> (k * digit_bits)) & digit_mask));
+         }
+      }
+      trim(result);
+      return result;
+   }
+
+   template <typename Magnitude>
+   void fromDigits(const Digits& digits, Magnitude& words)
+   {
+      using Word = typename Magnitude::value_type;
+      constexpr std::size_t digits_per_word = std::numeric_limits<Word>::digits / digit_bits;
+      words.assign((digits.size() + digits_per_word - 1) / digits_per_word, 0);
+      for ( std::size_t i = 0; i < digits.size(); ++i )
+      {
+         words[i / digits_per_word] |= static_cast<Word>(digits[i]) << ((i % digits_per_word) * digit_bits);
+      }
+      while ( words.size() > 1 && words.back() == 0 )
+      {
+         words.pop_back();
+      }
+   }
+
+   void trim(Digits& digits) noexcept
+   {
+      while ( digits.size() > 1 && digits.back() == 0 )
+      {
+         digits.pop_back();
+      }
+      if ( digits.empty() )
+      {
+         digits.push_back(0);
+      }
+   }
+
+   /// Adds b (shifted by offset digits) to a, a has to be large enough for the sum.
+   void addShifted(Digits& a, const Digits& b, const std::size_t offset) noexcept
+   {
+      uint64_t carry = 0;
+      std::size_t i = 0;
+      for ( ; i < b.size(); ++i )
+      {
+         const auto sum = static_cast<uint64_t>(a[offset + i]) + b[i] + carry;
+         a[offset + i] = static_cast<Digit>(sum);
+         carry = sum >> digit_bits;
+      }
+      for ( ; carry != 0 && offset + i < a.size(); ++i )
+      {
+         const auto sum = static_cast<uint64_t>(a[offset + i]) + carry;
+         a[offset + i] = static_cast<Digit>(sum);
+         carry = sum >> digit_bits;
+      }
+      assert( carry == 0 );
+   }
+
+   /// Subtracts b from a, a must not be smaller than b.
+   void subtract(Digits& a, const Digits& b) noexcept
+   {
+      uint64_t borrow = 0;
+      for ( std::size_t i = 0; i < a.size() && (i < b.size() || borrow != 0); ++i )
+      {
+         const auto subtrahend = ((i < b.size()) ? b[i] : uint64_t{0}) + borrow;
+         const uint64_t digit = a[i];
+         a[i] = static_cast<Digit>(digit - subtrahend);
+         borrow = ( digit < subtrahend ) ? 1 : 0;
+      }
+      assert( borrow == 0 );
+   }
+
+   /// Sum of two digit sequences.
+   Digits add(const Digit* a, const std::size_t n, const Digit* b, const std::size_t m)
+   {
+      Digits result(a, a + n);
+      result.resize(std::max(n, m) + 1, 0);
+      addShifted(result, Digits(b, b + m), 0);
+      trim(result);
+      return result;
+   }
+
+   void multiplySchoolbook(const Digit* a, const std::size_t n, const Digit* b, const std::size_t m, Digit* result) noexcept
+   {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         uint64_t carry = 0; // (2^32 - 1)^2 + 2 * (2^32 - 1) is the largest value of a step, which fits into 64 bits.
+         for ( std::size_t j = 0; j < m; ++j )
+         {
+            const auto step = static_cast<uint64_t>(a[i]) * b[j] + result[i + j] + carry;
+            result[i + j] = static_cast<Digit>(step);
+            carry = step >> digit_bits;
+         }
+         result[i + m] = static_cast<Digit>(carry);
+      }
+   }
+
+   Digits multiplyDigits(const Digit* a, std::size_t n, const Digit* b, std::size_t m)
+   {
+      if ( n < m )
+      {
+         std::swap(a, b);
+         std::swap(n, m);
+      }
+      Digits result(n + m, 0);
+      if ( m < karatsuba_threshold )
+      {
+         multiplySchoolbook(a, n, b, m, result.data());
+      }
+      else if ( 2 * m <= n ) // unbalanced operands: multiply slices of the longer one
+      {
+         for ( std::size_t offset = 0; offset < n; offset += m )
+         {
+            addShifted(result, multiplyDigits(a + offset, std::min(m, n - offset), b, m), offset);
+         }
+      }
+      else // a * b = (a1 * x + a0) * (b1 * x + b0) = a1 * b1 * x^2 + ((a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1) * x + a0 * b0
+      {
+         const auto half = n / 2;
+         const auto low = multiplyDigits(a, half, b, half);
+         const auto high = multiplyDigits(a + half, n - half, b + half, m - half);
+         const auto a_sum = add(a, half, a + half, n - half);
+         const auto b_sum = add(b, half, b + half, m - half);
+         auto middle = multiplyDigits(a_sum.data(), a_sum.size(), b_sum.data(), b_sum.size());
+         subtract(middle, low);
+         subtract(middle, high);
+         trim(middle);
+         addShifted(result, low, 0);
+         addShifted(result, middle, half);
+         addShifted(result, high, 2 * half);
+      }
+      trim(result);
+      return result;
+   }
+
+   void divideDigits(const Digits& dividend, const Digits& divisor, Digits& quotient, Digits& remainder)
+   {
+      const auto n = divisor.size();
+      assert( divisor.back() != 0 );
+      if ( dividend.size() < n )
+      {
+         quotient = {0};
+         remainder = dividend;
+         return;
+      }
+      const auto m = dividend.size() - n;
+      quotient.assign(m + 1, 0);
+      if ( n == 1 )
+      {
+         uint64_t rest = 0;
+         for ( std::size_t i = dividend.size(); i > 0; )
+         {
+            --i;
+            const auto current = (rest << digit_bits) | dividend[i];
+            quotient[i] = static_cast<Digit>(current / divisor[0]);
+            rest = current % divisor[0];
+         }
+         remainder = {static_cast<Digit>(rest)};
+         trim(quotient);
+         return;
+      }
+      // normalization: the leading digit of the divisor gets its highest bit set, so the estimates below are off by at most two.
+      int shift = 0;
+      while ( (divisor.back() << shift) < (Digit{1} << (digit_bits - 1)) )
+      {
+         ++shift;
+      }
+      const auto shifted = [shift](const Digits& digits, const std::size_t i) -> Digit
+      {
+         const auto high = (i < digits.size()) ? static_cast<uint64_t>(digits[i]) << shift : 0;
+         const auto low = (i > 0 && shift > 0) ? static_cast<uint64_t>(digits[i - 1]) >> (digit_bits - shift) : 0;
+         return static_cast<Digit>(high | low);
+      };
+      Digits v(n);
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         v[i] = shifted(divisor, i);
+      }
+      Digits u(m + n + 1);
+      for ( std::size_t i = 0; i < u.size(); ++i )
+      {
+         u[i] = shifted(dividend, i);
+      }
+      for ( std::size_t j = m + 1; j > 0; )
+      {
+         --j;
+         const auto numerator = (static_cast<uint64_t>(u[j + n]) << digit_bits) | u[j + n - 1];
+         auto estimate = numerator / v[n - 1];
+         auto rest = numerator % v[n - 1];
+         while ( estimate > digit_mask || estimate * v[n - 2] > ((rest << digit_bits) | u[j + n - 2]) )
+         {
+            --estimate;
+            rest += v[n - 1];
+            if ( rest > digit_mask )
+            {
+               break;
+            }
+         }
+         // u[j, j + n] -= estimate * v
+         uint64_t carry = 0;
+         uint64_t borrow = 0;
+         for ( std::size_t i = 0; i < n; ++i )
+         {
+            const auto product = estimate * v[i] + carry;
+            carry = product >> digit_bits;
+            const auto subtrahend = (product & digit_mask) + borrow;
+            const uint64_t digit = u[i + j];
+            u[i + j] = static_cast<Digit>(digit - subtrahend);
+            borrow = ( digit < subtrahend ) ? 1 : 0;
+         }
+         const auto subtrahend = carry + borrow;
+         const uint64_t digit = u[j + n];
+         u[j + n] = static_cast<Digit>(digit - subtrahend);
+         if ( digit < subtrahend ) // the estimate was one too large (rare), add v back.
+         {
+            --estimate;
+            carry = 0;
+            for ( std::size_t i = 0; i < n; ++i )
+            {
+               const auto sum = static_cast<uint64_t>(u[i + j]) + v[i] + carry;
+               u[i + j] = static_cast<Digit>(sum);
+               carry = sum >> digit_bits;
+            }
+            u[j + n] = static_cast<Digit>(u[j + n] + carry);
+         }
+         quotient[j] = static_cast<Digit>(estimate);
+      }
+      remainder.assign(n, 0);
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         const auto low = static_cast<uint64_t>(u[i]) >> shift;
+         const auto high = (shift > 0) ? static_cast<uint64_t>(u[i + 1]) << (digit_bits - shift) : 0;
+         remainder[i] = static_cast<Digit>(low | high);
+      }
+      trim(quotient);
+      trim(remainder);
+   }
+}
@@ -9,7 +9,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
-#include <vector>
+
+#include "small_vector.h"
 
 namespace panda
 {
@@ -17,6 +18,8 @@ namespace panda
 
    /// Absolute value.
    BigInteger abs(BigInteger) noexcept;
+   /// Hash value (equal numbers have equal hash values).
+   std::size_t hash(const BigInteger&) noexcept;
 
    class BigInteger
    {
@@ -95,8 +98,12 @@ namespace panda
          BigInteger operator%(const BigInteger&) const;
          /// Negation (-a).
          BigInteger operator-() const;
+         /// Returns true if the number fits into int64_t (without its smallest value) and stores it.
+         bool fitsInt64(int64_t&) const noexcept;
          /// Absolute value.
          friend BigInteger abs(BigInteger) noexcept;
+         /// Hash value.
+         friend std::size_t hash(const BigInteger&) noexcept;
       private:
          /// Underlying data type.
          using DataType = uint_fast32_t;
@@ -107,19 +114,16 @@ namespace panda
             Negative
          };
          Sign sign;
-         using Magnitude = std::vector<DataType>;
+         /// Words of the magnitude (least significant first). Numbers with up to two words don't allocate.
+         using Magnitude = SmallVector<DataType, 2>;
          Magnitude data;
       private:
-         /// Left shift.
-         BigInteger& operator<<=(const std::size_t);
-         /// Right shift.
-         BigInteger& operator>>=(const std::size_t);
-         /// Left shift.
-         BigInteger operator<<(const std::size_t);
-         /// Right shift.
-         BigInteger operator>>(const std::size_t);
-         /// Division of magnitudes (sign independent).
+         /// Sets the value (without allocation).
+         void setValue(const int64_t) noexcept;
+         /// Division of magnitudes (sign independent): assigns |a| / |b| and returns |a| % |b|.
          BigInteger divideMagnitudesWithRemainder(const BigInteger&);
+         /// Multiplication of magnitudes (sign independent).
+         BigInteger& multiplyMagnitude(const Magnitude&);
          /// Addition of magnitudes (sign independent).
          BigInteger& addMagnitude(const Magnitude&);
          /// Subtraction of magnitudes (sign independent).
@@ -14,21 +14,24 @@ using namespace panda;
 
 namespace
 {
-   using DataLimits = std::numeric_limits<int>;
-   /// Tries to do multiplication with integers instead of BigIntegers.
-   BigInteger& fallbackMultiplyAssign(BigInteger&, const BigInteger&);
-   /// Tries to do division with integers instead of BigIntegers.
-   BigInteger& fallbackDivideAssign(BigInteger&, const BigInteger&);
-   /// Tries to do addition with integers instead of BigIntegers.
-   BigInteger& fallbackAddAssign(BigInteger&, const BigInteger&);
-   /// Tries to do subtraction with integers instead of BigIntegers.
-   BigInteger& fallbackSubtractAssign(BigInteger&, const BigInteger&);
-   /// Tries to do modulo operation with integers instead of BigIntegers.
-   BigInteger& fallbackModuloAssign(BigInteger&, const BigInteger&);
+   /// Multiplication with int64_t instead of BigIntegers, returns false on overflow.
+   bool multiplyInt64(const int64_t, const int64_t, int64_t&) noexcept;
+   /// Addition with int64_t instead of BigIntegers, returns false on overflow.
+   bool addInt64(const int64_t, const int64_t, int64_t&) noexcept;
+   /// Subtraction with int64_t instead of BigIntegers, returns false on overflow.
+   bool subtractInt64(const int64_t, const int64_t, int64_t&) noexcept;
 }
 
 BigInteger& panda::BigInteger::operator*=(const BigInteger& second)
 {
+   int64_t a;
+   int64_t b;
+   int64_t result;
+   if ( fitsInt64(a) && second.fitsInt64(b) && multiplyInt64(a, b, result) )
+   {
+      setValue(result);
+      return *this;
+   }
    if ( isZero() || second.isZero() )
    {
       this->setZero();
@@ -42,31 +45,10 @@ BigInteger& panda::BigInteger::operator*=(const BigInteger& second)
       }
       return *this;
    }
-   try
-   {
-      return fallbackMultiplyAssign(*this, second);
-   }
-   catch ( ... ) // catch failed attempt of falling back to integer operation
-   {
-      auto copy = *this;
-      data = {0};
-      for ( const auto& entry : second.data )
-      {
-         DataType mask = 1;
-         for ( int j = 0; j < std::numeric_limits<DataType>::digits; ++j, copy <<= 1, mask <<= 1 )
-         {
-            if ( (entry & mask) != 0 )
-            {
-               *this += copy;
-            }
-         }
-      }
-      if ( second.sign == Sign::Negative )
-      {
-         flipSign();
-      }
-      return *this;
-   }
+   const auto is_negative = (sign != second.sign);
+   multiplyMagnitude(second.data);
+   sign = is_negative ? Sign::Negative : Sign::Positive;
+   return *this;
 }
 
 BigInteger& panda::BigInteger::operator/=(const BigInteger& second)
@@ -75,6 +57,13 @@ BigInteger& panda::BigInteger::operator/=(const BigInteger& second)
    {
       throw std::invalid_argument("Integer division by 0 in \"BigInteger::operator/\".");
    }
+   int64_t a;
+   int64_t b;
+   if ( fitsInt64(a) && second.fitsInt64(b) ) // can't overflow, as the smallest value of int64_t is excluded.
+   {
+      setValue(a / b);
+      return *this;
+   }
    if ( isZero() || second == 1 || second == -1 )
    {
       if ( second.isNegative() )
@@ -83,20 +72,13 @@ BigInteger& panda::BigInteger::operator/=(const BigInteger& second)
       }
       return *this;
    }
-   try
+   const auto is_negative = (sign != second.sign);
+   divideMagnitudesWithRemainder(second);
+   if ( is_negative )
    {
-      return fallbackDivideAssign(*this, second);
-   }
-   catch ( ... ) // catch failed attempt of falling back to integer operation
-   {
-      const auto original_sign = sign;
-      auto r = divideMagnitudesWithRemainder(second);
-      if ( second.sign != original_sign )
-      {
-         flipSign();
-      }
-      return *this;
+      flipSign();
    }
+   return *this;
 }
 
 BigInteger& panda::BigInteger::operator+=(const BigInteger& second)
@@ -105,32 +87,33 @@ BigInteger& panda::BigInteger::operator+=(const BigInteger& second)
    {
       return *this;
    }
-   try
+   int64_t a;
+   int64_t b;
+   int64_t result;
+   if ( fitsInt64(a) && second.fitsInt64(b) && addInt64(a, b, result) )
    {
-      return fallbackAddAssign(*this, second);
+      setValue(result);
+      return *this;
    }
-   catch ( ... ) // catch failed attempt of falling back to integer operation
+   if ( sign == second.sign )
    {
-      if ( sign == second.sign )
-      {
-         return addMagnitude(second.data);
-      }
-      const auto old_sign = sign;
-      sign = second.sign; // swapping sign (tmp only)
-      if ( *this == second )
-      {
-         this->setZero();
-         return *this;
-      }
-      if ( (second.sign == Sign::Positive) == (*this > second) )
-      {
-         sign = old_sign; // restoring sign
-         return subtractMagnitude(second.data);
-      }
-      const auto copy = data;
-      data = second.data;
-      return subtractMagnitude(copy);
+      return addMagnitude(second.data);
+   }
+   const auto old_sign = sign;
+   sign = second.sign; // swapping sign (tmp only)
+   if ( *this == second )
+   {
+      this->setZero();
+      return *this;
    }
+   if ( (second.sign == Sign::Positive) == (*this > second) )
+   {
+      sign = old_sign; // restoring sign
+      return subtractMagnitude(second.data);
+   }
+   const auto copy = data;
+   data = second.data;
+   return subtractMagnitude(copy);
 }
 
 BigInteger& panda::BigInteger::operator-=(const BigInteger& second)
@@ -139,25 +122,26 @@ BigInteger& panda::BigInteger::operator-=(const BigInteger& second)
    {
       return *this;
    }
-   try
+   int64_t a;
+   int64_t b;
+   int64_t result;
+   if ( fitsInt64(a) && second.fitsInt64(b) && subtractInt64(a, b, result) )
    {
-      return fallbackSubtractAssign(*this, second);
+      setValue(result);
+      return *this;
    }
-   catch ( ... ) // catch failed attempt of falling back to integer operation
+   if ( sign != second.sign )
    {
-      if ( sign != second.sign )
-      {
-         return addMagnitude(second.data);
-      }
-      if ( (sign == Sign::Negative) == (*this > second) )
-      {
-         const auto copy = data;
-         data = second.data;
-         flipSign();
-         return subtractMagnitude(copy);
-      }
-      return subtractMagnitude(second.data);
+      return addMagnitude(second.data);
    }
+   if ( (sign == Sign::Negative) == (*this > second) )
+   {
+      const auto copy = data;
+      data = second.data;
+      flipSign();
+      return subtractMagnitude(copy);
+   }
+   return subtractMagnitude(second.data);
 }
 
 BigInteger& panda::BigInteger::operator%=(const BigInteger& second)
@@ -166,15 +150,23 @@ BigInteger& panda::BigInteger::operator%=(const BigInteger& second)
    {
       throw std::invalid_argument("Modulo in BigInteger is only defined for positive numbers.");
    }
-   try
+   int64_t a;
+   int64_t b;
+   if ( fitsInt64(a) && second.fitsInt64(b) )
    {
-      return fallbackModuloAssign(*this, second);
+      const auto remainder = a % b;
+      setValue((remainder < 0) ? remainder + b : remainder);
+      return *this;
    }
-   catch ( ... ) // catch failed attempt of falling back to integer operation
+   const auto is_negative = isNegative();
+   auto remainder = divideMagnitudesWithRemainder(second);
+   if ( is_negative && !remainder.isZero() ) // the result is in [0, second)
    {
-      *this = divideMagnitudesWithRemainder(second);
-      return *this;
+      remainder.flipSign();
+      remainder += second;
    }
+   *this = remainder;
+   return *this;
 }
 
 BigInteger panda::BigInteger::operator*(const BigInteger& second) const
@@ -218,63 +210,51 @@ BigInteger panda::BigInteger::operator%(const BigInteger& second) const
 
 namespace
 {
-   BigInteger& fallbackMultiplyAssign(BigInteger& first, const BigInteger& second)
-   {
-      const int a = first;
-      const int b = second;
-      const auto limit = ((a > 0) == (b > 0)) ? DataLimits::max() : DataLimits::min();
-      if ( (a > 0 && limit / b < a) || (a < 0 && limit / b > a) )
-      {
-         throw std::exception();
-      }
-      first = BigInteger(a * b);
-      return first;
-   }
-
-   BigInteger& fallbackDivideAssign(BigInteger& first, const BigInteger& second)
-   {
-      const int a = first;
-      const int b = second;
-      assert( b != 0 );
-      if ( (b == -1) && ((a < 0 && DataLimits::max() + a < 0) || (a > 0 && a + DataLimits::min() > 0)) )
-      {
-         throw std::exception();
-      }
-      first = BigInteger(a / b);
-      return first;
-   }
+   using DataLimits = std::numeric_limits<int64_t>;
 
-   BigInteger& fallbackAddAssign(BigInteger& first, const BigInteger& second)
+   bool multiplyInt64(const int64_t a, const int64_t b, int64_t& result) noexcept
    {
-      const int a = first;
-      const int b = second;
-      if ( (a > 0 && b > 0 && b > DataLimits::max() - a) || (a < 0 && b < 0 && b < DataLimits::min() - a) )
-      {
-         throw std::exception();
-      }
-      first = BigInteger(a + b);
-      return first;
+      #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_mul_overflow(a, b, &result);
+      #else
+         if ( a != 0 && b != 0 )
+         {
+            const auto limit = ((a > 0) == (b > 0)) ? DataLimits::max() : DataLimits::min();
+            if ( (a > 0 && limit / b < a) || (a < 0 && limit / b > a) )
+            {
+               return false;
+            }
+         }
+         result = a * b;
+         return true;
+      #endif
    }
 
-   BigInteger& fallbackSubtractAssign(BigInteger& first, const BigInteger& second)
+   bool addInt64(const int64_t a, const int64_t b, int64_t& result) noexcept
    {
-      const int a = first;
-      const int b = second;
-      if ( (b < 0 && a > DataLimits::max() + b) || (b > 0 && a < DataLimits::min() + b) )
-      {
-         throw std::exception();
-      }
-      first = BigInteger(a - b);
-      return first;
+      #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_add_overflow(a, b, &result);
+      #else
+         if ( (a > 0 && b > 0 && b > DataLimits::max() - a) || (a < 0 && b < 0 && b < DataLimits::min() - a) )
+         {
+            return false;
+         }
+         result = a + b;
+         return true;
+      #endif
    }
 
-   BigInteger& fallbackModuloAssign(BigInteger& first, const BigInteger& second)
+   bool subtractInt64(const int64_t a, const int64_t b, int64_t& result) noexcept
    {
-      const int a = first;
-      const int b = second;
-      assert( b > 0 );
-      first = BigInteger(((a < 0) ? b : 0) + (a % b));
-      return first;
+      #if defined(__GNUC__) || defined(__clang__)
+         return !__builtin_sub_overflow(a, b, &result);
+      #else
+         if ( (b < 0 && a > DataLimits::max() + b) || (b > 0 && a < DataLimits::min() + b) )
+         {
+            return false;
+         }
+         result = a - b;
+         return true;
+      #endif
    }
 }
-
@@ -42,6 +42,8 @@ namespace panda
          std::size_t count(const std::size_t) const noexcept;
          /// Sets the i^th bit.
          void set(const std::size_t) noexcept;
+         /// Returns whether the i^th bit is set.
+         bool test(const std::size_t) const noexcept;
       private:
          std::array<DataType, Size> data;
    };
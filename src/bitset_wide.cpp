@@ -0,0 +1,292 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "bitset_wide.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+   #define BITSET_WIDE_X86_KERNELS
+   #include <immintrin.h>
+#endif
+
+using namespace panda;
+
+namespace
+{
+   using Word = BitsetWide::DataType;
+
+   /// The kernels work on the first n words of their arguments.
+   struct Kernels
+   {
+      std::size_t (*unionCount)(const Word*, const Word*, const std::size_t);
+      bool (*unionContains)(const Word*, const Word*, const Word*, const std::size_t);
+      bool (*contains)(const Word*, const Word*, const std::size_t);
+      const char* name;
+   };
+
+   /// Returns the kernels for the best instruction set of this CPU.
+   const Kernels& kernels() noexcept;
+
+   /// Number of words up to the hint of the highest set bit.
+   std::size_t words(const std::size_t max) noexcept
+   {
+      return 1 + (max - 1) / std::numeric_limits<Word>::digits;
+   }
+
+   std::size_t popcount(const Word word) noexcept
+   {
+      #if defined(__GNUC__) || defined(__clang__)
+         return static_cast<std::size_t>(__builtin_popcountll(word));
+      #else
+         auto n = word - ((word >> 1) & 0x5555555555555555u);
+         n = (n & 0x3333333333333333u) + ((n >> 2) & 0x3333333333333333u);
+         return static_cast<std::size_t>((((n + (n >> 4)) & 0x0F0F0F0F0F0F0F0Fu) * 0x0101010101010101u) >> 56);
+      #endif
+   }
+
+   std::size_t unionCountScalar(const Word* a, const Word* b, const std::size_t n)
+   {
+      std::size_t total{0};
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         total += popcount(a[i] | b[i]);
+      }
+      return total;
+   }
+
+   bool unionContainsScalar(const Word* a, const Word* b, const Word* inner, const std::size_t n)
+   {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         if ( (inner[i] & ~(a[i] | b[i])) != 0 )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   bool containsScalar(const Word* outer, const Word* inner, const std::size_t n)
+   {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         if ( (inner[i] & ~outer[i]) != 0 )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+#ifdef BITSET_WIDE_X86_KERNELS
+   /// AVX2 has no popcount for vectors, the bytes are counted by a table lookup of their nibbles instead.
+   __attribute__((target("avx2")))
+   __m256i popcountBytes(const __m256i v)
+   {
+      const auto table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const auto low_mask = _mm256_set1_epi8(0x0F);
+      const auto low = _mm256_and_si256(v, low_mask);
+      const auto high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+      return _mm256_add_epi8(_mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(table, high));
+   }
+
+   __attribute__((target("avx2")))
+   std::size_t unionCountAVX2(const Word* a, const Word* b, const std::size_t n)
+   {
+      auto sums = _mm256_setzero_si256();
+      std::size_t i = 0;
+      for ( ; i + 4 <= n; i += 4 )
+      {
+         const auto u = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+         sums = _mm256_add_epi64(sums, _mm256_sad_epu8(popcountBytes(u), _mm256_setzero_si256()));
+      }
+      std::size_t total = static_cast<std::size_t>(_mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+      return total + unionCountScalar(a + i, b + i, n - i);
+   }
+
+   __attribute__((target("avx2")))
+   bool unionContainsAVX2(const Word* a, const Word* b, const Word* inner, const std::size_t n)
+   {
+      std::size_t i = 0;
+      for ( ; i + 4 <= n; i += 4 )
+      {
+         const auto u = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+         if ( !_mm256_testc_si256(u, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inner + i))) )
+         {
+            return false;
+         }
+      }
+      return unionContainsScalar(a + i, b + i, inner + i, n - i);
+   }
+
+   __attribute__((target("avx2")))
+   bool containsAVX2(const Word* outer, const Word* inner, const std::size_t n)
+   {
+      std::size_t i = 0;
+      for ( ; i + 4 <= n; i += 4 )
+      {
+         if ( !_mm256_testc_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(outer + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inner + i))) )
+         {
+            return false;
+         }
+      }
+      return containsScalar(outer + i, inner + i, n - i);
+   }
+
+   __attribute__((target("avx512f,avx512vpopcntdq")))
+   std::size_t unionCountAVX512(const Word* a, const Word* b, const std::size_t n)
+   {
+      auto sums = _mm512_setzero_si512();
+      std::size_t i = 0;
+      for ( ; i + 8 <= n; i += 8 )
+      {
+         const auto u = _mm512_or_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+         sums = _mm512_add_epi64(sums, _mm512_popcnt_epi64(u));
+      }
+      if ( i < n )
+      {
+         const auto mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+         const auto u = _mm512_or_si512(_mm512_maskz_loadu_epi64(mask, a + i), _mm512_maskz_loadu_epi64(mask, b + i));
+         sums = _mm512_add_epi64(sums, _mm512_popcnt_epi64(u));
+      }
+      long long lanes[8];
+      _mm512_storeu_si512(lanes, sums);
+      return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7]);
+   }
+
+   __attribute__((target("avx512f")))
+   bool unionContainsAVX512(const Word* a, const Word* b, const Word* inner, const std::size_t n)
+   {
+      for ( std::size_t i = 0; i < n; i += 8 )
+      {
+         const auto mask = ( i + 8 <= n ) ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - i)) - 1);
+         const auto u = _mm512_or_si512(_mm512_maskz_loadu_epi64(mask, a + i), _mm512_maskz_loadu_epi64(mask, b + i));
+         const auto v = _mm512_maskz_loadu_epi64(mask, inner + i);
+         if ( _mm512_cmpneq_epi64_mask(_mm512_and_si512(u, v), v) != 0 )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   __attribute__((target("avx512f")))
+   bool containsAVX512(const Word* outer, const Word* inner, const std::size_t n)
+   {
+      for ( std::size_t i = 0; i < n; i += 8 )
+      {
+         const auto mask = ( i + 8 <= n ) ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - i)) - 1);
+         const auto v = _mm512_maskz_loadu_epi64(mask, inner + i);
+         if ( _mm512_cmpneq_epi64_mask(_mm512_and_si512(_mm512_maskz_loadu_epi64(mask, outer + i), v), v) != 0 )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+#endif
+
+   Kernels selectKernels() noexcept
+   {
+      #ifdef BITSET_WIDE_X86_KERNELS
+         __builtin_cpu_init();
+         if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq") )
+         {
+            return Kernels{unionCountAVX512, unionContainsAVX512, containsAVX512, "avx512"};
+         }
+         if ( __builtin_cpu_supports("avx2") )
+         {
+            return Kernels{unionCountAVX2, unionContainsAVX2, containsAVX2, "avx2"};
+         }
+      #endif
+      return Kernels{unionCountScalar, unionContainsScalar, containsScalar, "scalar"};
+   }
+
+   const Kernels& kernels() noexcept
+   {
+      static const Kernels selected = selectKernels();
+      return selected;
+   }
+}
+
+panda::BitsetWide::BitsetWide(const std::size_t bits)
+:
+   data(words(bits))
+{
+   assert( bits > 0 );
+}
+
+bool panda::BitsetWide::equals(const BitsetWide& second, const std::size_t max) const noexcept
+{
+   assert( data.size() == second.data.size() );
+   const auto end = data.cbegin() + static_cast<std::vector<DataType>::difference_type>(words(max));
+   return std::equal(data.cbegin(), end, second.data.cbegin());
+}
+
+bool panda::BitsetWide::contains(const BitsetWide& second, const std::size_t max) const noexcept
+{
+   assert( data.size() == second.data.size() );
+   return kernels().contains(data.data(), second.data.data(), words(max));
+}
+
+std::size_t panda::BitsetWide::count(const std::size_t max) const noexcept
+{
+   std::size_t total{0};
+   const auto end = words(max);
+   for ( std::size_t i = 0; i < end; ++i )
+   {
+      total += popcount(data[i]);
+   }
+   return total;
+}
+
+BitsetWide panda::BitsetWide::merge(const BitsetWide& second, const std::size_t max) const noexcept
+{
+   assert( data.size() == second.data.size() );
+   BitsetWide result = *this;
+   const auto end = words(max);
+   for ( std::size_t i = 0; i < end; ++i )
+   {
+      result.data[i] |= second.data[i];
+   }
+   return result;
+}
+
+void panda::BitsetWide::set(const std::size_t index) noexcept
+{
+   const DataType mask = static_cast<DataType>(1u) << (index % std::numeric_limits<DataType>::digits);
+   assert( index / std::numeric_limits<DataType>::digits < data.size() );
+   data[index / std::numeric_limits<DataType>::digits] |= mask;
+}
+
+bool panda::BitsetWide::test(const std::size_t index) const noexcept
+{
+   const DataType mask = static_cast<DataType>(1u) << (index % std::numeric_limits<DataType>::digits);
+   assert( index / std::numeric_limits<DataType>::digits < data.size() );
+   return (data[index / std::numeric_limits<DataType>::digits] & mask) != 0;
+}
+
+std::size_t panda::BitsetWide::unionCount(const BitsetWide& a, const BitsetWide& b, const std::size_t max) noexcept
+{
+   assert( a.data.size() == b.data.size() );
+   return kernels().unionCount(a.data.data(), b.data.data(), words(max));
+}
+
+bool panda::BitsetWide::unionContains(const BitsetWide& a, const BitsetWide& b, const BitsetWide& inner, const std::size_t max) noexcept
+{
+   assert( a.data.size() == b.data.size() && a.data.size() == inner.data.size() );
+   return kernels().unionContains(a.data.data(), b.data.data(), inner.data.data(), words(max));
+}
+
+const char* panda::BitsetWide::instructionSet() noexcept
+{
+   return kernels().name;
+}
+
@@ -0,0 +1,53 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace panda
+{
+   /// A class for variable size bitsets with 64 bit words and the same interface as BitsetVariableSize.
+   /// Union counts and containment checks use AVX2 or AVX-512 instructions if the CPU supports them.
+   /// The instruction set is chosen once at runtime, so the same binary runs on any x86-64 machine.
+   class BitsetWide
+   {
+      public:
+         static std::size_t unionCount(const BitsetWide&, const BitsetWide&, const std::size_t) noexcept;
+         static bool unionContains(const BitsetWide&, const BitsetWide&, const BitsetWide&, const std::size_t) noexcept;
+         /// Returns the name of the instruction set used for the kernels ("avx512", "avx2" or "scalar").
+         static const char* instructionSet() noexcept;
+         /// Underlying data type.
+         using DataType = uint64_t;
+         /// Constructor: argument denotes number of bits.
+         BitsetWide(const std::size_t);
+         /// Default copy constructor.
+         BitsetWide(const BitsetWide&) = default;
+         /// Default move constructor.
+         BitsetWide(BitsetWide&&) = default;
+         /// Default copy assignment operator.
+         BitsetWide& operator=(const BitsetWide&) = default;
+         /// Default move assignment operator.
+         BitsetWide& operator=(BitsetWide&&) = default;
+         /// Comparison (equality) with another Bitset with a hint of highest set bit.
+         bool equals(const BitsetWide&, const std::size_t) const noexcept;
+         /// Checks if the passed Bitset is contained in this (with hint of highest set bit).
+         bool contains(const BitsetWide&, const std::size_t) const noexcept;
+         /// Returns the union with a second bitset with a hint of highest set bit.
+         BitsetWide merge(const BitsetWide&, const std::size_t) const noexcept;
+         /// Returns the number of 1s in the bitset with a hint of highest set bit.
+         std::size_t count(const std::size_t) const noexcept;
+         /// Sets the i^th bit.
+         void set(const std::size_t) noexcept;
+         /// Returns whether the i^th bit is set.
+         bool test(const std::size_t) const noexcept;
+      private:
+         std::vector<DataType> data;
+   };
+}
+
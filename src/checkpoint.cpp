@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "checkpoint.h"
+
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+using namespace panda;
+
+namespace
+{
+   /// Returns the parameter of the option "<option><parameter>". Throws if the parameter is empty.
+   std::string fileParameter(int, char**, const char*);
+   /// Tries to read a positive number of seconds from char*.
+   std::chrono::seconds interpretInterval(char*);
+}
+
+std::string panda::checkpoint::filename(int argc, char** argv)
+{
+   return fileParameter(argc, argv, "--checkpoint=");
+}
+
+std::chrono::seconds panda::checkpoint::interval(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--checkpoint-interval=", 22) == 0 )
+      {
+         return interpretInterval(argv[i] + 22);
+      }
+   }
+   return std::chrono::seconds(600); // default value
+}
+
+std::string panda::checkpoint::resumeFilename(int argc, char** argv)
+{
+   return fileParameter(argc, argv, "--resume=");
+}
+
+namespace
+{
+   std::string fileParameter(int argc, char** argv, const char* option)
+   {
+      assert( argc > 0 && argv != nullptr && option != nullptr );
+      const auto length = std::strlen(option);
+      for ( int i = 1; i < argc; ++i )
+      {
+         if ( std::strncmp(argv[i], option, length) == 0 )
+         {
+            if ( argv[i][length] == '\0' )
+            {
+               throw std::invalid_argument(std::string("Command line option \"") + option + "<file>\" needs a file name.");
+            }
+            return argv[i] + length;
+         }
+      }
+      return ""; // default value: option not set
+   }
+
+   std::chrono::seconds interpretInterval(char* string)
+   {
+      assert( string != nullptr );
+      std::istringstream stream(string);
+      long n;
+      std::string rest;
+      if ( !(stream >> n) || (stream >> rest) || n <= 0 )
+      {
+         throw std::invalid_argument("Command line option \"--checkpoint-interval=<s>\" needs an integral parameter greater zero.");
+      }
+      return std::chrono::seconds(n);
+   }
+}
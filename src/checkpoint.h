@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace panda
+{
+   namespace checkpoint
+   {
+      /// Returns the name of the file the state of the job pool is saved to. Empty means no checkpoints.
+      std::string filename(int, char**);
+      /// Returns the time between two checkpoints.
+      std::chrono::seconds interval(int, char**);
+      /// Returns the name of the checkpoint a run is resumed from. Empty means a fresh start.
+      std::string resumeFilename(int, char**);
+   }
+}
+
@@ -0,0 +1,197 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_CHECKPOINT_FILE
+#include "checkpoint_file.h"
+#undef COMPILE_TEMPLATE_CHECKPOINT_FILE
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "decimal.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Identifies a checkpoint file (including the version of the format).
+   constexpr char magic[8] = {'P', 'A', 'N', 'D', 'A', 'C', 'P', '2'};
+   /// Writes a number of fixed size.
+   void writeNumber(std::ostream&, const std::uint64_t);
+   /// Reads a number of fixed size. Throws if the file ends prematurely.
+   std::uint64_t readNumber(std::istream&, const std::string&);
+   /// Writes an integer of arbitrary width as length-prefixed decimal text.
+   template <typename Integer>
+   void writeInteger(std::ostream&, const Integer&);
+   /// Reads an integer written by writeInteger. The third argument is the size of the file, which bounds the length of the
+   /// integer. Throws if the file is truncated or corrupt.
+   template <typename Integer>
+   Integer readInteger(std::istream&, const std::string&, const std::uint64_t);
+   /// Returns the size of the file in bytes and rewinds it.
+   std::uint64_t fileSize(std::istream&, const std::string&);
+}
+
+template <typename Integer>
+void panda::checkpoint::write(const std::string& filename, const std::vector<const Row<Integer>*>& classes, const std::vector<const Row<Integer>*>& jobs)
+{
+   std::unordered_map<const Row<Integer>*, std::uint64_t> indices;
+   indices.reserve(classes.size());
+   for ( std::size_t i = 0; i < classes.size(); ++i )
+   {
+      indices.emplace(classes[i], i);
+   }
+   const auto row_size = classes.empty() ? 0 : classes.front()->size();
+   // write to a temporary file first, such that an interruption never destroys the previous checkpoint.
+   const auto temporary = filename + ".tmp";
+   {
+      std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+      if ( !file )
+      {
+         throw std::runtime_error("Failed to open checkpoint file \"" + temporary + "\".");
+      }
+      file.write(magic, sizeof(magic));
+      writeNumber(file, classes.size());
+      writeNumber(file, row_size);
+      for ( const auto row : classes )
+      {
+         assert( row != nullptr && row->size() == row_size );
+         for ( const auto& element : *row )
+         {
+            writeInteger(file, element);
+         }
+      }
+      writeNumber(file, jobs.size());
+      for ( const auto job : jobs )
+      {
+         const auto it = indices.find(job);
+         if ( it == indices.end() )
+         {
+            throw std::logic_error("Checkpoint: job is not among the classes.");
+         }
+         writeNumber(file, it->second);
+      }
+      file.flush();
+      if ( !file )
+      {
+         throw std::runtime_error("Failed to write checkpoint file \"" + temporary + "\".");
+      }
+   }
+   if ( std::rename(temporary.c_str(), filename.c_str()) != 0 )
+   {
+      throw std::runtime_error("Failed to replace checkpoint file \"" + filename + "\".");
+   }
+}
+
+template <typename Integer>
+std::pair<Matrix<Integer>, Matrix<Integer>> panda::checkpoint::read(const std::string& filename)
+{
+   std::ifstream file(filename.c_str(), std::ios::binary);
+   if ( !file )
+   {
+      throw std::invalid_argument("Failed to open checkpoint file \"" + filename + "\".");
+   }
+   const auto file_size = fileSize(file, filename);
+   char header[sizeof(magic)];
+   if ( !file.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0 )
+   {
+      throw std::invalid_argument("File \"" + filename + "\" is not a checkpoint of this version.");
+   }
+   const auto number_of_classes = readNumber(file, filename);
+   const auto row_size = readNumber(file, filename);
+   Matrix<Integer> classes;
+   classes.reserve(number_of_classes);
+   for ( std::uint64_t i = 0; i < number_of_classes; ++i )
+   {
+      Row<Integer> row;
+      row.reserve(row_size);
+      for ( std::uint64_t j = 0; j < row_size; ++j )
+      {
+         row.push_back(readInteger<Integer>(file, filename, file_size));
+      }
+      classes.push_back(std::move(row));
+   }
+   const auto number_of_jobs = readNumber(file, filename);
+   Matrix<Integer> jobs;
+   jobs.reserve(number_of_jobs);
+   for ( std::uint64_t i = 0; i < number_of_jobs; ++i )
+   {
+      const auto index = readNumber(file, filename);
+      if ( index >= classes.size() )
+      {
+         throw std::invalid_argument("Checkpoint file \"" + filename + "\" is corrupt.");
+      }
+      jobs.push_back(classes[index]);
+   }
+   return std::make_pair(std::move(classes), std::move(jobs));
+}
+
+namespace
+{
+   void writeNumber(std::ostream& stream, const std::uint64_t number)
+   {
+      stream.write(reinterpret_cast<const char*>(&number), sizeof(number));
+   }
+
+   std::uint64_t readNumber(std::istream& stream, const std::string& filename)
+   {
+      std::uint64_t number;
+      if ( !stream.read(reinterpret_cast<char*>(&number), sizeof(number)) )
+      {
+         throw std::invalid_argument("Checkpoint file \"" + filename + "\" is truncated.");
+      }
+      return number;
+   }
+
+   template <typename Integer>
+   void writeInteger(std::ostream& stream, const Integer& number)
+   {
+      const auto digits = decimal::toString(number);
+      writeNumber(stream, digits.size());
+      stream.write(digits.c_str(), static_cast<std::streamsize>(digits.size()));
+   }
+
+   template <typename Integer>
+   Integer readInteger(std::istream& stream, const std::string& filename, const std::uint64_t file_size)
+   {
+      const auto length = readNumber(stream, filename);
+      // arbitrary precision integers have no maximal length, but a length beyond the file is corrupt (and mustn't be allocated).
+      if ( length == 0 || length > file_size )
+      {
+         throw std::invalid_argument("Checkpoint file \"" + filename + "\" is corrupt.");
+      }
+      std::string digits(length, '\0');
+      if ( !stream.read(&digits[0], static_cast<std::streamsize>(length)) )
+      {
+         throw std::invalid_argument("Checkpoint file \"" + filename + "\" is truncated.");
+      }
+      try
+      {
+         return decimal::fromString<Integer>(digits);
+      }
+      catch ( const std::invalid_argument& )
+      {
+         throw std::invalid_argument("Checkpoint file \"" + filename + "\" is corrupt.");
+      }
+   }
+
+   std::uint64_t fileSize(std::istream& stream, const std::string& filename)
+   {
+      stream.seekg(0, std::ios::end);
+      const auto size = stream.tellg();
+      stream.seekg(0, std::ios::beg);
+      if ( !stream || size < 0 )
+      {
+         throw std::invalid_argument("Failed to read checkpoint file \"" + filename + "\".");
+      }
+      return static_cast<std::uint64_t>(size);
+   }
+}
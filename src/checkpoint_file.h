@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "matrix.h"
+#include "row.h"
+
+namespace panda
+{
+   namespace checkpoint
+   {
+      /// Saves the state of a job pool: all classes found so far (second argument) and the jobs
+      /// that are queued or in progress (third argument, each of them also listed as class).
+      /// The file is written in binary form (native byte order, entries as decimal text of full width) and replaced atomically.
+      template <typename Integer>
+      void write(const std::string&, const std::vector<const Row<Integer>*>&, const std::vector<const Row<Integer>*>&);
+      /// Loads the state of a job pool saved by write. Returns the classes and the unfinished jobs.
+      template <typename Integer>
+      std::pair<Matrix<Integer>, Matrix<Integer>> read(const std::string&);
+   }
+}
+
+#include "checkpoint_file.eti"
+
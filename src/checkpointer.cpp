@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "checkpointer.h"
+
+#include <cassert>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+using namespace panda;
+
+panda::Checkpointer::Checkpointer(std::function<void()> task_, const std::chrono::seconds interval_)
+:
+   task(std::move(task_)),
+   interval(interval_),
+   mutex(),
+   condition(),
+   stopping(false),
+   thread()
+{
+   assert( interval.count() > 0 );
+   if ( task )
+   {
+      thread = std::thread(&Checkpointer::run, this);
+   }
+}
+
+panda::Checkpointer::~Checkpointer()
+{
+   if ( !thread.joinable() )
+   {
+      return;
+   }
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+   }
+   condition.notify_one();
+   thread.join();
+}
+
+void panda::Checkpointer::run()
+{
+   while ( true )
+   {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         if ( condition.wait_for(lock, interval, [&]() { return stopping; }) )
+         {
+            return;
+         }
+      }
+      try
+      {
+         task();
+      }
+      catch ( const std::exception& e )
+      {
+         std::stringstream stream;
+         stream << "Checkpoint failed: " << e.what() << '\n';
+         std::cerr << stream.str();
+      }
+   }
+}
@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace panda
+{
+   /// Runs a task (saving a checkpoint) periodically in a background thread.
+   /// Errors of the task are reported on std::cerr, the next period tries again.
+   class Checkpointer
+   {
+      public:
+         /// Constructor. The first argument is the task, the second one the time between two calls.
+         /// If the task is empty, no thread is started.
+         Checkpointer(std::function<void()>, const std::chrono::seconds);
+         /// Destructor. Stops the thread without calling the task again.
+         ~Checkpointer();
+         /// Copy construction is not allowed.
+         Checkpointer(const Checkpointer&) = delete;
+         /// Copy assignment is not allowed.
+         Checkpointer& operator=(const Checkpointer&) = delete;
+      private:
+         const std::function<void()> task;
+         const std::chrono::seconds interval;
+         std::mutex mutex;
+         std::condition_variable condition;
+         bool stopping;
+         std::thread thread;
+      private:
+         /// Main loop of the background thread.
+         void run();
+   };
+}
+
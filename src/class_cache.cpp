@@ -0,0 +1,82 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_CLASS_CACHE
+#include "class_cache.h"
+#undef COMPILE_TEMPLATE_CLASS_CACHE
+
+#include <algorithm>
+
+#include "algorithm_row_operations.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Number of independently locked parts of the cache.
+   constexpr std::size_t number_of_shards = 64;
+}
+
+template <typename Integer>
+std::shared_ptr<const Row<Integer>> panda::ClassCache<Integer>::find(const Row<Integer>& row) const
+{
+   ++lookups;
+   auto& shard = shards[Hasher()(row) % shards.size()];
+   std::lock_guard<std::mutex> lock(shard.mutex);
+   const auto position = shard.representatives.find(row);
+   if ( position == shard.representatives.end() )
+   {
+      return nullptr;
+   }
+   ++hits;
+   return position->second;
+}
+
+template <typename Integer>
+void panda::ClassCache<Integer>::insert(const std::set<Row<Integer>>& rows, const Row<Integer>& representative) const
+{
+   // all rows of the class share the same copy of the representative.
+   const auto shared = std::make_shared<const Row<Integer>>(representative);
+   for ( const auto& row : rows )
+   {
+      auto& shard = shards[Hasher()(row) % shards.size()];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if ( shard.representatives.size() >= shard_capacity )
+      {
+         shard.representatives.clear();
+      }
+      shard.representatives.emplace(row, shared);
+   }
+}
+
+template <typename Integer>
+ClassCacheStatistics panda::ClassCache<Integer>::statistics() const
+{
+   std::size_t size = 0;
+   for ( auto& shard : shards )
+   {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size += shard.representatives.size();
+   }
+   return ClassCacheStatistics{size, lookups, hits};
+}
+
+template <typename Integer>
+panda::ClassCache<Integer>::ClassCache(const std::size_t capacity)
+:
+   shard_capacity(std::max(capacity / number_of_shards, std::size_t{1})),
+   shards(number_of_shards),
+   lookups(0),
+   hits(0)
+{
+}
+
+template <typename Integer>
+std::size_t panda::ClassCache<Integer>::Hasher::operator()(const Row<Integer>& row) const noexcept
+{
+   return algorithm::hash(row);
+}
+
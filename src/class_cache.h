@@ -0,0 +1,68 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "row.h"
+
+namespace panda
+{
+   /// Counters of a ClassCache.
+   struct ClassCacheStatistics
+   {
+      std::size_t size;
+      std::size_t lookups;
+      std::size_t hits;
+   };
+
+   /// Thread-safe cache from rows to the representatives of their classes.
+   /// Once a class is enumerated, all of its rows are stored, so any later row of the class is found immediately.
+   /// The cache is split into independently locked shards. A shard that exceeds its part of the capacity is emptied.
+   template <typename Integer>
+   class ClassCache
+   {
+      public:
+         /// Returns the representative of the class of the row, or nullptr if the row isn't stored.
+         std::shared_ptr<const Row<Integer>> find(const Row<Integer>&) const;
+         /// Stores the representative (second argument) for all rows of a class.
+         void insert(const std::set<Row<Integer>>&, const Row<Integer>&) const;
+         /// Returns the number of stored rows and how many lookups found their row.
+         ClassCacheStatistics statistics() const;
+         /// Constructor. The argument is the maximum number of stored rows.
+         explicit ClassCache(const std::size_t);
+         /// Copy construction is not allowed.
+         ClassCache(const ClassCache<Integer>&) = delete;
+         /// Copy assignment is not allowed.
+         ClassCache<Integer>& operator=(const ClassCache<Integer>&) = delete;
+      private:
+         struct Hasher
+         {
+            std::size_t operator()(const Row<Integer>&) const noexcept;
+         };
+         /// A part of the cache with its own lock.
+         struct Shard
+         {
+            Shard() : mutex(), representatives() {}
+            std::mutex mutex;
+            std::unordered_map<Row<Integer>, std::shared_ptr<const Row<Integer>>, Hasher> representatives;
+         };
+         const std::size_t shard_capacity;
+         mutable std::vector<Shard> shards;
+         mutable std::atomic<std::size_t> lookups;
+         mutable std::atomic<std::size_t> hits;
+   };
+}
+
+#include "class_cache.eti"
+
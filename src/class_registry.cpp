@@ -0,0 +1,168 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_CLASS_REGISTRY
+#include "class_registry.h"
+#undef COMPILE_TEMPLATE_CLASS_REGISTRY
+
+#include <algorithm>
+#include <utility>
+
+#include "algorithm_row_operations.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Number of independently locked parts of a hashed registry.
+   /// Should be well above the number of threads to make collisions on a lock unlikely.
+   constexpr std::size_t number_of_shards = 256;
+}
+
+template <typename Integer>
+const Row<Integer>* panda::ClassRegistry<Integer>::insert(const Row<Integer>& row) const
+{
+   if ( type == ClassRegistryType::Ordered )
+   {
+      return insert(row, 0);
+   }
+   return insert(row, algorithm::hash(row));
+}
+
+template <typename Integer>
+const Row<Integer>* panda::ClassRegistry<Integer>::insert(const Row<Integer>& row, const std::size_t hash) const
+{
+   if ( type == ClassRegistryType::Ordered )
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      const auto result = ordered_rows.insert(row);
+      if ( !result.second )
+      {
+         return nullptr;
+      }
+      ++count;
+      return &*result.first;
+   }
+   auto& shard = shards[hash % shards.size()];
+   std::lock_guard<std::mutex> lock(shard.mutex);
+   const auto result = shard.rows.insert(HashedRow{hash, row});
+   if ( !result.second )
+   {
+      return nullptr;
+   }
+   ++count;
+   return &result.first->row;
+}
+
+template <typename Integer>
+std::vector<const Row<Integer>*> panda::ClassRegistry<Integer>::insert(const Matrix<Integer>& matrix) const
+{
+   std::vector<const Row<Integer>*> stored(matrix.size(), nullptr);
+   if ( type == ClassRegistryType::Ordered )
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      for ( std::size_t i = 0; i < matrix.size(); ++i )
+      {
+         const auto result = ordered_rows.insert(matrix[i]);
+         if ( result.second )
+         {
+            stored[i] = &*result.first;
+         }
+      }
+   }
+   else
+   {
+      // group the rows by shard, so every shard is locked at most once.
+      std::vector<std::pair<std::size_t, std::size_t>> order; // (shard, index in matrix)
+      std::vector<std::size_t> hashes;
+      order.reserve(matrix.size());
+      hashes.reserve(matrix.size());
+      for ( std::size_t i = 0; i < matrix.size(); ++i )
+      {
+         hashes.push_back(algorithm::hash(matrix[i]));
+         order.emplace_back(hashes.back() % shards.size(), i);
+      }
+      std::sort(order.begin(), order.end());
+      auto it = order.cbegin();
+      while ( it != order.cend() )
+      {
+         auto& shard = shards[it->first];
+         std::lock_guard<std::mutex> lock(shard.mutex);
+         const auto current = it->first;
+         for ( ; it != order.cend() && it->first == current; ++it )
+         {
+            const auto result = shard.rows.insert(HashedRow{hashes[it->second], matrix[it->second]});
+            if ( result.second )
+            {
+               stored[it->second] = &result.first->row;
+            }
+         }
+      }
+   }
+   stored.erase(std::remove(stored.begin(), stored.end(), nullptr), stored.end());
+   count += stored.size();
+   return stored;
+}
+
+template <typename Integer>
+bool panda::ClassRegistry<Integer>::contains(const Row<Integer>& row) const
+{
+   return find(row) != nullptr;
+}
+
+template <typename Integer>
+const Row<Integer>* panda::ClassRegistry<Integer>::find(const Row<Integer>& row) const
+{
+   if ( type == ClassRegistryType::Ordered )
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      const auto it = ordered_rows.find(row);
+      return (it != ordered_rows.end()) ? &*it : nullptr;
+   }
+   const auto hash = algorithm::hash(row);
+   auto& shard = shards[hash % shards.size()];
+   std::lock_guard<std::mutex> lock(shard.mutex);
+   const auto it = shard.rows.find(HashedRow{hash, row});
+   return (it != shard.rows.end()) ? &it->row : nullptr;
+}
+
+template <typename Integer>
+std::size_t panda::ClassRegistry<Integer>::size() const noexcept
+{
+   return count.load();
+}
+
+template <typename Integer>
+Matrix<Integer> panda::ClassRegistry<Integer>::sorted() const
+{
+   if ( type == ClassRegistryType::Ordered )
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      return Matrix<Integer>(ordered_rows.cbegin(), ordered_rows.cend());
+   }
+   Matrix<Integer> rows;
+   rows.reserve(count.load());
+   for ( auto& shard : shards )
+   {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for ( const auto& entry : shard.rows )
+      {
+         rows.push_back(entry.row);
+      }
+   }
+   std::sort(rows.begin(), rows.end());
+   return rows;
+}
+
+template <typename Integer>
+panda::ClassRegistry<Integer>::ClassRegistry(const ClassRegistryType type_)
+:
+   type(type_),
+   shards((type_ == ClassRegistryType::Hashed) ? number_of_shards : 0),
+   mutex(),
+   ordered_rows(),
+   count(0)
+{
+}
@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include "class_registry_type.h"
+#include "matrix.h"
+#include "row.h"
+
+namespace panda
+{
+   /// Thread-safe set of all rows (classes) that were discovered so far.
+   /// The hashed variant computes the hash value of a row once and uses it both for choosing
+   /// one of several independently locked shards and as the key inside the shard.
+   /// The ordered variant is the plain lexicographically ordered set of the original implementation.
+   template <typename Integer>
+   class ClassRegistry
+   {
+      public:
+         /// Registers a row. Returns the address of the stored copy if the row is new, nullptr otherwise.
+         /// The address stays valid as long as the registry exists, hence it may be used to queue the row.
+         const Row<Integer>* insert(const Row<Integer>&) const;
+         /// Same as above, but with a precomputed hash value (see algorithm::hash).
+         const Row<Integer>* insert(const Row<Integer>&, const std::size_t) const;
+         /// Registers all rows of a matrix, locking every part of the registry at most once.
+         /// Returns the addresses of the stored copies of the new rows (in order of the matrix).
+         std::vector<const Row<Integer>*> insert(const Matrix<Integer>&) const;
+         /// Checks if a row was registered before.
+         bool contains(const Row<Integer>&) const;
+         /// Returns the address of the stored copy of a row, nullptr if the row wasn't registered.
+         const Row<Integer>* find(const Row<Integer>&) const;
+         /// Returns the number of registered rows.
+         std::size_t size() const noexcept;
+         /// Returns all registered rows in lexicographical order.
+         Matrix<Integer> sorted() const;
+         /// Constructor.
+         explicit ClassRegistry(const ClassRegistryType);
+         /// Copy construction is not allowed.
+         ClassRegistry(const ClassRegistry<Integer>&) = delete;
+         /// Copy assignment is not allowed.
+         ClassRegistry<Integer>& operator=(const ClassRegistry<Integer>&) = delete;
+      private:
+         /// A row together with its hash value.
+         struct HashedRow
+         {
+            std::size_t hash;
+            Row<Integer> row;
+         };
+         struct Hasher
+         {
+            std::size_t operator()(const HashedRow& a) const noexcept { return a.hash; }
+         };
+         struct Equal
+         {
+            bool operator()(const HashedRow& a, const HashedRow& b) const { return a.hash == b.hash && a.row == b.row; }
+         };
+         /// A part of the hashed registry with its own lock.
+         struct Shard
+         {
+            Shard() : mutex(), rows() {}
+            std::mutex mutex;
+            std::unordered_set<HashedRow, Hasher, Equal> rows;
+         };
+         const ClassRegistryType type;
+         mutable std::vector<Shard> shards;
+         mutable std::mutex mutex;
+         mutable std::set<Row<Integer>> ordered_rows;
+         mutable std::atomic<std::size_t> count;
+   };
+}
+
+#include "class_registry.eti"
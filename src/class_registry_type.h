@@ -0,0 +1,15 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+namespace panda
+{
+   enum class ClassRegistryType
+   {
+      Ordered, /// All classes in one lexicographically ordered set behind a single lock.
+      Hashed   /// Classes distributed by hash value over independently locked shards.
+   };
+}
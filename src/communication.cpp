@@ -10,14 +10,17 @@
 
 #ifdef MPI_SUPPORT
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
-#include "cast.h"
 #include "communication.h"
+#include "decimal.h"
 #include "mpi_no_warnings.h"
 
 using namespace panda;
@@ -47,30 +50,55 @@ namespace
    void waitForCompletion(std::mutex&, MPI_Request) noexcept;
    /// Allow other threads to acquire lock.
    void pause();
+   /// Integers that can be copied bytewise are sent in their own width (e.g. int128_t), all others (e.g. AdaptiveInteger) as decimal text.
+   template <typename Integer>
+   using Wire = typename std::conditional<std::is_trivially_copyable<Integer>::value, Integer, char>::type;
+   template <typename Integer>
+   using if_bytewise_t = typename std::enable_if<std::is_trivially_copyable<Integer>::value, int>::type;
+   template <typename Integer>
+   using if_text_t = typename std::enable_if<!std::is_trivially_copyable<Integer>::value, int>::type;
+   /// Conversion to and from the type on the wire, nothing to do if the integers are sent bytewise.
+   template <typename Integer, if_bytewise_t<Integer> = 0>
+   const Matrix<Integer>& encode(const Matrix<Integer>&);
+   template <typename Integer, if_bytewise_t<Integer> = 0>
+   Matrix<Integer> decode(Matrix<Wire<Integer>>);
+   template <typename Integer, if_bytewise_t<Integer> = 0>
+   const Row<Integer>& encode(const Row<Integer>&);
+   template <typename Integer, if_bytewise_t<Integer> = 0>
+   Row<Integer> decode(Row<Wire<Integer>>);
+   /// As text, a row is the decimals of its entries separated by ' ' and a matrix is a single row of text with its rows separated by '\n'.
+   template <typename Integer, if_text_t<Integer> = 0>
+   Matrix<char> encode(const Matrix<Integer>&);
+   template <typename Integer, if_text_t<Integer> = 0>
+   Matrix<Integer> decode(const Matrix<Wire<Integer>>&);
+   template <typename Integer, if_text_t<Integer> = 0>
+   Row<char> encode(const Row<Integer>&);
+   template <typename Integer, if_text_t<Integer> = 0>
+   Row<Integer> decode(const Row<Wire<Integer>>&);
 }
 
 template <typename Integer>
 void panda::Communication::toMaster(const Matrix<Integer>& matrix) const
 {
-   toMaster(cast<int>(matrix));
+   toMasterBytes(encode(matrix));
 }
 
 template <typename Integer>
 Matrix<Integer> panda::Communication::fromSlave(const int id) const
 {
-   return cast<Integer>(fromSlave<int>(id));
+   return decode<Integer>(fromSlaveBytes<Wire<Integer>>(id));
 }
 
 template <typename Integer>
 void panda::Communication::toSlave(const Row<Integer>& row, const int id) const
 {
-   toSlave(cast<int>(row), id);
+   toSlaveBytes(encode(row), id);
 }
 
 template <typename Integer>
 Row<Integer> panda::Communication::fromMaster() const
 {
-   return cast<Integer>(fromMaster<int>());
+   return decode<Integer>(fromMasterBytes<Wire<Integer>>());
 }
 
 /// It needs to be asserted that no Recv blocks a Send and vice versa if
@@ -80,20 +108,20 @@ Row<Integer> panda::Communication::fromMaster() const
 /// non-blocking (Isend). But the send_mutex is only unlocked after the
 /// Isend has actually transferred the data.
 
-template <>
-void panda::Communication::toMaster(const Matrix<int>& matrix) const
+template <typename Integer>
+void panda::Communication::toMasterBytes(const Matrix<Integer>& matrix) const
 {
    std::vector<MPI_Request> requests;
    requests.reserve(2 + matrix.size());
    { // post sends, scoped because we only hold the lock for as long the MPI calls last.
       std::lock_guard<std::mutex> lock(mutex);
       const auto size = matrix.size();
-      const auto row_size = matrix.back().size();
+      const std::size_t row_size = matrix.empty() ? 0 : matrix.back().size();
       requests.emplace_back(send(&size, sizeof(decltype(size)), Master, tag::matrix));
       requests.emplace_back(send(&row_size, sizeof(decltype(row_size)), Master, tag::matrix));
       for ( const auto& row : matrix )
       {
-         const auto bytes = static_cast<int>(row_size * sizeof(int));
+         const auto bytes = static_cast<int>(row_size * sizeof(Integer));
          requests.emplace_back(send(&row.front(), bytes, Master, tag::matrix));
       }
    }
@@ -104,8 +132,8 @@ void panda::Communication::toMaster(const Matrix<int>& matrix) const
    }
 }
 
-template <>
-Matrix<int> panda::Communication::fromSlave(const int id) const
+template <typename Integer>
+Matrix<Integer> panda::Communication::fromSlaveBytes(const int id) const
 {
    for ( ; true; pause() ) // look for matching transmission, but pause to let others acquire lock.
    {
@@ -116,11 +144,11 @@ Matrix<int> panda::Communication::fromSlave(const int id) const
          std::size_t row_size;
          receive(&size, sizeof(decltype(size)), id, tag::matrix);
          receive(&row_size, sizeof(decltype(row_size)), id, tag::matrix);
-         Matrix<int> matrix(size);
+         Matrix<Integer> matrix(size);
          for ( auto& row : matrix )
          {
             row.resize(row_size);
-            const auto bytes = static_cast<int>(row_size * sizeof(int));
+            const auto bytes = static_cast<int>(row_size * sizeof(Integer));
             receive(&row.front(), bytes, id, tag::matrix);
          }
          return matrix;
@@ -128,21 +156,21 @@ Matrix<int> panda::Communication::fromSlave(const int id) const
    }
 }
 
-template <>
-void panda::Communication::toSlave<int>(const Row<int>& row, const int id) const
+template <typename Integer>
+void panda::Communication::toSlaveBytes(const Row<Integer>& row, const int id) const
 {
    MPI_Request request;
    {
       std::lock_guard<std::mutex> lock(mutex);
       const auto begin = row.empty() ? nullptr : &row.front();
-      const auto bytes = static_cast<int>(row.size() * sizeof(int));
+      const auto bytes = static_cast<int>(row.size() * sizeof(Integer));
       request = send(begin, bytes, id, tag::row);
    }
    waitForCompletion(mutex, request);
 }
 
-template <>
-Row<int> panda::Communication::fromMaster<int>() const
+template <typename Integer>
+Row<Integer> panda::Communication::fromMasterBytes() const
 {
    for ( ; true; pause() ) // look for matching transmission, but pause to let others acquire lock.
    {
@@ -153,10 +181,10 @@ Row<int> panda::Communication::fromMaster<int>() const
          MPI_Probe(Master, tag::row, MPI_COMM_WORLD, &status);
          int count;
          MPI_Get_count(&status, MPI_BYTE, &count);
-         const auto row_size = static_cast<std::size_t>(count) / sizeof(int);
-         Row<int> row(row_size);
+         const auto row_size = static_cast<std::size_t>(count) / sizeof(Integer);
+         Row<Integer> row(row_size);
          const auto begin = row.empty() ? nullptr : &row.front();
-         const auto bytes = static_cast<int>(row.size() * sizeof(int));
+         const auto bytes = static_cast<int>(row.size() * sizeof(Integer));
          receive(begin, bytes, Master, tag::row);
          return row;
       }
@@ -210,6 +238,112 @@ namespace
       }
    }
 
+   template <typename Integer, if_bytewise_t<Integer>>
+   const Matrix<Integer>& encode(const Matrix<Integer>& matrix)
+   {
+      return matrix;
+   }
+
+   template <typename Integer, if_bytewise_t<Integer>>
+   Matrix<Integer> decode(Matrix<Wire<Integer>> matrix)
+   {
+      return matrix;
+   }
+
+   template <typename Integer, if_bytewise_t<Integer>>
+   const Row<Integer>& encode(const Row<Integer>& row)
+   {
+      return row;
+   }
+
+   template <typename Integer, if_bytewise_t<Integer>>
+   Row<Integer> decode(Row<Wire<Integer>> row)
+   {
+      return row;
+   }
+
+   template <typename Integer, if_text_t<Integer>>
+   Matrix<char> encode(const Matrix<Integer>& matrix)
+   {
+      if ( matrix.empty() )
+      {
+         return {};
+      }
+      Row<char> text;
+      for ( const auto& row : matrix )
+      {
+         if ( &row != &matrix.front() )
+         {
+            text.push_back('\n');
+         }
+         const auto line = encode(row);
+         text.insert(text.end(), line.begin(), line.end());
+      }
+      return Matrix<char>{text};
+   }
+
+   template <typename Integer, if_text_t<Integer>>
+   Matrix<Integer> decode(const Matrix<Wire<Integer>>& text)
+   {
+      if ( text.size() > 1 )
+      {
+         throw std::invalid_argument("Bad matrix received.");
+      }
+      Matrix<Integer> matrix;
+      if ( !text.empty() )
+      {
+         auto begin = text.front().begin();
+         while ( true )
+         {
+            const auto end = std::find(begin, text.front().end(), '\n');
+            matrix.push_back(decode<Integer>(Row<char>(begin, end)));
+            if ( end == text.front().end() )
+            {
+               break;
+            }
+            begin = end + 1;
+         }
+      }
+      return matrix;
+   }
+
+   template <typename Integer, if_text_t<Integer>>
+   Row<char> encode(const Row<Integer>& row)
+   {
+      Row<char> text;
+      for ( const auto& element : row )
+      {
+         if ( !text.empty() )
+         {
+            text.push_back(' ');
+         }
+         const auto digits = decimal::toString(element);
+         text.insert(text.end(), digits.begin(), digits.end());
+      }
+      return text;
+   }
+
+   template <typename Integer, if_text_t<Integer>>
+   Row<Integer> decode(const Row<Wire<Integer>>& text)
+   {
+      Row<Integer> row;
+      if ( !text.empty() )
+      {
+         auto begin = text.begin();
+         while ( true )
+         {
+            const auto end = std::find(begin, text.end(), ' ');
+            row.push_back(decimal::fromString<Integer>(std::string(begin, end)));
+            if ( end == text.end() )
+            {
+               break;
+            }
+            begin = end + 1;
+         }
+      }
+      return row;
+   }
+
    void pause()
    {
       #if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 7))
@@ -33,19 +33,19 @@ namespace panda
          /// Default constructor.
          Communication() = default;
          #pragma GCC diagnostic pop
+      private:
+         /// The transfers below send the bytes of the integers, so Integer has to be trivially copyable.
+         template <typename Integer>
+         void toSlaveBytes(const Row<Integer>&, const int) const;
+         template <typename Integer>
+         Row<Integer> fromMasterBytes() const;
+         template <typename Integer>
+         void toMasterBytes(const Matrix<Integer>&) const;
+         template <typename Integer>
+         Matrix<Integer> fromSlaveBytes(const int) const;
       private:
          mutable std::mutex mutex;
    };
-
-   template <>
-   void Communication::toMaster<int>(const Matrix<int>&) const;
-   template <>
-   Matrix<int> Communication::fromSlave<int>(const int) const;
-
-   template <>
-   void Communication::toSlave<int>(const Row<int>&, const int) const;
-   template <>
-   Row<int> Communication::fromMaster<int>() const;
 }
 
 #include "communication.eti"
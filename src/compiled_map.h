@@ -0,0 +1,36 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <vector>
+
+#include "maps.h"
+
+namespace panda
+{
+   enum class MapKind
+   {
+      Permutation,        /// Every image is a single coordinate with factor 1, no two images are the same.
+      SignedPermutation,  /// As above, but the factors may also be -1.
+      General             /// Any other (affine) map.
+   };
+
+   /// A map prepared for fast application (see algorithm::compile).
+   /// (Signed) permutations are a gather: entry i of the result is signs[i] times entry indices[i] of the row.
+   /// Other maps are kept as they are.
+   struct CompiledMap
+   {
+      MapKind kind;
+      std::vector<Index> indices;
+      std::vector<Factor> signs;
+      Map map;
+   };
+
+   /// Type alias for compiled maps.
+   using CompiledMaps = std::vector<CompiledMap>;
+}
+
@@ -20,6 +20,10 @@ namespace
 {
    /// Tries to read a number from char*.
    int interpretParameter(char*);
+   /// Tries to read a job scheduler from char*.
+   JobScheduler interpretScheduler(char*);
+   /// Tries to read a class registry type from char*.
+   ClassRegistryType interpretRegistry(char*);
 }
 
 int panda::concurrency::numberOfThreads(int argc, char** argv)
@@ -52,6 +56,32 @@ int panda::concurrency::numberOfThreads(int argc, char** argv)
    return (default_value > 0) ? default_value : 1;
 }
 
+JobScheduler panda::concurrency::jobScheduler(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--job-scheduler=", 16) == 0 )
+      {
+         return interpretScheduler(argv[i] + 16);
+      }
+   }
+   return JobScheduler::SingleQueue; // default value
+}
+
+ClassRegistryType panda::concurrency::classRegistryType(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--class-registry=", 17) == 0 )
+      {
+         return interpretRegistry(argv[i] + 17);
+      }
+   }
+   return ClassRegistryType::Hashed; // default value
+}
+
 namespace
 {
    int interpretParameter(char* string)
@@ -81,5 +111,36 @@ namespace
       }
       return n;
    }
-}
 
+   JobScheduler interpretScheduler(char* string)
+   {
+      assert( string != nullptr );
+      if ( std::strcmp(string, "single") == 0 ||
+           std::strcmp(string, "single-queue") == 0 ||
+           std::strcmp(string, "single_queue") == 0 )
+      {
+         return JobScheduler::SingleQueue;
+      }
+      if ( std::strcmp(string, "ws") == 0 ||
+           std::strcmp(string, "work-stealing") == 0 ||
+           std::strcmp(string, "work_stealing") == 0 )
+      {
+         return JobScheduler::WorkStealing;
+      }
+      throw std::invalid_argument("Command line option \"--job-scheduler=<s>\" expects \"single-queue\" or \"work-stealing\".");
+   }
+
+   ClassRegistryType interpretRegistry(char* string)
+   {
+      assert( string != nullptr );
+      if ( std::strcmp(string, "ordered") == 0 )
+      {
+         return ClassRegistryType::Ordered;
+      }
+      if ( std::strcmp(string, "hashed") == 0 )
+      {
+         return ClassRegistryType::Hashed;
+      }
+      throw std::invalid_argument("Command line option \"--class-registry=<s>\" expects \"hashed\" or \"ordered\".");
+   }
+}
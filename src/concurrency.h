@@ -1,4 +1,3 @@
-
 //-------------------------------------------------------------------------------//
 // Author: Stefan Lörwald, Universität Heidelberg                                //
 // License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
@@ -6,12 +5,18 @@
 
 #pragma once
 
+#include "class_registry_type.h"
+#include "job_scheduler.h"
+
 namespace panda
 {
    namespace concurrency
    {
       /// Returns the number of threads to be used in parallelized operations.
       int numberOfThreads(int, char**);
+      /// Returns the job scheduler used to distribute jobs among threads.
+      JobScheduler jobScheduler(int, char**);
+      /// Returns the kind of registry that holds the classes found by the job pool.
+      ClassRegistryType classRegistryType(int, char**);
    }
 }
-
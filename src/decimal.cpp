@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_DECIMAL
+#include "decimal.h"
+#undef COMPILE_TEMPLATE_DECIMAL
+
+#include <stdexcept>
+
+using namespace panda;
+
+template <typename Integer>
+std::string panda::decimal::toString(const Integer& number)
+{
+   // digits are taken from the truncated quotient, which every integer type computes alike.
+   const Integer ten(10);
+   std::string digits;
+   auto rest = number;
+   do
+   {
+      const auto quotient = rest / ten;
+      const auto digit = static_cast<int>(rest - quotient * ten);
+      digits.push_back(static_cast<char>('0' + (digit < 0 ? -digit : digit)));
+      rest = quotient;
+   }
+   while ( !(rest == Integer(0)) );
+   if ( number < Integer(0) )
+   {
+      digits.push_back('-');
+   }
+   return std::string(digits.rbegin(), digits.rend());
+}
+
+template <typename Integer>
+Integer panda::decimal::fromString(const std::string& digits)
+{
+   const bool negative = ( !digits.empty() && digits[0] == '-' );
+   if ( digits.size() == (negative ? 1u : 0u) )
+   {
+      throw std::invalid_argument("\"" + digits + "\" is not a decimal integer.");
+   }
+   const Integer ten(10);
+   Integer number(0);
+   for ( std::size_t i = negative ? 1 : 0; i < digits.size(); ++i )
+   {
+      if ( digits[i] < '0' || digits[i] > '9' )
+      {
+         throw std::invalid_argument("\"" + digits + "\" is not a decimal integer.");
+      }
+      // accumulate with the final sign, such that the most negative value of a fixed width type fits.
+      const Integer digit(digits[i] - '0');
+      number = negative ? number * ten - digit : number * ten + digit;
+   }
+   return number;
+}
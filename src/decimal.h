@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <string>
+
+namespace panda
+{
+   namespace decimal
+   {
+      /// Returns the decimal digits of an integer of arbitrary width, preceded by '-' if it is negative.
+      template <typename Integer>
+      std::string toString(const Integer&);
+      /// Returns the integer written by toString. Throws std::invalid_argument if the text isn't a decimal integer.
+      template <typename Integer>
+      Integer fromString(const std::string&);
+   }
+}
+
+#include "decimal.eti"
@@ -0,0 +1,209 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_DENSE_MATRIX
+#include "dense_matrix.h"
+#undef COMPILE_TEMPLATE_DENSE_MATRIX
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+using namespace panda;
+
+namespace
+{
+   /// Alignment of the first row.
+   constexpr std::size_t cache_line = 64;
+   /// Rows are padded to a multiple of this number of bytes.
+   constexpr std::size_t row_alignment = 32;
+
+   /// Returns the smallest number of entries not below the number of columns that fills whole blocks of row_alignment bytes.
+   template <typename Integer>
+   std::size_t paddedColumns(const std::size_t columns) noexcept
+   {
+      if ( row_alignment % sizeof(Integer) != 0 )
+      {
+         return columns;
+      }
+      const auto block = row_alignment / sizeof(Integer);
+      return (columns + block - 1) / block * block;
+   }
+
+   /// Returns the first index of the storage whose entry starts on a cache line (or zero if no entry does).
+   template <typename Integer>
+   std::size_t alignedOffset(const std::vector<Integer>& storage) noexcept
+   {
+      const auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+      for ( std::size_t i = 0; i * sizeof(Integer) < cache_line && i < storage.size(); ++i )
+      {
+         if ( (address + i * sizeof(Integer)) % cache_line == 0 )
+         {
+            return i;
+         }
+      }
+      return 0;
+   }
+}
+
+template <typename Integer>
+panda::DenseMatrix<Integer>::RowView::RowView(const Integer* first_, const std::size_t length_) noexcept
+:
+   first(first_),
+   length(length_)
+{
+}
+
+template <typename Integer>
+const Integer* panda::DenseMatrix<Integer>::RowView::begin() const noexcept
+{
+   return first;
+}
+
+template <typename Integer>
+const Integer* panda::DenseMatrix<Integer>::RowView::end() const noexcept
+{
+   return first + length;
+}
+
+template <typename Integer>
+const Integer& panda::DenseMatrix<Integer>::RowView::operator[](const std::size_t i) const noexcept
+{
+   assert( i < length );
+   return first[i];
+}
+
+template <typename Integer>
+std::size_t panda::DenseMatrix<Integer>::RowView::size() const noexcept
+{
+   return length;
+}
+
+template <typename Integer>
+Row<Integer> panda::DenseMatrix<Integer>::RowView::toRow() const
+{
+   return Row<Integer>(begin(), end());
+}
+
+template <typename Integer>
+panda::DenseMatrix<Integer>::DenseMatrix()
+:
+   number_of_rows(0),
+   number_of_columns(0),
+   row_stride(0),
+   offset(0),
+   storage()
+{
+}
+
+template <typename Integer>
+panda::DenseMatrix<Integer>::DenseMatrix(const Matrix<Integer>& matrix)
+:
+   DenseMatrix(matrix.size(), matrix.empty() ? 0 : matrix.front().size())
+{
+   for ( std::size_t i = 0; i < matrix.size(); ++i )
+   {
+      assert( matrix[i].size() == number_of_columns );
+      std::copy(matrix[i].cbegin(), matrix[i].cend(), data(i));
+   }
+}
+
+template <typename Integer>
+panda::DenseMatrix<Integer>::DenseMatrix(const std::size_t rows_, const std::size_t columns_)
+:
+   number_of_rows(rows_),
+   number_of_columns(columns_),
+   row_stride(paddedColumns<Integer>(columns_)),
+   offset(0),
+   storage()
+{
+   if ( rows_ == 0 || columns_ == 0 )
+   {
+      return;
+   }
+   // the allocation has room for shifting the first row onto a cache line.
+   storage.resize(number_of_rows * row_stride + cache_line / sizeof(Integer), Integer(0));
+   offset = alignedOffset(storage);
+}
+
+template <typename Integer>
+panda::DenseMatrix<Integer>::DenseMatrix(const DenseMatrix<Integer>& other)
+:
+   DenseMatrix(other.number_of_rows, other.number_of_columns)
+{
+   for ( std::size_t i = 0; i < number_of_rows; ++i )
+   {
+      std::copy(other.data(i), other.data(i) + number_of_columns, data(i));
+   }
+}
+
+template <typename Integer>
+DenseMatrix<Integer>& panda::DenseMatrix<Integer>::operator=(const DenseMatrix<Integer>& other)
+{
+   if ( this != &other )
+   {
+      DenseMatrix<Integer> copy(other);
+      *this = std::move(copy);
+   }
+   return *this;
+}
+
+template <typename Integer>
+std::size_t panda::DenseMatrix<Integer>::rows() const noexcept
+{
+   return number_of_rows;
+}
+
+template <typename Integer>
+std::size_t panda::DenseMatrix<Integer>::columns() const noexcept
+{
+   return number_of_columns;
+}
+
+template <typename Integer>
+std::size_t panda::DenseMatrix<Integer>::stride() const noexcept
+{
+   return row_stride;
+}
+
+template <typename Integer>
+bool panda::DenseMatrix<Integer>::empty() const noexcept
+{
+   return number_of_rows == 0;
+}
+
+template <typename Integer>
+typename DenseMatrix<Integer>::RowView panda::DenseMatrix<Integer>::operator[](const std::size_t i) const noexcept
+{
+   return RowView(data(i), number_of_columns);
+}
+
+template <typename Integer>
+const Integer* panda::DenseMatrix<Integer>::data(const std::size_t i) const noexcept
+{
+   assert( i < number_of_rows );
+   return storage.data() + offset + i * row_stride;
+}
+
+template <typename Integer>
+Integer* panda::DenseMatrix<Integer>::data(const std::size_t i) noexcept
+{
+   assert( i < number_of_rows );
+   return storage.data() + offset + i * row_stride;
+}
+
+template <typename Integer>
+Matrix<Integer> panda::DenseMatrix<Integer>::toMatrix() const
+{
+   Matrix<Integer> matrix;
+   matrix.reserve(number_of_rows);
+   for ( std::size_t i = 0; i < number_of_rows; ++i )
+   {
+      matrix.push_back((*this)[i].toRow());
+   }
+   return matrix;
+}
+
@@ -0,0 +1,81 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "matrix.h"
+#include "row.h"
+
+namespace panda
+{
+   /// Row-major matrix with all rows in one contiguous allocation.
+   /// Scans over all rows stream through memory instead of following one pointer per row (as for Matrix).
+   /// The first row starts on a cache line and rows are padded with zeros to a multiple of 32 bytes,
+   /// so vectorized kernels may process whole registers (if the size of Integer divides 32).
+   template <typename Integer>
+   class DenseMatrix
+   {
+      public:
+         /// Read-only view of a row of a DenseMatrix (without the padding).
+         class RowView
+         {
+            public:
+               RowView(const Integer*, const std::size_t) noexcept;
+               const Integer* begin() const noexcept;
+               const Integer* end() const noexcept;
+               const Integer& operator[](const std::size_t) const noexcept;
+               std::size_t size() const noexcept;
+               /// Returns a copy of the row.
+               Row<Integer> toRow() const;
+            private:
+               const Integer* first;
+               std::size_t length;
+         };
+         /// Constructor: empty matrix.
+         DenseMatrix();
+         /// Constructor: copy of a matrix, all rows must have the same size.
+         explicit DenseMatrix(const Matrix<Integer>&);
+         /// Constructor: number of rows and columns, all entries are zero.
+         DenseMatrix(const std::size_t, const std::size_t);
+         /// Copy constructor.
+         DenseMatrix(const DenseMatrix<Integer>&);
+         /// Default move constructor.
+         DenseMatrix(DenseMatrix<Integer>&&) = default;
+         /// Copy assignment operator.
+         DenseMatrix<Integer>& operator=(const DenseMatrix<Integer>&);
+         /// Default move assignment operator.
+         DenseMatrix<Integer>& operator=(DenseMatrix<Integer>&&) = default;
+         /// Returns the number of rows.
+         std::size_t rows() const noexcept;
+         /// Returns the number of columns.
+         std::size_t columns() const noexcept;
+         /// Returns the distance of two consecutive rows in memory (in entries, at least the number of columns).
+         std::size_t stride() const noexcept;
+         /// Returns whether there are no rows.
+         bool empty() const noexcept;
+         /// Returns a view of the i-th row.
+         RowView operator[](const std::size_t) const noexcept;
+         /// Returns a pointer to the first entry of the i-th row.
+         const Integer* data(const std::size_t) const noexcept;
+         /// Returns a pointer to the first entry of the i-th row. The padding of the row must stay zero.
+         Integer* data(const std::size_t) noexcept;
+         /// Returns a copy as Matrix.
+         Matrix<Integer> toMatrix() const;
+      private:
+         std::size_t number_of_rows;
+         std::size_t number_of_columns;
+         std::size_t row_stride;
+         /// Index of the first entry of the first row in storage.
+         std::size_t offset;
+         std::vector<Integer> storage;
+   };
+}
+
+#include "dense_matrix.eti"
+
@@ -0,0 +1,322 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "distance_kernels.h"
+
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+   #define DISTANCE_X86_KERNELS
+   #include <immintrin.h>
+#endif
+
+using namespace panda;
+
+namespace
+{
+   /// Collects the rows with extremal scalar product.
+   struct Extremal
+   {
+      void operator()(const std::size_t i, const int64_t value) noexcept
+      {
+         if ( i == 0 || value < smallest )
+         {
+            smallest = value;
+            rows.minimum = i;
+         }
+         if ( i == 0 || value > largest )
+         {
+            largest = value;
+            rows.maximum = i;
+         }
+      }
+      algorithm::ExtremalRows rows;
+      int64_t smallest;
+      int64_t largest;
+   };
+
+   /// Collects the rows with a scalar product of zero.
+   struct Zeros
+   {
+      void operator()(const std::size_t i, const int64_t value)
+      {
+         if ( value == 0 )
+         {
+            indices.push_back(i);
+         }
+      }
+      std::vector<std::size_t>& indices;
+   };
+
+   /// A scan calls the visitor for every row with its scalar product. It returns false on overflow.
+   /// Arguments: first row, number of rows, number of columns, distance of two rows, vector, visitor.
+   template <typename Entry, typename Visitor>
+   using Scan = bool (*)(const Entry*, const std::size_t, const std::size_t, const std::size_t, const Entry*, Visitor&);
+
+   struct Kernels
+   {
+      Scan<int32_t, Extremal> extremal32;
+      Scan<int64_t, Extremal> extremal64;
+      Scan<int32_t, Zeros> zeros32;
+      Scan<int64_t, Zeros> zeros64;
+      const char* name;
+   };
+
+   /// Returns the kernels for the best instruction set of this CPU.
+   const Kernels& kernels() noexcept;
+
+   /// Without vector instructions, the generic code of the caller is just as fast.
+   template <typename Entry, typename Visitor>
+   bool scanScalar(const Entry*, const std::size_t, const std::size_t, const std::size_t, const Entry*, Visitor&)
+   {
+      return false;
+   }
+
+#ifdef DISTANCE_X86_KERNELS
+   /// The kernels don't check single operations. Instead, they bound all intermediate values: a scalar product
+   /// of n entries with absolute values up to a and b (and each of its partial sums) is at most n * a * b in absolute value.
+   /// Returns whether this bound is below the largest value of the entry type (so the smallest value can't occur either).
+   template <typename Entry>
+   bool bounded(const std::size_t columns, const uint64_t a, const uint64_t b) noexcept
+   {
+      const auto limit = static_cast<uint64_t>(std::numeric_limits<Entry>::max());
+      if ( a == 0 || b == 0 )
+      {
+         return true;
+      }
+      return a <= limit / b && columns <= limit / (a * b);
+   }
+
+   /// Returns the largest absolute value of the entries.
+   template <typename Entry>
+   uint64_t magnitude(const Entry* entries, const std::size_t n) noexcept
+   {
+      uint64_t result = 0;
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         const auto value = static_cast<int64_t>(entries[i]);
+         const auto absolute = ( value < 0 ) ? uint64_t{0} - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+         result = ( absolute > result ) ? absolute : result;
+      }
+      return result;
+   }
+
+   /// The 64 bit kernels multiply the lower 32 bits of the entries, so the entries must fit into 32 bits as well.
+   bool bounded64(const std::size_t columns, const uint64_t a, const uint64_t b) noexcept
+   {
+      const auto limit = static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+      return a <= limit && b <= limit && bounded<int64_t>(columns, a, b);
+   }
+
+   __attribute__((target("avx2")))
+   int32_t sum32(const __m256i v)
+   {
+      auto x = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+      x = _mm_add_epi32(x, _mm_shuffle_epi32(x, 0x4E));
+      x = _mm_add_epi32(x, _mm_shuffle_epi32(x, 0xB1));
+      return _mm_cvtsi128_si32(x);
+   }
+
+   __attribute__((target("avx2")))
+   int64_t sum64(const __m256i v)
+   {
+      const auto x = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+      return _mm_cvtsi128_si64(_mm_add_epi64(x, _mm_unpackhi_epi64(x, x)));
+   }
+
+   template <typename Visitor>
+   __attribute__((target("avx2")))
+   bool scanAVX2(const int32_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int32_t* vector, Visitor& visit)
+   {
+      const auto tail = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(columns % 8)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      auto maximum = _mm256_setzero_si256();
+      for ( std::size_t i = 0; i < count; ++i )
+      {
+         const auto row = rows + i * stride;
+         auto sums = _mm256_setzero_si256();
+         for ( std::size_t j = 0; j < columns; j += 8 )
+         {
+            const auto full = ( j + 8 <= columns );
+            const auto a = full ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j)) : _mm256_maskload_epi32(row + j, tail);
+            const auto b = full ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vector + j)) : _mm256_maskload_epi32(vector + j, tail);
+            maximum = _mm256_max_epu32(maximum, _mm256_abs_epi32(a));
+            sums = _mm256_add_epi32(sums, _mm256_mullo_epi32(a, b));
+         }
+         visit(i, sum32(sums));
+      }
+      uint32_t lanes[8];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), maximum);
+      return bounded<int32_t>(columns, magnitude(lanes, 8), magnitude(vector, columns));
+   }
+
+   template <typename Visitor>
+   __attribute__((target("avx2")))
+   bool scanAVX2(const int64_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int64_t* vector, Visitor& visit)
+   {
+      const auto tail = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(columns % 4)), _mm256_setr_epi64x(0, 1, 2, 3));
+      const auto zero = _mm256_setzero_si256();
+      // AVX2 has neither an absolute value nor a maximum of 64 bit lanes. The bitwise or of the one's complement
+      // absolute values (|x| - 1 for negative x) bounds the absolute values up to one.
+      auto bits = _mm256_setzero_si256();
+      for ( std::size_t i = 0; i < count; ++i )
+      {
+         const auto row = rows + i * stride;
+         auto sums = _mm256_setzero_si256();
+         for ( std::size_t j = 0; j < columns; j += 4 )
+         {
+            const auto full = ( j + 4 <= columns );
+            const auto a = full ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j)) : _mm256_maskload_epi64(reinterpret_cast<const long long*>(row + j), tail);
+            const auto b = full ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vector + j)) : _mm256_maskload_epi64(reinterpret_cast<const long long*>(vector + j), tail);
+            bits = _mm256_or_si256(bits, _mm256_xor_si256(a, _mm256_cmpgt_epi64(zero, a)));
+            sums = _mm256_add_epi64(sums, _mm256_mul_epi32(a, b));
+         }
+         visit(i, sum64(sums));
+      }
+      uint64_t lanes[4];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), bits);
+      return bounded64(columns, (lanes[0] | lanes[1] | lanes[2] | lanes[3]) + 1, magnitude(vector, columns));
+   }
+
+   // The unmasked variants of some AVX-512 intrinsics trigger false uninitialized warnings in the headers of some compilers.
+
+   __attribute__((target("avx512f")))
+   int32_t sum32(const __m512i v)
+   {
+      return sum32(_mm256_add_epi32(_mm512_maskz_extracti64x4_epi64(0xF, v, 0), _mm512_maskz_extracti64x4_epi64(0xF, v, 1)));
+   }
+
+   __attribute__((target("avx512f")))
+   int64_t sum64(const __m512i v)
+   {
+      return sum64(_mm256_add_epi64(_mm512_maskz_extracti64x4_epi64(0xF, v, 0), _mm512_maskz_extracti64x4_epi64(0xF, v, 1)));
+   }
+
+   template <typename Visitor>
+   __attribute__((target("avx512f")))
+   bool scanAVX512(const int32_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int32_t* vector, Visitor& visit)
+   {
+      const auto tail = static_cast<__mmask16>((1u << (columns % 16)) - 1);
+      const auto all = static_cast<__mmask16>(0xFFFF);
+      auto maximum = _mm512_setzero_si512();
+      for ( std::size_t i = 0; i < count; ++i )
+      {
+         const auto row = rows + i * stride;
+         auto sums = _mm512_setzero_si512();
+         for ( std::size_t j = 0; j < columns; j += 16 )
+         {
+            const auto mask = ( j + 16 <= columns ) ? all : tail;
+            const auto a = _mm512_maskz_loadu_epi32(mask, row + j);
+            const auto b = _mm512_maskz_loadu_epi32(mask, vector + j);
+            maximum = _mm512_maskz_max_epu32(all, maximum, _mm512_maskz_abs_epi32(all, a));
+            sums = _mm512_add_epi32(sums, _mm512_mullo_epi32(a, b));
+         }
+         visit(i, sum32(sums));
+      }
+      uint32_t lanes[16];
+      _mm512_storeu_si512(lanes, maximum);
+      return bounded<int32_t>(columns, magnitude(lanes, 16), magnitude(vector, columns));
+   }
+
+   template <typename Visitor>
+   __attribute__((target("avx512f")))
+   bool scanAVX512(const int64_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int64_t* vector, Visitor& visit)
+   {
+      const auto tail = static_cast<__mmask8>((1u << (columns % 8)) - 1);
+      const auto all = static_cast<__mmask8>(0xFF);
+      auto maximum = _mm512_setzero_si512();
+      for ( std::size_t i = 0; i < count; ++i )
+      {
+         const auto row = rows + i * stride;
+         auto sums = _mm512_setzero_si512();
+         for ( std::size_t j = 0; j < columns; j += 8 )
+         {
+            const auto mask = ( j + 8 <= columns ) ? all : tail;
+            const auto a = _mm512_maskz_loadu_epi64(mask, row + j);
+            const auto b = _mm512_maskz_loadu_epi64(mask, vector + j);
+            maximum = _mm512_maskz_max_epu64(all, maximum, _mm512_maskz_abs_epi64(all, a));
+            sums = _mm512_add_epi64(sums, _mm512_maskz_mul_epi32(all, a, b));
+         }
+         visit(i, sum64(sums));
+      }
+      uint64_t lanes[8];
+      _mm512_storeu_si512(lanes, maximum);
+      return bounded64(columns, magnitude(lanes, 8), magnitude(vector, columns));
+   }
+#endif
+
+   Kernels selectKernels() noexcept
+   {
+      #ifdef DISTANCE_X86_KERNELS
+         __builtin_cpu_init();
+         if ( __builtin_cpu_supports("avx512f") )
+         {
+            return Kernels{scanAVX512<Extremal>, scanAVX512<Extremal>, scanAVX512<Zeros>, scanAVX512<Zeros>, "avx512"};
+         }
+         if ( __builtin_cpu_supports("avx2") )
+         {
+            return Kernels{scanAVX2<Extremal>, scanAVX2<Extremal>, scanAVX2<Zeros>, scanAVX2<Zeros>, "avx2"};
+         }
+      #endif
+      return Kernels{scanScalar<int32_t, Extremal>, scanScalar<int64_t, Extremal>, scanScalar<int32_t, Zeros>, scanScalar<int64_t, Zeros>, "scalar"};
+   }
+
+   const Kernels& kernels() noexcept
+   {
+      static const Kernels selected = selectKernels();
+      return selected;
+   }
+
+   template <typename Entry>
+   bool extremal(const Scan<Entry, Extremal> scan, const Entry* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const Entry* vector, algorithm::ExtremalRows& result) noexcept
+   {
+      Extremal visit{};
+      if ( count == 0 || !scan(rows, count, columns, stride, vector, visit) )
+      {
+         return false;
+      }
+      result = visit.rows;
+      return true;
+   }
+
+   template <typename Entry>
+   bool zeros(const Scan<Entry, Zeros> scan, const Entry* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const Entry* vector, std::vector<std::size_t>& indices)
+   {
+      indices.clear();
+      Zeros visit{indices};
+      if ( !scan(rows, count, columns, stride, vector, visit) )
+      {
+         indices.clear();
+         return false;
+      }
+      return true;
+   }
+}
+
+bool panda::algorithm::extremalScalarProducts(const int32_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int32_t* vector, ExtremalRows& result) noexcept
+{
+   return extremal(kernels().extremal32, rows, count, columns, stride, vector, result);
+}
+
+bool panda::algorithm::extremalScalarProducts(const int64_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int64_t* vector, ExtremalRows& result) noexcept
+{
+   return extremal(kernels().extremal64, rows, count, columns, stride, vector, result);
+}
+
+bool panda::algorithm::zeroScalarProducts(const int32_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int32_t* vector, std::vector<std::size_t>& indices)
+{
+   return zeros(kernels().zeros32, rows, count, columns, stride, vector, indices);
+}
+
+bool panda::algorithm::zeroScalarProducts(const int64_t* rows, const std::size_t count, const std::size_t columns, const std::size_t stride, const int64_t* vector, std::vector<std::size_t>& indices)
+{
+   return zeros(kernels().zeros64, rows, count, columns, stride, vector, indices);
+}
+
+const char* panda::algorithm::distanceKernelInstructionSet() noexcept
+{
+   return kernels().name;
+}
+
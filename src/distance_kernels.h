@@ -0,0 +1,44 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace panda
+{
+   namespace algorithm
+   {
+      /// Indices of the first rows with the smallest and with the largest scalar product.
+      struct ExtremalRows
+      {
+         std::size_t minimum;
+         std::size_t maximum;
+      };
+      /// The kernels below compute the scalar products of all rows of a row-major matrix with a vector in one pass.
+      /// Arguments: first row, number of rows, number of columns, distance of two rows (in entries), vector.
+      /// Instead of checking each operation, the kernels bound all intermediate values by (columns * largest absolute
+      /// row entry * largest absolute vector entry). If this bound doesn't fit into the entry type, the kernels return
+      /// false and the caller has to use the generic arithmetic instead (which then shows the usual behaviour of the
+      /// type on overflow). Hence the smallest value of the entry type never occurs as a product.
+      /// The 64 bit kernels multiply 32 bit halves, hence they also give up on entries beyond 32 bits.
+      /// Without AVX2 or AVX-512 the kernels always return false.
+
+      /// Finds the rows with extremal scalar product (the first one on ties).
+      bool extremalScalarProducts(const int32_t*, const std::size_t, const std::size_t, const std::size_t, const int32_t*, ExtremalRows&) noexcept;
+      /// Same as above for 64 bit entries.
+      bool extremalScalarProducts(const int64_t*, const std::size_t, const std::size_t, const std::size_t, const int64_t*, ExtremalRows&) noexcept;
+      /// Stores the (ascending) indices of the rows with a scalar product of zero. The indices are cleared on failure.
+      bool zeroScalarProducts(const int32_t*, const std::size_t, const std::size_t, const std::size_t, const int32_t*, std::vector<std::size_t>&);
+      /// Same as above for 64 bit entries.
+      bool zeroScalarProducts(const int64_t*, const std::size_t, const std::size_t, const std::size_t, const int64_t*, std::vector<std::size_t>&);
+      /// Returns the name of the instruction set used for the kernels ("avx512", "avx2" or "scalar").
+      const char* distanceKernelInstructionSet() noexcept;
+   }
+}
+
@@ -0,0 +1,85 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_EQUIVALENCE_INDEX
+#include "equivalence_index.h"
+#undef COMPILE_TEMPLATE_EQUIVALENCE_INDEX
+
+#include <stdexcept>
+
+#include "algorithm_classes.h"
+#include "algorithm_map_operations.h"
+#include "algorithm_row_operations.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Number of independently locked parts of the index.
+   /// Should be well above the number of threads to make collisions on a lock unlikely.
+   constexpr std::size_t number_of_shards = 256;
+}
+
+template <typename Integer, typename TagType>
+bool panda::EquivalenceIndex<Integer, TagType>::insert(const Row<Integer>& row) const
+{
+   const auto key = algorithm::canonicalForm(row, deterministics);
+   const auto fingerprint = algorithm::fingerprint(row, deterministics);
+   auto& shard = shards[Hasher()(fingerprint) % shards.size()];
+   std::lock_guard<std::mutex> lock(shard.mutex);
+   // an empty key never matches in checkEquivalenceMaps, such a row is always new.
+   if ( !key.empty() )
+   {
+      if ( shard.keys.count(key) > 0 )
+      {
+         return false;
+      }
+      shard.keys.insert(key);
+      // images with a different fingerprint fail the tally check of checkEquivalenceMaps.
+      for ( const auto& map : maps )
+      {
+         const auto image = algorithm::apply(map, row, TagType{});
+         if ( algorithm::fingerprint(image, deterministics) == fingerprint )
+         {
+            shard.keys.insert(algorithm::canonicalForm(image, deterministics));
+         }
+      }
+   }
+   ++shard.rows;
+   return true;
+}
+
+template <typename Integer, typename TagType>
+std::size_t panda::EquivalenceIndex<Integer, TagType>::size() const
+{
+   std::size_t result = 0;
+   for ( auto& shard : shards )
+   {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += shard.rows;
+   }
+   return result;
+}
+
+template <typename Integer, typename TagType>
+panda::EquivalenceIndex<Integer, TagType>::EquivalenceIndex(const Deterministics<Integer>& deterministics_, const Maps& maps_)
+:
+   deterministics(deterministics_),
+   maps(algorithm::compile(maps_, TagType{})),
+   shards(number_of_shards)
+{
+   if ( deterministics.empty() )
+   {
+      throw std::invalid_argument("The equivalence test needs at least one deterministic point.");
+   }
+}
+
+template <typename Integer, typename TagType>
+std::size_t panda::EquivalenceIndex<Integer, TagType>::Hasher::operator()(const Row<Integer>& key) const noexcept
+{
+   return algorithm::hash(key);
+}
+
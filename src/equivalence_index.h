@@ -0,0 +1,64 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "compiled_map.h"
+#include "dense_matrix.h"
+#include "maps.h"
+#include "matrix.h"
+#include "row.h"
+#include "tags.h"
+
+namespace panda
+{
+   /// Thread-safe set of class representatives for adjacency decomposition with deterministic points.
+   /// For each registered row, the exact keys (see algorithm::canonicalForm) of the row and of its images
+   /// under the maps are stored, so the equivalence test of algorithm::checkEquivalenceMaps is a single lookup.
+   /// Rows with equal fingerprints (see algorithm::fingerprint) always end up in the same independently locked shard.
+   template <typename Integer, typename TagType>
+   class EquivalenceIndex
+   {
+      public:
+         /// Registers a row unless an equivalent row was registered before. Returns true if the row is new.
+         bool insert(const Row<Integer>&) const;
+         /// Returns the number of registered rows.
+         std::size_t size() const;
+         /// Constructor. The arguments are the deterministic points and the maps used for the equivalence test.
+         /// Throws std::invalid_argument if there are no deterministic points.
+         EquivalenceIndex(const Deterministics<Integer>&, const Maps&);
+         /// Copy construction is not allowed.
+         EquivalenceIndex(const EquivalenceIndex<Integer, TagType>&) = delete;
+         /// Copy assignment is not allowed.
+         EquivalenceIndex<Integer, TagType>& operator=(const EquivalenceIndex<Integer, TagType>&) = delete;
+      private:
+         struct Hasher
+         {
+            std::size_t operator()(const Row<Integer>&) const noexcept;
+         };
+         /// A part of the index with its own lock.
+         struct Shard
+         {
+            Shard() : mutex(), keys(), rows(0) {}
+            std::mutex mutex;
+            std::unordered_set<Row<Integer>, Hasher> keys;
+            std::size_t rows;
+         };
+         /// the deterministic points in contiguous memory, as every insertion multiplies them with several rows.
+         const DenseMatrix<Integer> deterministics;
+         /// the maps, compiled once for all tests.
+         const CompiledMaps maps;
+         mutable std::vector<Shard> shards;
+   };
+}
+
+#include "equivalence_index.eti"
+
@@ -77,6 +77,57 @@ namespace
                 << "t./" << project::binary_name << " myproblem -k my_known_facets --checked\n";
    }
 
+   void printHelpCommandCheckpoint()
+   {
+      std::cout << "Adjacency decomposition may run for a long time. To avoid losing all progress if the process is killed, the state of the job pool can be saved periodically.\n"
+                << "A checkpoint contains all classes found so far and the classes that weren't completely processed yet. It is written in the background, replacing the previous checkpoint.\n"
+                << "Use the \"--checkpoint=\" command to name the checkpoint file and \"--checkpoint-interval=\" to set the seconds between two checkpoints (default: 600).\n"
+                << "Use the \"--resume=\" command to continue from a checkpoint. The problem file and the options must be the same as in the original run.\n"
+                << "Classes of the checkpoint are printed again, unfinished classes are processed.\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --checkpoint=myproblem.chk\n"
+                << "\t./" << project::binary_name << " myproblem --checkpoint=myproblem.chk --checkpoint-interval=3600\n"
+                << "\t./" << project::binary_name << " myproblem --resume=myproblem.chk --checkpoint=myproblem.chk\n";
+   }
+
+   void printHelpCommandClassRegistry()
+   {
+      std::cout << "In adjacency decomposition, every class found by any thread is compared with all classes found before.\n"
+                << "By default, the classes are held in a hashed registry that is split into shards with a lock each, so threads rarely wait for each other.\n"
+                << "The ordered registry keeps all classes in a single sorted set that is guarded by one lock.\n"
+                << "Both registries find the same classes.\n"
+                << "Use the \"--class-registry=\" command with either \"hashed\" or \"ordered\".\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --class-registry=ordered\n"
+                << "\t./" << project::binary_name << " myproblem --class-registry=hashed -t 64\n";
+   }
+
+   void printHelpCommandDoubleDescriptionOrder()
+   {
+      std::cout << "The double description method starts with a simplex of the input and inserts the remaining input rows one by one.\n"
+                << "The size of the intermediate systems, and hence the running time, depends a lot on the order of insertion.\n"
+                << "Use the \"--dd-order=\" command with one of the following options:\n"
+                << "\t\"minindex\": in order of input (default).\n"
+                << "\t\"maxindex\": in reverse order of input.\n"
+                << "\t\"lexmin\": lexicographically smallest row first.\n"
+                << "\t\"mincutoff\": in every step, the row that removes the fewest rows from the current system.\n"
+                << "\t\"random\": in a pseudo-random order, which is the same in every run.\n"
+                << "The insertion order is applied after the sorting of the input (see \"--sorting\").\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem -m dd --dd-order=mincutoff\n"
+                << "\t./" << project::binary_name << " myproblem -m dd --dd-order=lexmin -t 4\n";
+   }
+
+   void printHelpCommandFlushInterval()
+   {
+      std::cout << "In adjacency decomposition, the results are written by a separate thread, such that the computing threads never wait for the output.\n"
+                << "The writer collects the results and flushes the output periodically. By default, the output is flushed every 100 milliseconds.\n"
+                << "Use the \"--flush-interval=\" command to change the time between two flushes. Only positive integral parameters (milliseconds) are allowed.\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --flush-interval=1000\n"
+                << "\t./" << project::binary_name << " myproblem --flush-interval=10 --output=myresults\n";
+   }
+
    void printHelpCommandHelp()
    {
       std::cout << "To get an overview on available commands, call ./" << project::binary_name << " --help\n"
@@ -108,6 +159,33 @@ namespace
                 << "\t./" << project::binary_name << " myproblem --integer-type=64\n";
    }
 
+   void printHelpCommandJobOrder()
+   {
+      std::cout << "In adjacency decomposition, the classes found are queued as jobs. By default, the jobs are processed in the order they were found (\"fifo\").\n"
+                << "Processing cheap jobs first (e.g. facets with few vertices) often finds all classes much sooner, while the most degenerate jobs are left for the end.\n"
+                << "Use the \"--job-order=\" command with one of the following options:\n"
+                << "\t\"fifo\": in order of discovery.\n"
+                << "\t\"inc_asc\" / \"incidence_ascending\": jobs incident with few input rows (vertices of a facet / inequalities of a vertex) first.\n"
+                << "\t\"inc_desc\" / \"incidence_descending\": jobs incident with many input rows first.\n"
+                << "\t\"score:<w1>,<w2>,...\": jobs with a low score first. The score of a job is the sum of its entries weighted with the given integers (one per entry of a job, including the right hand side).\n"
+                << "Job orders other than \"fifo\" require the single queue job scheduler.\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --job-order=inc_asc\n"
+                << "\t./" << project::binary_name << " myproblem --job-order=score:0,0,1,-1\n";
+   }
+
+   void printHelpCommandJobScheduler()
+   {
+      std::cout << "In adjacency decomposition, every thread repeatedly takes a job (a facet / vertex) from a common pool and puts the adjacent classes back.\n"
+                << "By default, the pool is a single queue that is guarded by one lock. With many threads, the threads may spend a lot of time waiting for this lock.\n"
+                << "The work-stealing scheduler gives each thread its own queue. A thread without jobs steals from the queue of another thread.\n"
+                << "Both schedulers find the same classes, but the order of processing (and output) differs.\n"
+                << "Use the \"--job-scheduler=\" command with either \"single-queue\" / \"single\" or \"work-stealing\" / \"ws\".\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --job-scheduler=work-stealing\n"
+                << "\t./" << project::binary_name << " myproblem --job-scheduler=ws -t 64\n";
+   }
+
    void printHelpCommandKnownData()
    {
       std::cout << "Adjacency decomposition needs at least one initial facet / vertex to calculate neighbors of.\n"
@@ -143,6 +221,29 @@ namespace
                 << "\t./" << project::binary_name << " myproblem --method=ad\n";
    }
 
+   void printHelpCommandOutput()
+   {
+      std::cout << "By default, the results of adjacency decomposition are written to standard output.\n"
+                << "Use the \"--output=\" command to write them to a file instead. An existing file of the same name is overwritten.\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --output=myresults\n"
+                << "\t./" << project::binary_name << " myproblem --output=myresults -t 64\n";
+   }
+
+   void printHelpCommandRecursion()
+   {
+      std::cout << "In adjacency decomposition, the neighbours of a facet are found by rotating it around its ridges. The ridges are the facets of the facet.\n"
+                << "By default, they are found by Fourier-Motzkin elimination on the vertices of the facet. For very degenerate facets, this is as hard as the original problem.\n"
+                << "With a recursion depth greater zero, the ridges of facets with more vertices than the threshold are found by adjacency decomposition of the facet instead.\n"
+                << "Then only one ridge per class under the maps that keep the facet in place is rotated. The recursion depth limits how often this is nested.\n"
+                << "Only the given maps that keep the facet in place are used, not products of other maps that do. Hence, the ridges may fall into more classes than necessary.\n"
+                << "The result is the same, but more ridges are rotated. Listing more maps than needed (e.g. all transpositions instead of two generators) lets more of them keep a facet in place.\n"
+                << "Use the \"--recursion-depth=\" command to set the depth (default: 0, no recursion) and \"--recursion-threshold=\" to set the number of vertices (default: 100).\n"
+                << "Example usage:\n"
+                << "\t./" << project::binary_name << " myproblem --recursion-depth=1\n"
+                << "\t./" << project::binary_name << " myproblem --recursion-depth=2 --recursion-threshold=500\n";
+   }
+
    void printHelpCommandSorting()
    {
       std::cout << "An important implementation detail of " << project::application_acronym << " is the usage of double description method (either explicitely wanted by the user, or implicitely used in adjacency decomposition).\n"
@@ -166,6 +267,7 @@ namespace
       std::cout << "Adjacency decomposition (the default algorithm of " << project::application_acronym << ") is a parallel algorithm.\n"
                 << "By default, it uses as many cores your system provides.\n"
                 << "However, you may still specify a lower or higher number of threads, e.g. to allow other jobs to work simultaneously.\n"
+                << "The double description method uses the same number of threads for its elimination steps. Its result doesn't depend on the number of threads.\n"
                 << "Use the \"-t\" / \"--threads=\" command. Only positive integral parameters are allowed.\n"
                 << "Example usage:\n"
                 << "\t./" << project::binary_name << " myproblem -t 1\n"
@@ -189,6 +291,22 @@ namespace
       {
          printHelpCommandCheck();
       }
+      else if ( command == "checkpoint" || command == "--checkpoint" || command == "checkpoint-interval" || command == "--checkpoint-interval" || command == "resume" || command == "--resume" )
+      {
+         printHelpCommandCheckpoint();
+      }
+      else if ( command == "class-registry" || command == "--class-registry" )
+      {
+         printHelpCommandClassRegistry();
+      }
+      else if ( command == "dd-order" || command == "--dd-order" )
+      {
+         printHelpCommandDoubleDescriptionOrder();
+      }
+      else if ( command == "flush-interval" || command == "--flush-interval" )
+      {
+         printHelpCommandFlushInterval();
+      }
       else if ( command == "h" || command == "-h" || command == "--h" || command == "help" || command == "-help" || command == "--help" || command == "?" )
       {
          printHelpCommandHelp();
@@ -197,6 +315,14 @@ namespace
       {
          printHelpCommandIntegerType();
       }
+      else if ( command == "job-order" || command == "--job-order" )
+      {
+         printHelpCommandJobOrder();
+      }
+      else if ( command == "job-scheduler" || command == "--job-scheduler" )
+      {
+         printHelpCommandJobScheduler();
+      }
       else if ( command == "k" || command == "-k" || command == "known_facets" || command == "--known_facets" || command == "known_vertices" || command == "--known_vertices" || command == "known_data" || command == "--known_data" )
       {
          printHelpCommandKnownData();
@@ -205,6 +331,14 @@ namespace
       {
          printHelpCommandMethod();
       }
+      else if ( command == "output" || command == "--output" )
+      {
+         printHelpCommandOutput();
+      }
+      else if ( command == "recursion-depth" || command == "--recursion-depth" || command == "recursion-threshold" || command == "--recursion-threshold" )
+      {
+         printHelpCommandRecursion();
+      }
       else if ( command == "s" || command == "-s" || command == "sorting" || command == "--sorting" )
       {
          printHelpCommandSorting();
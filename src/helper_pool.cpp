@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "helper_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace panda;
+
+void panda::HelperPool::run(const std::function<void()>& function, const std::size_t helpers) const
+{
+   Task task{&function, std::min(helpers, threads.size()), 0, nullptr};
+   if ( task.open == 0 )
+   {
+      function();
+      return;
+   }
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push_back(&task);
+   }
+   if ( task.open == 1 )
+   {
+      queued.notify_one();
+   }
+   else
+   {
+      queued.notify_all();
+   }
+   std::exception_ptr error;
+   try
+   {
+      function();
+   }
+   catch ( ... )
+   {
+      error = std::current_exception();
+   }
+   {
+      // helpers that didn't pick up the task yet won't get it, the ones that did are waited for (they use the stack of the caller).
+      std::unique_lock<std::mutex> lock(mutex);
+      const auto position = std::find(tasks.begin(), tasks.end(), &task);
+      if ( position != tasks.end() )
+      {
+         tasks.erase(position);
+      }
+      finished.wait(lock, [&task]() { return task.running == 0; });
+   }
+   if ( !error )
+   {
+      error = task.error;
+   }
+   if ( error )
+   {
+      std::rethrow_exception(error);
+   }
+}
+
+std::size_t panda::HelperPool::size() const noexcept
+{
+   return threads.size();
+}
+
+panda::HelperPool::HelperPool(const std::size_t size)
+:
+   mutex(),
+   queued(),
+   finished(),
+   tasks(),
+   stopping(false),
+   threads()
+{
+   for ( std::size_t i = 0; i < size; ++i )
+   {
+      threads.emplace_back(&HelperPool::help, this);
+   }
+}
+
+panda::HelperPool::~HelperPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      assert( tasks.empty() );
+      stopping = true;
+   }
+   queued.notify_all();
+   threads.clear();
+}
+
+void panda::HelperPool::help()
+{
+   std::unique_lock<std::mutex> lock(mutex);
+   while ( true )
+   {
+      queued.wait(lock, [this]() { return stopping || !tasks.empty(); });
+      if ( stopping )
+      {
+         return;
+      }
+      const auto task = tasks.front();
+      if ( --task->open == 0 )
+      {
+         tasks.pop_front();
+      }
+      ++task->running;
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+         (*task->function)();
+      }
+      catch ( ... )
+      {
+         error = std::current_exception();
+      }
+      lock.lock();
+      if ( error && !task->error )
+      {
+         task->error = error;
+      }
+      if ( --task->running == 0 )
+      {
+         finished.notify_all();
+      }
+   }
+}
@@ -0,0 +1,64 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <list>
+#include <mutex>
+
+#include "joining_thread.h"
+
+namespace panda
+{
+   /// Threads that help a worker with the parts of its job that can be done concurrently.
+   /// The threads are started once and sleep while there is nothing to help with.
+   class HelperPool
+   {
+      public:
+         /// Runs the task on the caller and concurrently on up to the given number of helper threads.
+         /// Returns once all of them are done. Helpers that don't pick up the task before the caller is done
+         /// don't run it at all, hence, the task has to share its work dynamically (e.g. with a common counter).
+         /// The first exception thrown by any of them is rethrown.
+         void run(const std::function<void()>&, const std::size_t) const;
+         /// Returns the number of helper threads.
+         std::size_t size() const noexcept;
+         /// Constructor. The argument is the number of helper threads.
+         explicit HelperPool(const std::size_t);
+         /// Destructor. Waits for the helper threads to stop. Tasks mustn't run anymore.
+         ~HelperPool();
+         /// Copy construction is not allowed.
+         HelperPool(const HelperPool&) = delete;
+         /// Copy assignment is not allowed.
+         HelperPool& operator=(const HelperPool&) = delete;
+      private:
+         /// A task of a caller that waits for helpers.
+         struct Task
+         {
+            const std::function<void()>* function;
+            /// number of helpers that may still pick up the task.
+            std::size_t open;
+            /// number of helpers that run the task.
+            std::size_t running;
+            std::exception_ptr error;
+         };
+         mutable std::mutex mutex;
+         /// wakes the helpers if a task is queued.
+         mutable std::condition_variable queued;
+         /// wakes the callers if a helper is done.
+         mutable std::condition_variable finished;
+         mutable std::deque<Task*> tasks;
+         bool stopping;
+         /// vital implementation detail: the threads access the other members, hence, they are declared last (destroyed first).
+         std::list<JoiningThread> threads;
+      private:
+         /// Main loop of a helper thread.
+         void help();
+   };
+}
@@ -493,10 +493,11 @@ namespace
       {
          throw std::invalid_argument("The system of inequalities cannot be a reduced system without any maps. Maps must be declared before the section of inequalities.");
       }
+      const auto compiled_maps = algorithm::compile(maps, tag::facet{});
       Matrix<int> all;
       for ( const auto& row : matrix )
       {
-         const auto row_class = algorithm::getClass(row, maps, tag::facet{});
+         const auto row_class = algorithm::getClass(row, compiled_maps, tag::facet{});
          all.reserve(all.size() + row_class.size());
          all.insert(all.end(), row_class.cbegin(), row_class.cend());
       }
@@ -509,10 +510,11 @@ namespace
       {
          throw std::invalid_argument("The system of vertices / rays cannot be a reduced system without any maps. Maps must be declared before the section of vertices / rays.");
       }
+      const auto compiled_maps = algorithm::compile(maps, tag::vertex{});
       Matrix<int> all;
       for ( const auto& row : matrix )
       {
-         const auto row_class = algorithm::getClass(row, maps, tag::vertex{});
+         const auto row_class = algorithm::getClass(row, compiled_maps, tag::vertex{});
          all.reserve(all.size() + row_class.size());
          all.insert(all.end(), row_class.cbegin(), row_class.cend());
       }
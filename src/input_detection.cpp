@@ -32,6 +32,8 @@ namespace
    bool requiresParameter(char*) noexcept;
    std::set<Keyword> keywords(const PositionGuardedFile&);
    InputOrder inputOrder(char*);
+   JobOrder jobOrder(char*);
+   InsertionOrder insertionOrder(char*);
    OperationMode commandLineModeOption(int, char**) noexcept;
 }
 
@@ -90,6 +92,30 @@ InputOrder panda::getInputOrder(int argc, char** argv)
    return InputOrder::NoSorting;
 }
 
+JobOrder panda::getJobOrder(int argc, char** argv)
+{
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--job-order=", 12) == 0 )
+      {
+         return jobOrder(argv[i] + 12);
+      }
+   }
+   return JobOrder{JobOrderType::Fifo, {}};
+}
+
+InsertionOrder panda::getInsertionOrder(int argc, char** argv)
+{
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--dd-order=", 11) == 0 )
+      {
+         return insertionOrder(argv[i] + 11);
+      }
+   }
+   return InsertionOrder::MinIndex;
+}
+
 OperationMode panda::detectOperationMode(int argc, char** argv)
 {
    const auto cmd_mode = commandLineModeOption(argc, argv);
@@ -223,6 +249,79 @@ namespace
       throw std::invalid_argument("Expected an argument to option \"--sorting\".\n");
    }
 
+   JobOrder jobOrder(char* argument)
+   {
+      if ( std::strcmp(argument, "fifo") == 0 )
+      {
+         return JobOrder{JobOrderType::Fifo, {}};
+      }
+      if ( std::strcmp(argument, "inc_asc") == 0 || std::strcmp(argument, "incidence_ascending") == 0 )
+      {
+         return JobOrder{JobOrderType::IncidenceAscending, {}};
+      }
+      if ( std::strcmp(argument, "inc_desc") == 0 || std::strcmp(argument, "incidence_descending") == 0 )
+      {
+         return JobOrder{JobOrderType::IncidenceDescending, {}};
+      }
+      if ( std::strncmp(argument, "score:", 6) == 0 )
+      {
+         JobOrder order{JobOrderType::Score, {}};
+         std::string weights(argument + 6);
+         std::size_t begin = 0;
+         while ( begin <= weights.size() )
+         {
+            auto end = weights.find(',', begin);
+            if ( end == std::string::npos )
+            {
+               end = weights.size();
+            }
+            const auto token = weights.substr(begin, end - begin);
+            std::size_t parsed = 0;
+            int weight = 0;
+            try
+            {
+               weight = std::stoi(token, &parsed);
+            }
+            catch ( const std::exception& )
+            {
+            }
+            if ( token.empty() || parsed != token.size() )
+            {
+               throw std::invalid_argument("Option \"--job-order=score:<w1>,<w2>,...\" expects a comma separated list of integral weights.");
+            }
+            order.weights.push_back(weight);
+            begin = end + 1;
+         }
+         return order;
+      }
+      throw std::invalid_argument("Expected an argument to option \"--job-order\".\n");
+   }
+
+   InsertionOrder insertionOrder(char* argument)
+   {
+      if ( std::strcmp(argument, "minindex") == 0 )
+      {
+         return InsertionOrder::MinIndex;
+      }
+      if ( std::strcmp(argument, "maxindex") == 0 )
+      {
+         return InsertionOrder::MaxIndex;
+      }
+      if ( std::strcmp(argument, "lexmin") == 0 )
+      {
+         return InsertionOrder::LexMin;
+      }
+      if ( std::strcmp(argument, "mincutoff") == 0 )
+      {
+         return InsertionOrder::MinCutoff;
+      }
+      if ( std::strcmp(argument, "random") == 0 )
+      {
+         return InsertionOrder::Random;
+      }
+      throw std::invalid_argument("Expected an argument to option \"--dd-order\".\n");
+   }
+
    OperationMode commandLineModeOption(int argc, char** argv) noexcept
    {
       if ( argc == 1 )
@@ -8,6 +8,8 @@
 
 #include "filename.h"
 #include "input_order.h"
+#include "insertion_order.h"
+#include "job_order.h"
 #include "operation_mode.h"
 
 namespace panda
@@ -16,6 +18,10 @@ namespace panda
    Filename getFilename(int, char**);
    /// Returns the user-provided order of input.
    InputOrder getInputOrder(int, char**);
+   /// Returns the user-provided order of jobs in adjacency decomposition.
+   JobOrder getJobOrder(int, char**);
+   /// Returns the user-provided insertion order of the double description method.
+   InsertionOrder getInsertionOrder(int, char**);
    /// Returns the user-provided operation mode.
    OperationMode detectOperationMode(int, char**);
 }
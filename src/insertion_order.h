@@ -0,0 +1,21 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+namespace panda
+{
+   /// Order in which the double description method inserts the input rows after the initial simplex.
+   enum class InsertionOrder
+   {
+      MinIndex,   /// In order of input.
+      MaxIndex,   /// In reverse order of input.
+      LexMin,     /// Lexicographically smallest row first.
+      MinCutoff,  /// The row that cuts off the fewest rows of the current system first (chosen anew in every step).
+      Random      /// In a pseudo-random order that is the same in every run.
+   };
+}
+
@@ -0,0 +1,69 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "int128.h"
+
+#ifdef __SIZEOF_INT128__
+
+#include <cctype>
+#include <iostream>
+#include <limits>
+#include <string>
+
+using namespace panda;
+
+std::ostream& operator<<(std::ostream& stream, const int128_t value)
+{
+   auto magnitude = (value < 0) ? -static_cast<uint128_t>(value) : static_cast<uint128_t>(value);
+   std::string digits;
+   do
+   {
+      digits.insert(digits.begin(), static_cast<char>('0' + static_cast<int>(magnitude % 10)));
+      magnitude /= 10;
+   }
+   while ( magnitude != 0 );
+   if ( value < 0 )
+   {
+      digits.insert(digits.begin(), '-');
+   }
+   return (stream << digits);
+}
+
+std::istream& operator>>(std::istream& stream, int128_t& value)
+{
+   std::istream::sentry sentry(stream);
+   if ( !sentry )
+   {
+      return stream;
+   }
+   const bool negative = ( stream.peek() == '-' );
+   if ( negative || stream.peek() == '+' )
+   {
+      stream.get();
+   }
+   if ( !std::isdigit(stream.peek()) )
+   {
+      stream.setstate(std::ios::failbit);
+      return stream;
+   }
+   const auto limit = static_cast<uint128_t>(std::numeric_limits<int128_t>::max()) + (negative ? 1 : 0);
+   uint128_t magnitude = 0;
+   while ( std::isdigit(stream.peek()) )
+   {
+      const auto digit = static_cast<uint128_t>(stream.get() - '0');
+      if ( magnitude > (limit - digit) / 10 )
+      {
+         stream.setstate(std::ios::failbit);
+         return stream;
+      }
+      magnitude = magnitude * 10 + digit;
+   }
+   value = negative ? static_cast<int128_t>(-magnitude) : static_cast<int128_t>(magnitude);
+   return stream;
+}
+
+#endif
+
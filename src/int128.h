@@ -0,0 +1,25 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#ifdef __SIZEOF_INT128__
+#include <iosfwd>
+
+namespace panda
+{
+   /// Integer with exactly 128 bit width. This is an extension of GCC and Clang, hence it is only available if __SIZEOF_INT128__ is defined.
+   __extension__ typedef __int128 int128_t;
+   /// Unsigned integer with exactly 128 bit width.
+   __extension__ typedef unsigned __int128 uint128_t;
+}
+
+/// Output of a 128 bit integer in decimal notation (the standard library lacks this one).
+std::ostream& operator<<(std::ostream&, const panda::int128_t);
+/// Input of a 128 bit integer in decimal notation. Sets the failbit if there is no number or if it is out of range.
+std::istream& operator>>(std::istream&, panda::int128_t&);
+#endif
+
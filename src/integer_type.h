@@ -10,12 +10,16 @@ namespace panda
 {
    enum class IntegerType
    {
-      Fixed16,  /// Guaranteed 16bit integer.
-      Fixed32,  /// Guaranteed 32bit integer.
-      Fixed64,  /// Guaranteed 64bit integer.
-      Safe,     /// 64bit integer that throws an exception if an operation is unsafe.
-      Variable, /// Arbitrary precision integer type (BigInteger).
-      Default   /// Integer type that the system uses as "int".
+      Fixed16,   /// Guaranteed 16bit integer.
+      Fixed32,   /// Guaranteed 32bit integer.
+      Fixed64,   /// Guaranteed 64bit integer.
+      Fixed128,  /// Guaranteed 128bit integer (if supported by the compiler).
+      Safe,      /// 64bit integer that throws an exception if an operation is unsafe.
+      Safe128,   /// 128bit integer that throws an exception if an operation is unsafe.
+      Adaptive,  /// 64bit integer that switches to arbitrary precision for each value that overflows.
+      Variable,  /// Arbitrary precision integer type (BigInteger).
+      Automatic, /// Narrowest integer type that is provably safe for the input (see integer_type_analysis.h).
+      Default    /// Integer type that the system uses as "int".
    };
 }
 
@@ -0,0 +1,287 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "integer_type_analysis.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "algorithm_matrix_operations.h"
+#include "big_integer.h"
+#include "decimal.h"
+#include "input.h"
+#include "input_detection.h"
+#include "int128.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Returns the name of the integer type as used for "-i <type>".
+   const char* commandLineName(const IntegerType) noexcept;
+   /// Returns whether all values with the binary logarithm of their magnitude bounded by bits fit into an integer with the given width.
+   bool fits(const double, const int) noexcept;
+   /// Returns whether every map only permutes coordinates and flips signs, i.e. images keep the magnitudes of the entries.
+   bool isSignedPermutation(const Maps&) noexcept;
+   /// Appends the rows to the matrix, padded with zeros to its width. Returns false if a row is wider than the matrix.
+   template <typename Integer>
+   bool appendPadded(Matrix<Integer>&, const Matrix<Integer>&);
+   /// Returns the integer as floating point number (infinite if it exceeds the range of double).
+   double toDouble(const int) noexcept;
+   double toDouble(const BigInteger&);
+   /// Returns the checked integer type that is at least as wide as the given type.
+   IntegerType checked(const IntegerType) noexcept;
+}
+
+template <typename Integer>
+double panda::coefficientGrowthBound(const Matrix<Integer>& matrix)
+{
+   if ( matrix.empty() || matrix.front().empty() )
+   {
+      return 0.0;
+   }
+   const auto columns = matrix.front().size();
+   std::vector<double> logarithms; // binary logarithms of the row norms (zero rows don't contribute).
+   logarithms.reserve(matrix.size());
+   for ( const auto& row : matrix )
+   {
+      assert( row.size() == columns );
+      double square = 0.0;
+      for ( const auto& entry : row )
+      {
+         const auto value = toDouble(entry);
+         square += value * value;
+      }
+      if ( square > 0.0 )
+      {
+         logarithms.push_back(0.5 * std::log2(square));
+      }
+   }
+   const auto count = std::min(columns, logarithms.size());
+   std::partial_sort(logarithms.begin(), logarithms.begin() + static_cast<std::ptrdiff_t>(count), logarithms.end(), std::greater<double>());
+   double hadamard = 0.0;
+   for ( std::size_t i = 0; i < count; ++i )
+   {
+      hadamard += logarithms[i];
+   }
+   const auto largest = ( count > 0 ) ? logarithms.front() : 0.0;
+   return 1.0 + 0.5 * std::log2(static_cast<double>(columns)) + 2.0 * hadamard + largest;
+}
+
+template <typename Integer>
+IntegerType panda::narrowestSafeIntegerType(const Matrix<Integer>& matrix)
+{
+   const auto bits = coefficientGrowthBound(matrix);
+   #ifdef INT32_MAX
+   if ( fits(bits, 32) )
+   {
+      return IntegerType::Fixed32;
+   }
+   #endif
+   #ifdef INT64_MAX
+   if ( fits(bits, 64) )
+   {
+      return IntegerType::Fixed64;
+   }
+   #endif
+   #ifdef __SIZEOF_INT128__
+   if ( fits(bits, 128) )
+   {
+      return IntegerType::Fixed128;
+   }
+   #endif
+   return IntegerType::Variable;
+}
+
+template <typename Integer>
+IntegerType panda::narrowestSafeIntegerType(const Matrix<Integer>& matrix, const Matrix<Integer>& known, const Matrix<Integer>& deterministics, const Maps& maps)
+{
+   auto rows = matrix;
+   const auto covered = appendPadded(rows, known) && appendPadded(rows, deterministics) && isSignedPermutation(maps);
+   const auto integer_type = narrowestSafeIntegerType(rows);
+   return covered ? integer_type : checked(integer_type);
+}
+
+template <typename Integer>
+IntegerType panda::narrowestSafeIntegerTypeForFacets(const Matrix<Integer>& vertices, const Matrix<Integer>& known, const Maps& maps)
+{
+   const auto integer_type = narrowestSafeIntegerType(vertices, known, Matrix<Integer>{}, maps);
+   if ( vertices.empty() || vertices.front().empty() || algorithm::extractEquations(vertices).empty() )
+   {
+      return integer_type;
+   }
+   return checked(integer_type);
+}
+
+IntegerType panda::analyzeIntegerType(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   // the input is read at arbitrary precision, coefficients beyond any fixed width have to select BigInteger.
+   Matrix<BigInteger> matrix;
+   Matrix<BigInteger> known;
+   Matrix<BigInteger> deterministics;
+   Maps maps;
+   IntegerType integer_type;
+   if ( detectOperationMode(argc, argv) == OperationMode::VertexEnumeration )
+   {
+      std::tie(matrix, std::ignore, maps, known, deterministics) = input::inequalities<BigInteger>(argc, argv);
+      integer_type = narrowestSafeIntegerType(matrix, known, deterministics, maps);
+   }
+   else
+   {
+      std::tie(matrix, std::ignore, maps, known) = input::vertices<BigInteger>(argc, argv);
+      integer_type = narrowestSafeIntegerTypeForFacets(matrix, known, maps);
+   }
+   auto rows = matrix;
+   appendPadded(rows, known);
+   appendPadded(rows, deterministics);
+   std::cerr << "Coefficients are bounded by 2^" << std::fixed << std::setprecision(1) << coefficientGrowthBound(rows)
+             << std::defaultfloat << ", selected integer type \"" << commandLineName(integer_type) << "\""
+             << " (override with \"-i <type>\").\n";
+   return integer_type;
+}
+
+template double panda::coefficientGrowthBound(const Matrix<int>&);
+template double panda::coefficientGrowthBound(const Matrix<BigInteger>&);
+template IntegerType panda::narrowestSafeIntegerType(const Matrix<int>&);
+template IntegerType panda::narrowestSafeIntegerType(const Matrix<BigInteger>&);
+template IntegerType panda::narrowestSafeIntegerType(const Matrix<int>&, const Matrix<int>&, const Matrix<int>&, const Maps&);
+template IntegerType panda::narrowestSafeIntegerType(const Matrix<BigInteger>&, const Matrix<BigInteger>&, const Matrix<BigInteger>&, const Maps&);
+template IntegerType panda::narrowestSafeIntegerTypeForFacets(const Matrix<int>&, const Matrix<int>&, const Maps&);
+template IntegerType panda::narrowestSafeIntegerTypeForFacets(const Matrix<BigInteger>&, const Matrix<BigInteger>&, const Maps&);
+
+namespace
+{
+   const char* commandLineName(const IntegerType integer_type) noexcept
+   {
+      switch ( integer_type )
+      {
+         case IntegerType::Fixed16:
+         {
+            return "16";
+         }
+         case IntegerType::Fixed32:
+         {
+            return "32";
+         }
+         case IntegerType::Fixed64:
+         {
+            return "64";
+         }
+         case IntegerType::Fixed128:
+         {
+            return "128";
+         }
+         case IntegerType::Safe:
+         {
+            return "safe";
+         }
+         case IntegerType::Safe128:
+         {
+            return "safe128";
+         }
+         case IntegerType::Adaptive:
+         {
+            return "adaptive";
+         }
+         case IntegerType::Variable:
+         {
+            return "inf";
+         }
+         case IntegerType::Automatic:
+         {
+            return "auto";
+         }
+         case IntegerType::Default:
+         {
+            return "int";
+         }
+      }
+      return "int";
+   }
+
+   bool isSignedPermutation(const Maps& maps) noexcept
+   {
+      return std::all_of(maps.cbegin(), maps.cend(), [](const Map& map)
+      {
+         return std::all_of(map.cbegin(), map.cend(), [](const Image& image)
+         {
+            return image.size() == 1 && (image.front().second == 1 || image.front().second == -1);
+         });
+      });
+   }
+
+   template <typename Integer>
+   bool appendPadded(Matrix<Integer>& matrix, const Matrix<Integer>& rows)
+   {
+      const auto width = matrix.empty() ? 0 : matrix.front().size();
+      for ( const auto& row : rows )
+      {
+         if ( row.size() > width )
+         {
+            return false;
+         }
+         matrix.push_back(row);
+         matrix.back().resize(width, Integer(0));
+      }
+      return true;
+   }
+
+   IntegerType checked(const IntegerType integer_type) noexcept
+   {
+      switch ( integer_type )
+      {
+         case IntegerType::Fixed16:
+         case IntegerType::Fixed32:
+         case IntegerType::Fixed64:
+         {
+            return IntegerType::Safe;
+         }
+         case IntegerType::Fixed128:
+         {
+            #ifdef __SIZEOF_INT128__
+            return IntegerType::Safe128;
+            #else
+            return IntegerType::Variable;
+            #endif
+         }
+         case IntegerType::Safe:
+         case IntegerType::Safe128:
+         case IntegerType::Adaptive:
+         case IntegerType::Variable:
+         case IntegerType::Automatic:
+         case IntegerType::Default:
+         {
+            return integer_type;
+         }
+      }
+      return integer_type;
+   }
+
+   bool fits(const double bits, const int width) noexcept
+   {
+      // the bound has to stay below 2^(width - 1), the margin covers rounding errors of the logarithms.
+      return bits + 1e-6 < static_cast<double>(width - 1);
+   }
+
+   double toDouble(const int value) noexcept
+   {
+      return static_cast<double>(value);
+   }
+
+   double toDouble(const BigInteger& value)
+   {
+      // strtod rounds to the nearest double and yields infinity beyond its range, which selects arbitrary precision.
+      return std::strtod(decimal::toString(value).c_str(), nullptr);
+   }
+}
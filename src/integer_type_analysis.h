@@ -0,0 +1,42 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include "integer_type.h"
+#include "maps.h"
+#include "matrix.h"
+
+namespace panda
+{
+   /// Returns the binary logarithm of an upper bound on the absolute value of all intermediate coefficients of
+   /// facet / vertex enumeration (rotation, double description / Fourier-Motzkin elimination) of the input matrix.
+   /// Every normalized intermediate row is a vector of minors of the input (extended by unit rows), hence it is bounded
+   /// by the Hadamard bound H (product of the largest d row norms for d columns). With L as the largest row norm, scalar
+   /// products are bounded by sqrt(d) * H * L and a combination of two rows (before division by the gcd) by 2 * sqrt(d) * H^2 * L.
+   /// Instantiated for int and BigInteger.
+   template <typename Integer>
+   double coefficientGrowthBound(const Matrix<Integer>&);
+   /// Returns the narrowest integer type (32 bit, 64 bit, 128 bit or arbitrary precision) which provably cannot overflow.
+   template <typename Integer>
+   IntegerType narrowestSafeIntegerType(const Matrix<Integer>&);
+   /// Returns the narrowest safe integer type for the input (first argument) together with the known rows (second argument),
+   /// the deterministic points (third argument) and the maps of a run. Known rows and deterministic points (padded with zeros)
+   /// enter the bound like rows of the input. Maps that are not signed permutations may enlarge coefficients beyond the bound,
+   /// in that case the checked type of the same width is returned (safe or safe128).
+   template <typename Integer>
+   IntegerType narrowestSafeIntegerType(const Matrix<Integer>&, const Matrix<Integer>&, const Matrix<Integer>&, const Maps&);
+   /// Returns the narrowest safe integer type for facet enumeration of the vertices (first argument) with the known facets
+   /// (second argument) and the maps. If the vertices don't span the full space, facet enumeration eliminates coordinates
+   /// with the equations (see algorithm::normalize), which neither the bound nor the check of the maps covers. In that case
+   /// the checked type of the same width is returned.
+   template <typename Integer>
+   IntegerType narrowestSafeIntegerTypeForFacets(const Matrix<Integer>&, const Matrix<Integer>&, const Maps&);
+   /// Reads the input at arbitrary precision and returns the narrowest safe integer type. The decision is reported on std::cerr.
+   /// Throws if the input can't be read.
+   IntegerType analyzeIntegerType(int, char**);
+}
+
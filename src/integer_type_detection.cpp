@@ -29,7 +29,7 @@ IntegerType panda::integerType(int argc, char** argv)
          if ( i + 1 == argc )
          {
             std::string message = "Command line option -i needs a parameter:";
-            message += " Choose either \"16\", \"32\", \"64\", \"safe\" or \"inf\"-";
+            message += " Choose either \"16\", \"32\", \"64\", \"128\", \"safe\", \"safe128\", \"adaptive\", \"inf\" or \"auto\"-";
             throw std::invalid_argument(message);
          }
          return integerTypeFromString(argv[i + 1]);
@@ -78,16 +78,40 @@ namespace
          throw std::invalid_argument("Your system does not support an integer type with exactly 64 bit width.");
          #endif
       }
+      else if ( std::strcmp(string, "128") == 0 )
+      {
+         #ifdef __SIZEOF_INT128__
+         return IntegerType::Fixed128;
+         #else
+         throw std::invalid_argument("Your system does not support an integer type with exactly 128 bit width.");
+         #endif
+      }
       else if ( std::strcmp(string, "safe") == 0 )
       {
          return IntegerType::Safe;
       }
+      else if ( std::strcmp(string, "safe128") == 0 )
+      {
+         #ifdef __SIZEOF_INT128__
+         return IntegerType::Safe128;
+         #else
+         throw std::invalid_argument("Your system does not support an integer type with exactly 128 bit width.");
+         #endif
+      }
+      else if ( std::strcmp(string, "adaptive") == 0 )
+      {
+         return IntegerType::Adaptive;
+      }
       else if ( std::strcmp(string, "inf") == 0 )
       {
          return IntegerType::Variable;
       }
+      else if ( std::strcmp(string, "auto") == 0 )
+      {
+         return IntegerType::Automatic;
+      }
       std::string message = "Invalid parameter to command line option -i";
-      message += " / --integer-type: Choose either \"16\", \"32\", \"64\", \"safe\" or \"inf\"-";
+      message += " / --integer-type: Choose either \"16\", \"32\", \"64\", \"128\", \"safe\", \"safe128\", \"adaptive\", \"inf\" or \"auto\"-";
       throw std::invalid_argument(message);
    }
 }
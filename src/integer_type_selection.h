@@ -6,13 +6,19 @@
 
 #pragma once
 
+#include "integer_type.h"
+
 namespace panda
 {
    template <template <typename> class Functor>
    struct IntegerTypeSelector
    {
-      /// Selects the correct integer type for execution of Functor::call(int, char**).
-      static int select(int, char**);
+      public:
+         /// Selects the correct integer type for execution of Functor::call(int, char**).
+         static int select(int, char**);
+      private:
+         /// Executes Functor::call(int, char**) with the given integer type.
+         static int dispatch(const IntegerType, int, char**);
    };
 }
 
@@ -6,12 +6,18 @@
 
 #include <cassert>
 #include <cstdint>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
 
+#include "adaptive_integer.h"
 #include "big_integer.h"
+#include "int128.h"
+#include "integer_type_analysis.h"
 #include "integer_type_detection.h"
+#include "message_passing_interface_session.h"
 #include "safe_integer.h"
+#include "safe_integer_128.h"
 
 #ifdef NO_FLEXIBILITY
 
@@ -35,7 +41,12 @@ template <template <typename> class Functor>
 int panda::IntegerTypeSelector<Functor>::select(int argc, char** argv)
 {
    assert( argc > 0 && argv != nullptr );
-   const auto integer_type = integerType(argc, argv);
+   return dispatch(integerType(argc, argv), argc, argv);
+}
+
+template <template <typename> class Functor>
+int panda::IntegerTypeSelector<Functor>::dispatch(const IntegerType integer_type, int argc, char** argv)
+{
    switch ( integer_type )
    {
       case IntegerType::Fixed16:
@@ -50,14 +61,58 @@ int panda::IntegerTypeSelector<Functor>::select(int argc, char** argv)
       {
          return Functor<int64_t>::call(argc, argv);
       }
+      case IntegerType::Fixed128:
+      {
+         #ifdef __SIZEOF_INT128__
+         return Functor<int128_t>::call(argc, argv);
+         #else
+         break;
+         #endif
+      }
       case IntegerType::Safe:
       {
          return Functor<SafeInteger>::call(argc, argv);
       }
+      case IntegerType::Safe128:
+      {
+         #ifdef __SIZEOF_INT128__
+         return Functor<SafeInteger128>::call(argc, argv);
+         #else
+         break;
+         #endif
+      }
+      case IntegerType::Adaptive:
+      {
+         return Functor<AdaptiveInteger>::call(argc, argv);
+      }
       case IntegerType::Variable:
       {
          return Functor<BigInteger>::call(argc, argv);
       }
+      case IntegerType::Automatic:
+      {
+         // only the master reads the input and reports the decision, the other nodes take it over.
+         // Automatic is passed on if the analysis failed, then every node returns.
+         const auto& mpi_session = mpi::getSession();
+         auto analyzed = IntegerType::Automatic;
+         if ( mpi_session.isMaster() )
+         {
+            try
+            {
+               analyzed = analyzeIntegerType(argc, argv);
+            }
+            catch ( const std::exception& e )
+            {
+               std::cerr << "Exception caught: " << e.what() << '\n';
+            }
+         }
+         analyzed = static_cast<IntegerType>(mpi_session.broadcast(static_cast<int>(analyzed)));
+         if ( analyzed == IntegerType::Automatic )
+         {
+            return 1;
+         }
+         return dispatch(analyzed, argc, argv);
+      }
       case IntegerType::Default:
       {
          return Functor<int>::call(argc, argv);
@@ -10,30 +10,121 @@
 
 //#define BENCHMARK_LOAD_BALANCING
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
 
 #include "algorithm_row_operations.h"
+#include "checkpoint_file.h"
 
 using namespace panda;
 
 template <typename Integer, typename TagType>
 void panda::JobManager<Integer, TagType>::put(const Matrix<Integer>& matrix) const
 {
-   rows.put(matrix);
+   {
+      // the job of the caller is done, so are its helpers.
+      std::lock_guard<std::mutex> lock(helper_mutex);
+      releaseHelpers();
+   }
+   if ( scheduler == JobScheduler::WorkStealing )
+   {
+      stealing_rows->put(matrix);
+      return;
+   }
+   rows->put(matrix);
 }
 
 template <typename Integer, typename TagType>
 void panda::JobManager<Integer, TagType>::put(const Row<Integer>& row) const
 {
-   rows.put(row);
+   if ( scheduler == JobScheduler::WorkStealing )
+   {
+      stealing_rows->put(row);
+      return;
+   }
+   rows->put(row);
 }
 
 template <typename Integer, typename TagType>
 Row<Integer> panda::JobManager<Integer, TagType>::get() const
 {
-   return rows.get();
+   if ( scheduler == JobScheduler::WorkStealing )
+   {
+      return stealing_rows->get();
+   }
+   return rows->get();
+}
+
+template <typename Integer, typename TagType>
+std::size_t panda::JobManager<Integer, TagType>::parallelism() const
+{
+   const auto load = (scheduler == JobScheduler::WorkStealing) ? stealing_rows->load() : rows->load();
+   const auto busy = std::max<std::size_t>(load.first, 1);
+   const auto occupied = busy + load.second;
+   std::lock_guard<std::mutex> lock(helper_mutex);
+   // a new request replaces the previous reservation of the caller.
+   releaseHelpers();
+   if ( occupied + helper_count >= pool_threads )
+   {
+      return 1;
+   }
+   // every queued job will be taken by an idle thread soon, the rest is split evenly among the jobs in progress
+   // (without the threads that already help other jobs).
+   const auto spare = (pool_threads - occupied - helper_count) / busy;
+   const auto result = std::min(1 + spare, local_threads);
+   if ( result > 1 )
+   {
+      helpers[std::this_thread::get_id()] = result - 1;
+      helper_count += result - 1;
+   }
+   return result;
+}
+
+template <typename Integer, typename TagType>
+const HelperPool& panda::JobManager<Integer, TagType>::helperPool() const
+{
+   return helper_pool;
+}
+
+template <typename Integer, typename TagType>
+void panda::JobManager<Integer, TagType>::write(std::string text) const
+{
+   output.write(std::move(text));
+}
+
+template <typename Integer, typename TagType>
+void panda::JobManager<Integer, TagType>::resume(const std::string& filename) const
+{
+   const auto state = checkpoint::read<Integer>(filename);
+   if ( scheduler == JobScheduler::WorkStealing )
+   {
+      stealing_rows->restore(state.first, state.second);
+      return;
+   }
+   rows->restore(state.first, state.second);
+}
+
+template <typename Integer, typename TagType>
+void panda::JobManager<Integer, TagType>::releaseHelpers() const
+{
+   const auto position = helpers.find(std::this_thread::get_id());
+   if ( position != helpers.end() )
+   {
+      helper_count -= position->second;
+      helpers.erase(position);
+   }
+}
+
+template <typename Integer, typename TagType>
+void panda::JobManager<Integer, TagType>::saveCheckpoint(const std::string& filename) const
+{
+   const auto state = (scheduler == JobScheduler::WorkStealing) ? stealing_rows->snapshot() : rows->snapshot();
+   checkpoint::write<Integer>(filename, state.first, state.second);
 }
 
 #ifndef MPI_SUPPORT
@@ -43,12 +134,26 @@ Row<Integer> panda::JobManager<Integer, TagType>::get() const
    #pragma clang diagnostic ignored "-Wunused-parameter"
 #endif
 template <typename Integer, typename TagType>
-panda::JobManager<Integer, TagType>::JobManager(const Names& names_, const int number_of_processors, const int threads_per_processor)
+panda::JobManager<Integer, TagType>::JobManager(const Names& names_, const int number_of_processors, const int threads_per_processor, const JobScheduler scheduler_, const ClassRegistryType registry_type, const std::string& output_file, const std::chrono::milliseconds flush_interval, const std::string& checkpoint_file, const std::chrono::seconds checkpoint_interval, const JobPriority<Integer>& priority)
 :
    communication(),
-   rows(names_),
+   scheduler(scheduler_),
+   local_threads(static_cast<std::size_t>(threads_per_processor)),
+   pool_threads(static_cast<std::size_t>(number_of_processors * threads_per_processor)),
+   output(output_file, flush_interval),
+   rows(scheduler_ == JobScheduler::WorkStealing ? nullptr : new List<Integer, TagType>(names_, registry_type, output, priority)),
+   stealing_rows(scheduler_ == JobScheduler::WorkStealing ? new WorkStealingList<Integer, TagType>(names_, static_cast<std::size_t>(number_of_processors * threads_per_processor), registry_type, output) : nullptr), // one deque per local thread and per request thread
+   helper_mutex(),
+   helpers(),
+   helper_count(0),
+   helper_pool(static_cast<std::size_t>(threads_per_processor) - 1), // a job gets at most all local threads, including its own
+   checkpointer(checkpoint_file.empty() ? std::function<void()>() : [this, checkpoint_file]() { saveCheckpoint(checkpoint_file); }, checkpoint_interval),
    request_threads() // vital implementation detail: threads may access other members, hence, the threads must be destroyed first (Destruction in reverse order of construction).
 {
+   if ( priority && scheduler == JobScheduler::WorkStealing )
+   {
+      throw std::invalid_argument("Job orders other than FIFO require the single queue job scheduler.");
+   }
    #ifdef MPI_SUPPORT
    assert( number_of_processors > 0 );
    assert( threads_per_processor > 0 );
@@ -63,7 +168,7 @@ panda::JobManager<Integer, TagType>::JobManager(const Names& names_, const int n
             #endif
             while ( true )
             {
-               const auto facet = rows.get();
+               const auto facet = get();
                communication.toSlave(facet, id);
                if ( facet.empty() ) // if facet is empty, the slave will stop working.
                {
@@ -6,15 +6,29 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
+#include "checkpointer.h"
+#include "class_registry_type.h"
 #include "communication.h"
+#include "helper_pool.h"
+#include "job_order.h"
+#include "job_scheduler.h"
 #include "joining_thread.h"
 #include "list.h"
 #include "matrix.h"
 #include "names.h"
+#include "output_writer.h"
 #include "row.h"
 #include "tags.h"
+#include "work_stealing_list.h"
 
 namespace panda
 {
@@ -29,16 +43,53 @@ namespace panda
          /// Returns a job that wasn't ever returned here before. Blocks the
          /// caller until data is available.
          Row<Integer> get() const;
+         /// Returns the number of threads that may work on the current job of the caller.
+         /// Threads that are idle because fewer jobs are queued than threads exist are
+         /// shared among the jobs in progress. Returns at least 1.
+         /// The additional threads stay reserved for the caller until it puts the result of its job
+         /// or asks again, hence, concurrent jobs never get the same idle threads.
+         std::size_t parallelism() const;
+         /// Returns the threads that help the jobs in progress (as many as parallelism() hands out on this node).
+         const HelperPool& helperPool() const;
+         /// Writes text to the output (behind all rows that were put before).
+         void write(std::string) const;
+         /// Restores the pool from a checkpoint file instead of an initial job.
+         void resume(const std::string&) const;
          /// Constructor. The first argument are the names of indices
          /// (only relevant for printing inequalities).
          /// The second argument must be the number of processors,
-         /// the third argument must be the number of threads per processor.
-         JobManager(const Names&, const int, const int);
+         /// the third argument must be the number of threads per processor,
+         /// the fourth argument selects the pool that distributes the jobs,
+         /// the fifth argument selects the registry that holds the discovered classes,
+         /// the sixth argument is the output file (empty for standard output),
+         /// the seventh argument is the time between two flushes of the output,
+         /// the eighth argument is the checkpoint file (empty for no checkpoints),
+         /// the ninth argument is the time between two checkpoints,
+         /// the tenth argument is the priority of jobs (empty for FIFO, only supported by the single queue).
+         JobManager(const Names&, const int, const int, const JobScheduler, const ClassRegistryType, const std::string&, const std::chrono::milliseconds, const std::string&, const std::chrono::seconds, const JobPriority<Integer>&);
       private:
          Communication communication;
-         mutable List<Integer, TagType> rows;
+         const JobScheduler scheduler;
+         /// number of threads on this node and number of threads working on the pool (including request threads).
+         const std::size_t local_threads;
+         const std::size_t pool_threads;
+         OutputWriter output;
+         /// the pool selected by the scheduler (the other one is never constructed).
+         const std::unique_ptr<List<Integer, TagType>> rows;
+         const std::unique_ptr<WorkStealingList<Integer, TagType>> stealing_rows;
+         /// additional threads handed out by parallelism() to the jobs in progress (by the thread of the job) and their sum.
+         mutable std::mutex helper_mutex;
+         mutable std::map<std::thread::id, std::size_t> helpers;
+         mutable std::size_t helper_count;
+         /// the threads that run the work of the additional threads.
+         HelperPool helper_pool;
+         Checkpointer checkpointer;
          mutable std::list<JoiningThread> request_threads;
       private:
+         /// Saves the state of the pool to a file.
+         void saveCheckpoint(const std::string&) const;
+         /// Gives back the additional threads reserved by the calling thread. The caller has to hold the helper lock.
+         void releaseHelpers() const;
          /// Copy construction is not allowed.
          JobManager(const JobManager<Integer, TagType>&) = delete;
          /// Copy assignment is not allowed.
@@ -40,9 +40,22 @@ panda::Row<Integer> panda::JobManagerProxy<Integer, TagType>::get() const
 #endif
 
 template <typename Integer, typename TagType>
-panda::JobManagerProxy<Integer, TagType>::JobManagerProxy(const Names&, const int, const int)
+std::size_t panda::JobManagerProxy<Integer, TagType>::parallelism() const
+{
+   return 1;
+}
+
+template <typename Integer, typename TagType>
+const HelperPool& panda::JobManagerProxy<Integer, TagType>::helperPool() const
+{
+   return helper_pool;
+}
+
+template <typename Integer, typename TagType>
+panda::JobManagerProxy<Integer, TagType>::JobManagerProxy(const Names&, const int, const int, const JobScheduler, const ClassRegistryType, const std::string&, const std::chrono::milliseconds, const std::string&, const std::chrono::seconds, const JobPriority<Integer>&)
 :
-   communication()
+   communication(),
+   helper_pool(0)
 {
 }
 
@@ -6,9 +6,15 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <string>
 
+#include "class_registry_type.h"
 #include "communication.h"
+#include "helper_pool.h"
+#include "job_order.h"
+#include "job_scheduler.h"
 #include "matrix.h"
 #include "names.h"
 #include "row.h"
@@ -27,10 +33,16 @@ namespace panda
          void put(const Matrix<Integer>&) const;
          /// Returns facet that wasn't ever returned here before. Blocks the caller until data is available.
          Row<Integer> get() const;
+         /// Returns the number of threads that may work on the current job of the caller.
+         /// The load of the pool is only known to the master, hence, this is always 1.
+         std::size_t parallelism() const;
+         /// Returns the threads that help the jobs in progress. As parallelism() is always 1, there are none.
+         const HelperPool& helperPool() const;
          /// Constructor. The arguments are deliberately ignored in JobManagerProxy.
-         JobManagerProxy(const Names&, const int, const int);
+         JobManagerProxy(const Names&, const int, const int, const JobScheduler, const ClassRegistryType, const std::string&, const std::chrono::milliseconds, const std::string&, const std::chrono::seconds, const JobPriority<Integer>&);
       private:
          Communication communication;
+         HelperPool helper_pool;
    };
 }
 
@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "row.h"
+
+namespace panda
+{
+   enum class JobOrderType
+   {
+      Fifo,                /// Jobs are processed in order of discovery.
+      IncidenceAscending,  /// Jobs with few incident input rows (e.g. vertices on a facet) first.
+      IncidenceDescending, /// Jobs with many incident input rows first.
+      Score                /// Jobs with a low user-provided linear score first.
+   };
+
+   /// Order in which the job pool hands out jobs. The weights define the score (only used for JobOrderType::Score).
+   struct JobOrder
+   {
+      JobOrderType type;
+      std::vector<int> weights;
+   };
+
+   /// Priority of a job, jobs with lower values are handed out first. An empty function means FIFO.
+   /// Priorities don't depend on the integer type of the enumeration, so they can neither overflow nor throw.
+   template <typename Integer>
+   using JobPriority = std::function<double(const Row<Integer>&)>;
+}
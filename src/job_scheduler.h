@@ -0,0 +1,15 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+namespace panda
+{
+   enum class JobScheduler
+   {
+      SingleQueue,  /// One job queue guarded by a single mutex (class List).
+      WorkStealing  /// Per-thread job queues with stealing (class WorkStealingList).
+   };
+}
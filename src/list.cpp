@@ -8,9 +8,12 @@
 #include "list.h"
 #undef COMPILE_TEMPLATE_LIST
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 #include "algorithm_row_operations.h"
 
@@ -38,45 +41,53 @@ using namespace panda;
 template <typename Integer, typename TagType>
 void panda::List<Integer, TagType>::put(const Matrix<Integer>& matrix) const
 {
-   for ( const auto& row : matrix )
+   const auto stored = rows.insert(matrix);
+   const auto stored_priorities = priorities(stored);
    {
-      put(row);
+      std::lock_guard<std::mutex> lock(mutex);
+      enqueue(stored, stored_priorities);
+      discovered.insert(discovered.end(), stored.cbegin(), stored.cend());
+      in_progress.erase(std::this_thread::get_id());
+      --workers;
+      #ifdef PRINT_DONE_COUNTER
+      #if HAS_FEATURE_THREAD_LOCAL == 0
+      auto index = indices[std::this_thread::get_id()];
+      #endif
+      if ( index > 0 )
+      {
+         std::stringstream stream;
+         stream << "Done processing #" << index << '\n';
+         std::cerr << stream.str();
+      }
+      #endif
    }
-   std::lock_guard<std::mutex> lock(mutex);
-   --workers;
-   #ifdef PRINT_DONE_COUNTER
-   #if HAS_FEATURE_THREAD_LOCAL == 0
-   auto index = indices[std::this_thread::get_id()];
-   #endif
-   if ( index > 0 )
+   // wake the waiting workers once for the whole batch.
+   if ( stored.size() == 1 )
    {
-      std::stringstream stream;
-      stream << "Done processing #" << index << '\n';
-      std::cerr << stream.str();
+      condition.notify_one();
    }
-   #endif
+   else if ( stored.size() > 1 )
+   {
+      condition.notify_all();
+   }
+   print(stored);
 }
 
 template <typename Integer, typename TagType>
 void panda::List<Integer, TagType>::put(const Row<Integer>& row) const
 {
-   std::lock_guard<std::mutex> lock(mutex);
-   Iterator it;
-   bool added;
-   std::tie(it, added) = rows.insert(row);
-   if ( added )
+   // the registry has its own locks, so comparison with known rows doesn't block other workers.
+   const auto stored = rows.insert(row);
+   if ( stored != nullptr )
    {
-      if ( std::is_same<TagType, tag::facet>::value )
+      const auto stored_priorities = priorities({stored});
       {
-         algorithm::prettyPrintln(std::cout, row, names, "<=");
+         std::lock_guard<std::mutex> lock(mutex);
+         enqueue({stored}, stored_priorities);
+         discovered.push_back(stored);
       }
-      else
-      {
-         std::cout << row << '\n';
-      }
-      std::cout.flush();
-      iterators.push_back(it);
       condition.notify_one();
+      print({stored});
    }
 }
 
@@ -85,18 +96,32 @@ Row<Integer> panda::List<Integer, TagType>::get() const
 {
    if ( empty() ) // abort
    {
-      const auto it = rows.insert(Row<Integer>{}).first;
       std::unique_lock<std::mutex> lock(mutex);
-      iterators.push_back(it);
+      iterators.push_back(&terminator);
       condition.notify_all();
    }
    std::unique_lock<std::mutex> lock(mutex);
-   condition.wait(lock, [&](){ return !iterators.empty(); });
+   condition.wait(lock, [&](){ return !iterators.empty() || !prioritized.empty(); });
    ++workers;
-   const auto row = *iterators.front();
+   const Row<Integer>* job;
+   if ( !prioritized.empty() )
+   {
+      std::pop_heap(prioritized.begin(), prioritized.end(), later);
+      job = prioritized.back().row;
+      prioritized.pop_back();
+   }
+   else
+   {
+      job = iterators.front();
+      if ( !job->empty() )
+      {
+         iterators.pop_front();
+      }
+   }
+   const auto row = *job;
    if ( !row.empty() )
    {
-      iterators.erase(iterators.begin());
+      in_progress[std::this_thread::get_id()] = job;
    }
    #ifdef PRINT_DONE_COUNTER
    if ( !row.empty() )
@@ -108,8 +133,9 @@ Row<Integer> panda::List<Integer, TagType>::get() const
       index = counter;
       #endif
       std::stringstream stream;
-      stream << "Processing #" << counter << " of at least " << rows.size();
-      stream << " class" << ((rows.size() == 1) ? "" : "es") << '\n';
+      const auto classes = rows.size();
+      stream << "Processing #" << counter << " of at least " << classes;
+      stream << " class" << ((classes == 1) ? "" : "es") << '\n';
       std::cerr << stream.str();
    }
    #endif
@@ -117,15 +143,83 @@ Row<Integer> panda::List<Integer, TagType>::get() const
 }
 
 template <typename Integer, typename TagType>
-panda::List<Integer, TagType>::List(const Names& names_)
+std::pair<std::vector<const Row<Integer>*>, std::vector<const Row<Integer>*>> panda::List<Integer, TagType>::snapshot() const
+{
+   // only pointers are copied under the lock, the rows themselves never change.
+   std::lock_guard<std::mutex> lock(mutex);
+   std::vector<const Row<Integer>*> jobs;
+   jobs.reserve(iterators.size() + prioritized.size() + in_progress.size());
+   for ( const auto job : iterators )
+   {
+      if ( job != &terminator )
+      {
+         jobs.push_back(job);
+      }
+   }
+   for ( const auto& job : prioritized )
+   {
+      jobs.push_back(job.row);
+   }
+   for ( const auto& entry : in_progress )
+   {
+      jobs.push_back(entry.second);
+   }
+   return std::make_pair(discovered, std::move(jobs));
+}
+
+template <typename Integer, typename TagType>
+void panda::List<Integer, TagType>::restore(const Matrix<Integer>& classes, const Matrix<Integer>& jobs) const
+{
+   const auto stored = rows.insert(classes);
+   if ( stored.size() != classes.size() )
+   {
+      throw std::invalid_argument("Checkpoint contains duplicate classes.");
+   }
+   std::vector<const Row<Integer>*> stored_jobs;
+   stored_jobs.reserve(jobs.size());
+   for ( const auto& job : jobs )
+   {
+      stored_jobs.push_back(rows.find(job));
+      assert( stored_jobs.back() != nullptr );
+   }
+   const auto job_priorities = priorities(stored_jobs);
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      enqueue(stored_jobs, job_priorities);
+      discovered.insert(discovered.end(), stored.cbegin(), stored.cend());
+      counter = classes.size() - jobs.size();
+      --workers;
+   }
+   condition.notify_all();
+   print(stored);
+}
+
+template <typename Integer, typename TagType>
+std::pair<std::size_t, std::size_t> panda::List<Integer, TagType>::load() const
+{
+   std::lock_guard<std::mutex> lock(mutex);
+   // once all jobs are done, only terminators are queued.
+   const auto terminated = !iterators.empty() && iterators.front() == &terminator;
+   return std::make_pair(in_progress.size(), terminated ? 0 : iterators.size() + prioritized.size());
+}
+
+template <typename Integer, typename TagType>
+panda::List<Integer, TagType>::List(const Names& names_, const ClassRegistryType registry_type, const OutputWriter& output_, const JobPriority<Integer>& priority_)
 :
    names(names_),
    mutex(),
    workers(1),
    condition(),
-   rows(),
+   rows(registry_type),
    iterators(),
-   counter(0)
+   priority(priority_),
+   prioritized(),
+   sequence(0),
+   terminator(),
+   counter(0),
+   discovered(),
+   in_progress(),
+   output(output_)
 {
 }
 
@@ -133,6 +227,68 @@ template <typename Integer, typename TagType>
 bool panda::List<Integer, TagType>::empty() const
 {
    const std::lock_guard<std::mutex> lock(mutex);
-   return workers == 0 && iterators.empty();
+   return workers == 0 && iterators.empty() && prioritized.empty();
+}
+
+template <typename Integer, typename TagType>
+std::vector<double> panda::List<Integer, TagType>::priorities(const std::vector<const Row<Integer>*>& jobs) const
+{
+   std::vector<double> result;
+   if ( priority )
+   {
+      result.reserve(jobs.size());
+      for ( const auto job : jobs )
+      {
+         result.push_back(priority(*job));
+      }
+   }
+   return result;
+}
+
+template <typename Integer, typename TagType>
+void panda::List<Integer, TagType>::enqueue(const std::vector<const Row<Integer>*>& jobs, const std::vector<double>& job_priorities) const
+{
+   if ( !priority )
+   {
+      iterators.insert(iterators.end(), jobs.cbegin(), jobs.cend());
+      return;
+   }
+   assert( jobs.size() == job_priorities.size() );
+   for ( std::size_t i = 0; i < jobs.size(); ++i )
+   {
+      prioritized.push_back(PrioritizedJob{job_priorities[i], sequence++, jobs[i]});
+      std::push_heap(prioritized.begin(), prioritized.end(), later);
+   }
 }
 
+template <typename Integer, typename TagType>
+bool panda::List<Integer, TagType>::later(const PrioritizedJob& a, const PrioritizedJob& b)
+{
+   if ( a.priority < b.priority || b.priority < a.priority )
+   {
+      return b.priority < a.priority;
+   }
+   return a.sequence > b.sequence;
+}
+
+template <typename Integer, typename TagType>
+void panda::List<Integer, TagType>::print(const std::vector<const Row<Integer>*>& new_rows) const
+{
+   if ( new_rows.empty() )
+   {
+      return;
+   }
+   std::stringstream stream;
+   for ( const auto row : new_rows )
+   {
+      if ( std::is_same<TagType, tag::facet>::value )
+      {
+         algorithm::prettyPrintln(stream, *row, names, "<=");
+      }
+      else
+      {
+         stream << *row << '\n';
+      }
+   }
+   output.write(stream.str());
+}
@@ -8,12 +8,19 @@
 
 #include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <map>
 #include <mutex>
-#include <set>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "class_registry.h"
+#include "class_registry_type.h"
+#include "job_order.h"
 #include "matrix.h"
 #include "names.h"
+#include "output_writer.h"
 #include "row.h"
 #include "tags.h"
 
@@ -24,30 +31,70 @@ namespace panda
    {
       public:
          /// merges rows with the list of rows held in the list.
+         /// Marks the end of one job (the rows are its result). All rows are queued at once.
          void put(const Matrix<Integer>&) const;
          /// merges a row with the list of rows held in the list.
          void put(const Row<Integer>&) const;
          /// Returns a row that wasn't ever returned here before. Blocks the
          /// caller until data is available.
          Row<Integer> get() const;
+         /// Returns all classes found so far and the jobs that are queued or in progress.
+         /// Every other class is completely processed, i.e. all its neighbours are among the classes.
+         /// The rows stay valid as long as the list exists.
+         std::pair<std::vector<const Row<Integer>*>, std::vector<const Row<Integer>*>> snapshot() const;
+         /// Restores the state of a previous run from the classes found (first argument)
+         /// and the jobs that were queued or in progress (second argument).
+         /// Marks the end of the initial job, like put(const Matrix<Integer>&).
+         void restore(const Matrix<Integer>&, const Matrix<Integer>&) const;
+         /// Returns the number of jobs in progress and the number of queued jobs.
+         std::pair<std::size_t, std::size_t> load() const;
          #pragma GCC diagnostic push
          #pragma GCC diagnostic ignored "-Weffc++"
          /// Constructor: special thing here: number of active workers is initialized
-         /// to 1 (allowing heuristic to fill in once).
-         List(const Names&);
+         /// to 1 (allowing heuristic to fill in once). The second argument selects the
+         /// registry holding the classes, new classes are printed via the third argument.
+         /// Jobs are handed out in order of the fourth argument (FIFO if empty).
+         List(const Names&, const ClassRegistryType, const OutputWriter&, const JobPriority<Integer>&);
          #pragma GCC diagnostic pop
       private:
          const Names names;
          mutable std::mutex mutex;
          mutable std::size_t workers;
          mutable std::condition_variable condition;
-         mutable std::set<Row<Integer>> rows;
-         using Iterator = typename std::set<Row<Integer>>::iterator;
-         mutable std::vector<Iterator> iterators;
+         mutable ClassRegistry<Integer> rows;
+         /// queued jobs, pointing into rows (in order of insertion).
+         mutable std::deque<const Row<Integer>*> iterators;
+         /// A queued job together with its priority.
+         struct PrioritizedJob
+         {
+            double priority;
+            /// position in order of insertion (ties are handed out FIFO).
+            std::size_t sequence;
+            const Row<Integer>* row;
+         };
+         const JobPriority<Integer> priority;
+         /// queued jobs as a heap (only used if a priority is given, instead of iterators).
+         mutable std::vector<PrioritizedJob> prioritized;
+         mutable std::size_t sequence;
+         /// queued to signal that all jobs are done.
+         const Row<Integer> terminator;
          mutable std::size_t counter;
+         /// all queued rows (in order of insertion).
+         mutable std::vector<const Row<Integer>*> discovered;
+         /// jobs in progress by the thread that processes them.
+         mutable std::map<std::thread::id, const Row<Integer>*> in_progress;
+         const OutputWriter& output;
       private:
          /// checks if all jobs are done.
          bool empty() const;
+         /// computes the priorities of new jobs (outside of the lock of the list).
+         std::vector<double> priorities(const std::vector<const Row<Integer>*>&) const;
+         /// queues new jobs. The caller has to hold the lock.
+         void enqueue(const std::vector<const Row<Integer>*>&, const std::vector<double>&) const;
+         /// heap order: true if the first job is handed out after the second one.
+         static bool later(const PrioritizedJob&, const PrioritizedJob&);
+         /// formats new rows and hands them to the output (outside of the lock of the list).
+         void print(const std::vector<const Row<Integer>*>&) const;
    };
 }
 
@@ -64,7 +64,7 @@ namespace
       printVersion();
       std::cerr << "Commands:\n"
                 << "\t-i <n>\n\t--integer-type=<n>\n"
-                << "\t\twith <n> being \"16\", \"32\", \"64\", \"safe\" or \"inf\".\n"
+                << "\t\twith <n> being \"16\", \"32\", \"64\", \"128\", \"safe\", \"safe128\", \"adaptive\", \"inf\" or \"auto\".\n"
                 << '\n'
                 << "\t-k <path/to/file>\n\t--known-data=<path/to/file>\n\t--known-facets=<path/to/file>\n\t--known-vertices=<path/to/file>\n"
                 << "\t\toptional way to provide initial data to the adjacency decomposition.\n"
@@ -80,12 +80,50 @@ namespace
                 << "\t\t              or \"nz_desc\" / \"nonzero_descending\"\n"
                 << "\t\t              or \"rev\" / \"reverse\".\n"
                 << '\n'
+                << "\t--dd-order=<arg>\n"
+                << "\t\twith <arg> being \"minindex\" (default), \"maxindex\", \"lexmin\", \"mincutoff\" or \"random\".\n"
+                << '\n'
+                << "\t--job-order=<arg>\n"
+                << "\t\twith <arg> being \"fifo\" (default)\n"
+                << "\t\t              or \"inc_asc\" / \"incidence_ascending\"\n"
+                << "\t\t              or \"inc_desc\" / \"incidence_descending\"\n"
+                << "\t\t              or \"score:<w1>,<w2>,...\".\n"
+                << '\n'
                 << "\t-c\n\t--check\n"
                 << "\t\tenables check if input is valid (e.g. checks if maps are actually bijections).\n"
                 << '\n'
                 << "\t-t <n>\n\t--threads=<n>\n"
                 << "\t\twith <n> being a natural number greater than zero.\n"
                 << '\n'
+                << "\t--job-scheduler=<s>\n"
+                << "\t\twith <s> being \"single-queue\" (\"single\", default)\n"
+                << "\t\t          or \"work-stealing\" (\"ws\").\n"
+                << '\n'
+                << "\t--class-registry=<s>\n"
+                << "\t\twith <s> being \"hashed\" (default)\n"
+                << "\t\t          or \"ordered\".\n"
+                << '\n'
+                << "\t--output=<path/to/file>\n"
+                << "\t\toptional file the results of the adjacency decomposition are written to (default: standard output).\n"
+                << '\n'
+                << "\t--flush-interval=<n>\n"
+                << "\t\twith <n> being the number of milliseconds between two flushes of the output (default: 100).\n"
+                << '\n'
+                << "\t--checkpoint=<path/to/file>\n"
+                << "\t\toptional file the state of the adjacency decomposition is saved to periodically.\n"
+                << '\n'
+                << "\t--checkpoint-interval=<n>\n"
+                << "\t\twith <n> being the number of seconds between two checkpoints (default: 600).\n"
+                << '\n'
+                << "\t--resume=<path/to/file>\n"
+                << "\t\tcontinues the adjacency decomposition from a checkpoint.\n"
+                << '\n'
+                << "\t--recursion-depth=<n>\n"
+                << "\t\twith <n> being how often the ridges of a facet may be found by a nested adjacency decomposition (default: 0).\n"
+                << '\n'
+                << "\t--recursion-threshold=<n>\n"
+                << "\t\twith <n> being the number of vertices on a facet above which its ridges are found recursively (default: 100).\n"
+                << '\n'
                 << "\t-h <arg>\n\t--help=<arg>\n\t--help-command=<arg>\n"
                 << "\t\twith <arg> being a valid command (i.e. one occuring in this list).\n"
                 << '\n'
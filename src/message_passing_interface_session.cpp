@@ -47,6 +47,14 @@ int panda::mpi::Session::getNumberOfNodes() const noexcept
    #endif
 }
 
+int panda::mpi::Session::broadcast(int value) const noexcept
+{
+   #ifdef MPI_SUPPORT
+   MPI_Bcast(&value, 1, MPI_INT, 0, MPI_COMM_WORLD);
+   #endif
+   return value;
+}
+
 #pragma clang diagnostic pop
 
 panda::mpi::Session::Session() noexcept
@@ -24,6 +24,8 @@ namespace panda
             bool isMaster() const noexcept;
             /// Returns the number of nodes in the setup.
             int getNumberOfNodes() const noexcept;
+            /// Returns the value given on the master on every node. Every node has to call it.
+            int broadcast(int) const noexcept;
             friend mpi::Session& mpi::getSession() noexcept;
          private:
             /// Constructor.
@@ -10,24 +10,51 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstdlib>
 #include <future>
 #include <iostream>
 #include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 #include "algorithm_classes.h"
 #include "algorithm_fourier_motzkin_elimination.h"
+#include "algorithm_inequality_operations.h"
 #include "algorithm_map_operations.h"
 #include "algorithm_matrix_operations.h"
 #include "algorithm_rotation.h"
 #include "algorithm_row_operations.h"
+#include "big_integer.h"
+#include "checkpoint.h"
+#include "checkpoint_file.h"
 #include "concurrency.h"
+#include "decimal.h"
+#include "dense_matrix.h"
+#include "equivalence_index.h"
+#include "input_detection.h"
 #include "joining_thread.h"
 #include "message_passing_interface_session.h"
+#include "output.h"
+#include "recursion.h"
+#include "symmetries.h"
 
 using namespace panda;
 
 namespace
 {
+   /// Returns the priority of jobs in the pool. The second argument is the input (vertices / inequalities).
+   template <typename Integer, typename TagType>
+   JobPriority<Integer> jobPriority(const JobOrder&, const Matrix<Integer>&, TagType);
+
+   /// Returns the number of rows of the input that are incident with a job.
+   template <typename Integer>
+   std::size_t incidence(const Row<Integer>&, const Matrix<Integer>&, tag::facet);
+
+   template <typename Integer>
+   std::size_t incidence(const Row<Integer>&, const Matrix<Integer>&, tag::vertex);
+
    template <typename Integer>
    std::pair<Equations<Integer>, Maps> reduce(const JobManager<Integer, tag::facet>&, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>>& data);
 
@@ -47,13 +74,25 @@ namespace
    std::pair<Equations<Integer>, Maps> reduceDeterministic(const JobManagerType<Integer, tag::vertex>&, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>, Matrix<Integer>>& data);
 
    template <typename Integer>
-   std::future<void> initializePool(JobManager<Integer, tag::facet>&, const Matrix<Integer>&, const Maps&, const Matrix<Integer>&, const Equations<Integer>&);
+   std::future<void> initializePool(JobManager<Integer, tag::facet>&, const Matrix<Integer>&, const Symmetries<Integer, tag::facet>&, const Matrix<Integer>&, const Equations<Integer>&, const std::string&);
 
    template <typename Integer>
-   std::future<void> initializePool(JobManager<Integer, tag::vertex>&, const Matrix<Integer>&, const Maps&, const Matrix<Integer>&, const Equations<Integer>&);
+   std::future<void> initializePool(JobManager<Integer, tag::vertex>&, const Matrix<Integer>&, const Symmetries<Integer, tag::vertex>&, const Matrix<Integer>&, const Equations<Integer>&, const std::string&);
+
+   template <typename Integer, typename TagType>
+   std::future<void> initializePool(JobManagerProxy<Integer, TagType>&, const Matrix<Integer>&, const Symmetries<Integer, TagType>&, const Matrix<Integer>&, const Equations<Integer>&, const std::string&);
 
+   /// Marks the classes of a checkpoint as known, such that a resumed run doesn't hand them out again.
    template <typename Integer, typename TagType>
-   std::future<void> initializePool(JobManagerProxy<Integer, TagType>&, const Matrix<Integer>&, const Maps&, const Matrix<Integer>&, const Equations<Integer>&);
+   void restoreKnownClasses(const JobManager<Integer, TagType>&, const EquivalenceIndex<Integer, TagType>&, const std::string&);
+
+   /// Only the master reads the checkpoint.
+   template <typename Integer, typename TagType>
+   void restoreKnownClasses(const JobManagerProxy<Integer, TagType>&, const EquivalenceIndex<Integer, TagType>&, const std::string&);
+
+   /// Prints the size and the hit rate of the cache of class representatives.
+   template <typename Integer, typename TagType>
+   void reportClassCache(const Symmetries<Integer, TagType>&);
 }
 
 template <template <typename, typename> class JobManagerType, typename Integer, typename TagType>
@@ -61,15 +100,28 @@ void panda::implementation::adjacencyDecomposition(int argc, char** argv, const
 {
    const auto node_count = mpi::getSession().getNumberOfNodes();
    const auto thread_count = concurrency::numberOfThreads(argc, argv);
+   const auto scheduler = concurrency::jobScheduler(argc, argv);
+   const auto registry_type = concurrency::classRegistryType(argc, argv);
+   const auto output_file = output::filename(argc, argv);
+   const auto flush_interval = output::flushInterval(argc, argv);
+   const auto checkpoint_file = checkpoint::filename(argc, argv);
+   const auto checkpoint_interval = checkpoint::interval(argc, argv);
+   const auto resume_file = checkpoint::resumeFilename(argc, argv);
+   const Recursion recursion{recursion::threshold(argc, argv), recursion::depth(argc, argv)};
    const auto& input = std::get<0>(data);
+   const auto priority = jobPriority(getJobOrder(argc, argv), input, tag);
    const auto& names = std::get<1>(data);
    const auto& known_output = std::get<3>(data);
-   JobManagerType<Integer, TagType> job_manager(names, node_count, thread_count);
+   JobManagerType<Integer, TagType> job_manager(names, node_count, thread_count, scheduler, registry_type, output_file, flush_interval, checkpoint_file, checkpoint_interval, priority);
    const auto reduced_data = reduce(job_manager, data);
    const auto& equations = std::get<0>(reduced_data);
    const auto& maps = std::get<1>(reduced_data);
+   // the group and the cache of representatives are shared by all rotations.
+   const Symmetries<Integer, TagType> symmetries(maps);
+   // the rotations scan the input over and over again, hence, all threads share a contiguous copy.
+   const DenseMatrix<Integer> dense_input(input);
    std::list<JoiningThread> threads;
-   auto future = initializePool(job_manager, input, maps, known_output, equations);
+   auto future = initializePool(job_manager, input, symmetries, known_output, equations, resume_file);
    for ( int i = 0; i < thread_count; ++i )
    {
       threads.emplace_front([&]()
@@ -81,12 +133,14 @@ void panda::implementation::adjacencyDecomposition(int argc, char** argv, const
             {
                break;
             }
-            const auto jobs = algorithm::rotation(input, job, maps, tag);
+            const auto jobs = algorithm::rotation(dense_input, job, symmetries, job_manager.helperPool(), job_manager.parallelism(), recursion, tag);
             job_manager.put(jobs);
          }
       });
    }
    future.wait();
+   threads.clear();
+   reportClassCache(symmetries);
 }
 
 template <template <typename, typename> class JobManagerType, typename Integer, typename TagType>
@@ -94,24 +148,36 @@ void panda::implementation::adjacencyDecompositionDeterministic(int argc, char**
 {
    const auto node_count = mpi::getSession().getNumberOfNodes();
    const auto thread_count = concurrency::numberOfThreads(argc, argv);
+   const auto scheduler = concurrency::jobScheduler(argc, argv);
+   const auto registry_type = concurrency::classRegistryType(argc, argv);
+   const auto output_file = output::filename(argc, argv);
+   const auto flush_interval = output::flushInterval(argc, argv);
+   const auto checkpoint_file = checkpoint::filename(argc, argv);
+   const auto checkpoint_interval = checkpoint::interval(argc, argv);
+   const auto resume_file = checkpoint::resumeFilename(argc, argv);
+   const Recursion recursion{recursion::threshold(argc, argv), recursion::depth(argc, argv)};
    const auto& input = std::get<0>(data);
+   const auto priority = jobPriority(getJobOrder(argc, argv), input, tag);
    const auto& names = std::get<1>(data);
    const auto& known_output = std::get<3>(data);
    const auto& deterministics = std::get<4>(data);
-   JobManagerType<Integer, TagType> job_manager(names, node_count, thread_count);
+   JobManagerType<Integer, TagType> job_manager(names, node_count, thread_count, scheduler, registry_type, output_file, flush_interval, checkpoint_file, checkpoint_interval, priority);
    // reduce with accordance to deterministic parts
    const auto reduced_data = reduceDeterministic(job_manager, data);
    const auto& equations = std::get<0>(reduced_data);
    const auto& maps = std::get<1>(reduced_data);
+   const EquivalenceIndex<Integer, TagType> known_classes(deterministics, maps);
+   restoreKnownClasses(job_manager, known_classes, resume_file);
+   const Symmetries<Integer, TagType> symmetries(maps);
+   const DenseMatrix<Integer> dense_input(input);
    std::list<JoiningThread> threads;
    // initialization. Running with know output is recommended, otherwise we might find too many starting facets
-   auto future = initializePool(job_manager, input, maps, known_output, equations);
+   auto future = initializePool(job_manager, input, symmetries, known_output, equations, resume_file);
    for ( int i = 0; i < thread_count; ++i )
    {
 
       threads.emplace_front([&]()
                             {
-                               Matrix<Integer> all_classes;
                                while ( true )
                                {
                                   const auto job = job_manager.get();
@@ -119,47 +185,129 @@ void panda::implementation::adjacencyDecompositionDeterministic(int argc, char**
                                   {
                                      break;
                                   }
-                                  // add job to all classes
-                                  all_classes.push_back(job);
+                                  // add job to all classes (jobs of the initialization aren't known yet)
+                                  known_classes.insert(job);
                                   // rotate using the deterministic function
-                                  const auto jobs = algorithm::rotationDeterministic(input, job, maps,deterministics, tag);
+                                  const auto jobs = algorithm::rotationDeterministic(dense_input, job, symmetries, deterministics, job_manager.helperPool(), job_manager.parallelism(), recursion, tag);
                                   //const auto jobs = algorithm::rotation(input, job, maps, tag);
                                   // std::cerr << "Finished running rotationDeterministic \n";
-                                  // check for equivalence in the new jobs
+                                  // check for equivalence in the new jobs, the index is shared by all threads
                                   Matrix<Integer> new_jobs;
                                   for ( auto job_curr : jobs)
                                   {
-                                     bool isEquiv = false;
-                                     for ( auto bell : all_classes)
-                                     {
-                                        // check the equivalence
-                                        if ( panda::algorithm::checkEquivalenceMaps(job_curr, bell, deterministics, maps, tag))
-                                        {
-                                           isEquiv = true;
-                                           break;
-                                        }
-                                     }
-                                     if (!isEquiv)
+                                     if ( known_classes.insert(job_curr) )
                                      {
                                         new_jobs.push_back(job_curr);
-                                        all_classes.push_back(job_curr);
-                                        std::cerr << "new job: ";
-                                        for(int i=0; i<job_curr.size(); i++)
-                                           std::cerr << job_curr[i] << ' ';
-                                        std::cerr << "\n";
                                      }
-
                                   }
-                                  std::cerr << "number of new jobs: " << new_jobs.size() << "\n";
                                   job_manager.put(new_jobs);
                                }
                             });
    }
    future.wait();
+   threads.clear();
+   reportClassCache(symmetries);
 }
 
 namespace
 {
+   template <typename Integer, typename TagType>
+   void restoreKnownClasses(const JobManager<Integer, TagType>&, const EquivalenceIndex<Integer, TagType>& known_classes, const std::string& resume_file)
+   {
+      if ( resume_file.empty() )
+      {
+         return;
+      }
+      for ( const auto& row : checkpoint::read<Integer>(resume_file).first )
+      {
+         known_classes.insert(row);
+      }
+   }
+
+   template <typename Integer, typename TagType>
+   void restoreKnownClasses(const JobManagerProxy<Integer, TagType>&, const EquivalenceIndex<Integer, TagType>&, const std::string&)
+   {
+   }
+
+   template <typename Integer, typename TagType>
+   void reportClassCache(const Symmetries<Integer, TagType>& symmetries)
+   {
+      const auto statistics = symmetries.cache.statistics();
+      if ( statistics.lookups == 0 )
+      {
+         return;
+      }
+      std::ostringstream stream;
+      stream << "Class cache: " << statistics.size << " rows, " << statistics.hits << " of " << statistics.lookups << " lookups found";
+      stream << " (" << (100 * statistics.hits / statistics.lookups) << "%)\n";
+      std::cerr << stream.str();
+   }
+
+   template <typename Integer, typename TagType>
+   JobPriority<Integer> jobPriority(const JobOrder& order, const Matrix<Integer>& input, TagType tag)
+   {
+      switch ( order.type )
+      {
+         case JobOrderType::Fifo:
+         {
+            return JobPriority<Integer>();
+         }
+         case JobOrderType::IncidenceAscending:
+         {
+            return [&input, tag](const Row<Integer>& job)
+            {
+               return static_cast<double>(incidence(job, input, tag));
+            };
+         }
+         case JobOrderType::IncidenceDescending:
+         {
+            return [&input, tag](const Row<Integer>& job)
+            {
+               return -static_cast<double>(incidence(job, input, tag));
+            };
+         }
+         case JobOrderType::Score:
+         {
+            if ( input.empty() || order.weights.size() != input.front().size() )
+            {
+               const auto columns = input.empty() ? 0 : input.front().size();
+               throw std::invalid_argument("Option \"--job-order=score:<w1>,<w2>,...\" expects " + std::to_string(columns) + " weights (one per entry of a job, including the right hand side).");
+            }
+            const auto weights = order.weights;
+            return [weights](const Row<Integer>& job)
+            {
+               assert( job.size() == weights.size() );
+               // summed at arbitrary precision and rounded once, the score may exceed the integer type of the jobs.
+               BigInteger score(int32_t(0));
+               for ( std::size_t i = 0; i < job.size(); ++i )
+               {
+                  score += BigInteger(int32_t(weights[i])) * decimal::fromString<BigInteger>(decimal::toString(job[i]));
+               }
+               return std::strtod(decimal::toString(score).c_str(), nullptr);
+            };
+         }
+      }
+      return JobPriority<Integer>();
+   }
+
+   template <typename Integer>
+   std::size_t incidence(const Row<Integer>& facet, const Matrix<Integer>& vertices, tag::facet)
+   {
+      return static_cast<std::size_t>(std::count_if(vertices.cbegin(), vertices.cend(), [&facet](const Vertex<Integer>& vertex)
+      {
+         return algorithm::distance(facet, vertex) == 0;
+      }));
+   }
+
+   template <typename Integer>
+   std::size_t incidence(const Row<Integer>& vertex, const Matrix<Integer>& inequalities, tag::vertex)
+   {
+      return static_cast<std::size_t>(std::count_if(inequalities.cbegin(), inequalities.cend(), [&vertex](const Inequality<Integer>& inequality)
+      {
+         return algorithm::distance(inequality, vertex) == 0;
+      }));
+   }
+
    template <typename Integer, typename Callable>
    std::pair<Equations<Integer>, Maps> reduce(const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>>& data, Callable&& callable)
    {
@@ -193,24 +341,28 @@ namespace
    }
 
    template <typename Integer>
-   std::pair<Equations<Integer>, Maps> reduce(const JobManager<Integer, tag::facet>&, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>>& data)
+   std::pair<Equations<Integer>, Maps> reduce(const JobManager<Integer, tag::facet>& manager, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>>& data)
    {
-      return reduce(data, [](const Matrix<Integer>& equations, const Names& names)
+      return reduce(data, [&](const Matrix<Integer>& equations, const Names& names)
       {
-         std::cout << "Equations:\n";
-         algorithm::prettyPrint(std::cout, equations, names, "=");
-         std::cout << '\n';
+         std::stringstream stream;
+         stream << "Equations:\n";
+         algorithm::prettyPrint(stream, equations, names, "=");
+         stream << '\n';
+         manager.write(stream.str());
       });
    }
 
    template <typename Integer>
-   std::pair<Equations<Integer>, Maps> reduceDeterministic(const JobManager<Integer, tag::facet>&, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>, Matrix<Integer>>& data)
+   std::pair<Equations<Integer>, Maps> reduceDeterministic(const JobManager<Integer, tag::facet>& manager, const std::tuple<Matrix<Integer>, Names, Maps, Matrix<Integer>, Matrix<Integer>>& data)
    {
-      return reduceDeterministic(data, [](const Matrix<Integer>& equations, const Names& names)
+      return reduceDeterministic(data, [&](const Matrix<Integer>& equations, const Names& names)
       {
-         std::cout << "Equations:\n";
-         algorithm::prettyPrint(std::cout, equations, names, "=");
-         std::cout << '\n';
+         std::stringstream stream;
+         stream << "Equations:\n";
+         algorithm::prettyPrint(stream, equations, names, "=");
+         stream << '\n';
+         manager.write(stream.str());
       });
    }
 
@@ -241,14 +393,16 @@ namespace
    }
 
    template <typename Integer, typename TagType>
-   std::future<void> initializationOnMaster(JobManager<Integer, TagType>& manager, const Matrix<Integer>& matrix, const Maps& maps, const Matrix<Integer>& known_output, const Equations<Integer>& equations, const std::string& type_string)
+   std::future<void> initializationOnMaster(JobManager<Integer, TagType>& manager, const Matrix<Integer>& matrix, const Symmetries<Integer, TagType>& symmetries, const Matrix<Integer>& known_output, const Equations<Integer>& equations, const std::string& type_string, const std::string& resume_file)
    {
       assert ( (!std::is_same<TagType, tag::vertex>::value || equations.empty()) );
-      if ( !maps.empty() )
+      manager.write((symmetries.maps.empty() ? "" : "Reduced ") + type_string + ":\n");
+      if ( !resume_file.empty() )
       {
-         std::cout << "Reduced ";
+         // the checkpoint already contains the known data.
+         manager.resume(resume_file);
+         return std::async(std::launch::async, [](){});
       }
-      std::cout << type_string << ":\n";
       // Initialize the process (so that other processes start).
       if ( !known_output.empty() )
       {
@@ -259,8 +413,8 @@ namespace
       else
       {
          auto facets = algorithm::fourierMotzkinEliminationHeuristic(matrix);
-         // only put one facet
-         manager.put(facets[0]);
+         // only put one facet. It is put as the result of the initial job, such that the pool can run empty.
+         manager.put(Matrix<Integer>{facets.front()});
 
 //         for ( auto& facet : facets )
 //         {
@@ -275,7 +429,7 @@ namespace
          for ( const auto& facet : known_output )
          {
             auto tmp = algorithm::normalize(facet, equations);
-            tmp = algorithm::classRepresentative(tmp, maps, TagType{});
+            tmp = algorithm::classRepresentative(tmp, symmetries, TagType{});
             manager.put(tmp);
          }
       });
@@ -283,19 +437,19 @@ namespace
    }
 
    template <typename Integer>
-   std::future<void> initializePool(JobManager<Integer, tag::facet>& manager, const Matrix<Integer>& matrix, const Maps& maps, const Matrix<Integer>& known_output, const Equations<Integer>& equations)
+   std::future<void> initializePool(JobManager<Integer, tag::facet>& manager, const Matrix<Integer>& matrix, const Symmetries<Integer, tag::facet>& symmetries, const Matrix<Integer>& known_output, const Equations<Integer>& equations, const std::string& resume_file)
    {
-      return initializationOnMaster(manager, matrix, maps, known_output, equations, "Inequalities");
+      return initializationOnMaster(manager, matrix, symmetries, known_output, equations, "Inequalities", resume_file);
    }
 
    template <typename Integer>
-   std::future<void> initializePool(JobManager<Integer, tag::vertex>& manager, const Matrix<Integer>& matrix, const Maps& maps, const Matrix<Integer>& known_output, const Equations<Integer>&)
+   std::future<void> initializePool(JobManager<Integer, tag::vertex>& manager, const Matrix<Integer>& matrix, const Symmetries<Integer, tag::vertex>& symmetries, const Matrix<Integer>& known_output, const Equations<Integer>&, const std::string& resume_file)
    {
-      return initializationOnMaster(manager, matrix, maps, known_output, {}, "Vertices / Rays");
+      return initializationOnMaster(manager, matrix, symmetries, known_output, {}, "Vertices / Rays", resume_file);
    }
 
    template <typename Integer, typename TagType>
-   std::future<void> initializePool(JobManagerProxy<Integer, TagType>&, const ConvexHull<Integer>&, const Maps&, const Inequalities<Integer>&, const Equations<Integer>&)
+   std::future<void> initializePool(JobManagerProxy<Integer, TagType>&, const ConvexHull<Integer>&, const Symmetries<Integer, TagType>&, const Inequalities<Integer>&, const Equations<Integer>&, const std::string&)
    {
       // only the manager on the root node performs a heuristic to get initial facets.
       auto future = std::async(std::launch::async, [](){});
@@ -16,8 +16,11 @@
 #include "algorithm_matrix_operations.h"
 #include "algorithm_row_operations.h"
 #include "application_name.h"
+#include "concurrency.h"
 #include "input.h"
+#include "input_detection.h"
 #include "integer_type_selection.h"
+#include "symmetries.h"
 
 using namespace panda;
 
@@ -144,8 +147,10 @@ namespace
          std::cout << '\n';
       }
       // computation part 2: identifying inequalities
-      auto inequalities = algorithm::fourierMotzkinElimination(vertices);
-      inequalities = algorithm::classes(inequalities, reduced_maps, tag::facet{});
+      const auto thread_count = static_cast<std::size_t>(concurrency::numberOfThreads(argc, argv));
+      const auto insertion_order = getInsertionOrder(argc, argv);
+      auto inequalities = algorithm::fourierMotzkinElimination(vertices, thread_count, insertion_order);
+      inequalities = algorithm::classes(inequalities, Symmetries<Integer, tag::facet>(reduced_maps), tag::facet{});
       // output
       const auto is_reduced = !maps.empty();
       print(std::move(inequalities), std::move(names), is_reduced);
@@ -172,8 +177,10 @@ namespace
       const auto& inequalities = std::get<0>(data);
       const auto& maps = std::get<2>(data);
       // computation: identifying extremal vertices and rays
-      auto matrix = algorithm::fourierMotzkinElimination(inequalities);
-      matrix = algorithm::classes(matrix, maps, tag::vertex{});
+      const auto thread_count = static_cast<std::size_t>(concurrency::numberOfThreads(argc, argv));
+      const auto insertion_order = getInsertionOrder(argc, argv);
+      auto matrix = algorithm::fourierMotzkinElimination(inequalities, thread_count, insertion_order);
+      matrix = algorithm::classes(matrix, Symmetries<Integer, tag::vertex>(maps), tag::vertex{});
       // output
       const auto is_reduced = !maps.empty();
       print(std::move(matrix), is_reduced);
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "output.h"
+
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+using namespace panda;
+
+namespace
+{
+   /// Tries to read a positive number of milliseconds from char*.
+   std::chrono::milliseconds interpretInterval(char*);
+}
+
+std::string panda::output::filename(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--output=", 9) == 0 )
+      {
+         if ( argv[i][9] == '\0' )
+         {
+            throw std::invalid_argument("Command line option \"--output=<file>\" needs a file name.");
+         }
+         return argv[i] + 9;
+      }
+   }
+   return ""; // default value: standard output
+}
+
+std::chrono::milliseconds panda::output::flushInterval(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--flush-interval=", 17) == 0 )
+      {
+         return interpretInterval(argv[i] + 17);
+      }
+   }
+   return std::chrono::milliseconds(100); // default value
+}
+
+namespace
+{
+   std::chrono::milliseconds interpretInterval(char* string)
+   {
+      assert( string != nullptr );
+      std::istringstream stream(string);
+      long n;
+      std::string rest;
+      if ( !(stream >> n) || (stream >> rest) || n <= 0 )
+      {
+         throw std::invalid_argument("Command line option \"--flush-interval=<ms>\" needs an integral parameter greater zero.");
+      }
+      return std::chrono::milliseconds(n);
+   }
+}
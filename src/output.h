@@ -0,0 +1,21 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace panda
+{
+   namespace output
+   {
+      /// Returns the name of the file the results are written to. Empty means standard output.
+      std::string filename(int, char**);
+      /// Returns the time between two flushes of the output.
+      std::chrono::milliseconds flushInterval(int, char**);
+   }
+}
+
@@ -0,0 +1,154 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "output_writer.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+using namespace panda;
+
+namespace
+{
+   /// Size of the chunk that is built before it is handed to the stream.
+   constexpr std::size_t chunk_size = 1 << 20;
+   /// Returns the writers that currently exist.
+   std::set<const OutputWriter*>& writers();
+   /// Returns the mutex that guards writers().
+   std::mutex& writersMutex();
+   /// Flushes all existing writers. Registered with std::atexit, as std::exit doesn't destroy the writers.
+   void flushAll();
+}
+
+void panda::OutputWriter::write(std::string text) const
+{
+   auto node = new Node{std::move(text), head.load(std::memory_order_relaxed)};
+   while ( !head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed) )
+   {
+   }
+}
+
+void panda::OutputWriter::flush() const
+{
+   std::lock_guard<std::mutex> lock(stream_mutex);
+   drain();
+   stream.flush();
+}
+
+panda::OutputWriter::OutputWriter(const std::string& filename, const std::chrono::milliseconds interval_)
+:
+   file(),
+   stream(filename.empty() ? std::cout : file),
+   interval(interval_),
+   head(nullptr),
+   stream_mutex(),
+   mutex(),
+   condition(),
+   stopping(false),
+   thread()
+{
+   assert( interval.count() > 0 );
+   if ( !filename.empty() )
+   {
+      file.open(filename.c_str());
+      if ( !file )
+      {
+         throw std::invalid_argument("Failed to open output file \"" + filename + "\".");
+      }
+   }
+   {
+      // writers() and writersMutex() are constructed before the handler is registered,
+      // hence, they are destroyed after it is called.
+      static std::once_flag registration;
+      std::lock_guard<std::mutex> lock(writersMutex());
+      writers().insert(this);
+      std::call_once(registration, []() { std::atexit(flushAll); });
+   }
+   thread = std::thread(&OutputWriter::run, this);
+}
+
+panda::OutputWriter::~OutputWriter()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+   }
+   condition.notify_one();
+   thread.join();
+   std::lock_guard<std::mutex> lock(writersMutex());
+   writers().erase(this);
+}
+
+void panda::OutputWriter::run()
+{
+   bool done = false;
+   while ( !done )
+   {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         condition.wait_for(lock, interval, [&]() { return stopping; });
+         done = stopping;
+      }
+      flush();
+   }
+}
+
+void panda::OutputWriter::drain() const
+{
+   auto node = head.exchange(nullptr, std::memory_order_acquire);
+   // the list is in reverse order of the write calls.
+   Node* reversed = nullptr;
+   while ( node != nullptr )
+   {
+      const auto next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+   }
+   std::string chunk;
+   chunk.reserve(chunk_size);
+   while ( reversed != nullptr )
+   {
+      chunk += reversed->text;
+      if ( chunk.size() >= chunk_size )
+      {
+         stream << chunk;
+         chunk.clear();
+      }
+      const auto next = reversed->next;
+      delete reversed;
+      reversed = next;
+   }
+   stream << chunk;
+}
+
+namespace
+{
+   std::set<const OutputWriter*>& writers()
+   {
+      static std::set<const OutputWriter*> instance;
+      return instance;
+   }
+
+   std::mutex& writersMutex()
+   {
+      static std::mutex instance;
+      return instance;
+   }
+
+   void flushAll()
+   {
+      std::lock_guard<std::mutex> lock(writersMutex());
+      for ( const auto writer : writers() )
+      {
+         writer->flush();
+      }
+   }
+}
+
@@ -0,0 +1,64 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace panda
+{
+   /// Decouples the output of results from the threads that compute them.
+   /// Any thread hands over formatted text without taking a lock. A dedicated writer thread
+   /// collects the text, writes it in large chunks and flushes the stream once per interval.
+   /// Text of a single write call is never interleaved with text of another call.
+   /// Queued text is also written if the process is terminated via std::exit.
+   class OutputWriter
+   {
+      public:
+         /// Queues text for output. Lock-free.
+         void write(std::string) const;
+         /// Writes all queued text and flushes the stream before returning.
+         void flush() const;
+         /// Constructor. Output goes to the file of the given name, or to std::cout if the name is empty.
+         /// The second argument is the time between two flushes of the output.
+         OutputWriter(const std::string&, const std::chrono::milliseconds);
+         /// Destructor. Writes and flushes all queued text before returning.
+         ~OutputWriter();
+         /// Copy construction is not allowed.
+         OutputWriter(const OutputWriter&) = delete;
+         /// Copy assignment is not allowed.
+         OutputWriter& operator=(const OutputWriter&) = delete;
+      private:
+         /// Singly linked list of queued text (newest first).
+         struct Node
+         {
+            std::string text;
+            Node* next;
+         };
+         std::ofstream file;
+         std::ostream& stream;
+         const std::chrono::milliseconds interval;
+         mutable std::atomic<Node*> head;
+         /// guards the stream, such that only one thread drains the queue at a time.
+         mutable std::mutex stream_mutex;
+         std::mutex mutex;
+         std::condition_variable condition;
+         bool stopping;
+         std::thread thread;
+      private:
+         /// Main loop of the writer thread.
+         void run();
+         /// Writes all queued text to the stream. The caller has to hold stream_mutex.
+         void drain() const;
+   };
+}
+
@@ -0,0 +1,361 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_PERMUTATION_GROUP
+#include "permutation_group.h"
+#undef COMPILE_TEMPLATE_PERMUTATION_GROUP
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <stdexcept>
+
+#include "algorithm_map_operations.h"
+
+using namespace panda;
+
+namespace
+{
+   using Permutation = std::vector<std::size_t>;
+   /// Returns the permutation "first after second".
+   Permutation compose(const Permutation&, const Permutation&);
+   /// Returns the inverse permutation.
+   Permutation inverse(const Permutation&);
+   /// Returns the identity on the given number of points.
+   Permutation identity(const std::size_t);
+   /// Returns true if the second point is in the orbit of the first point under the group generated by the permutations.
+   bool inOrbit(const std::vector<Permutation>&, const std::size_t, const std::size_t);
+}
+
+bool panda::PermutationGroup::accepts(const Maps& maps)
+{
+   if ( maps.empty() )
+   {
+      return false;
+   }
+   // the kind of a map doesn't depend on the type of the rows.
+   const auto dimension = maps.front().size();
+   return std::all_of(maps.cbegin(), maps.cend(), [dimension](const Map& map)
+   {
+      return map.size() == dimension && algorithm::compile(map, tag::vertex{}).kind != MapKind::General;
+   });
+}
+
+template <typename Integer>
+Row<Integer> panda::PermutationGroup::largestImage(const Row<Integer>& row) const
+{
+   assert( row.size() == dimension() );
+   // the values of all points, i.e. the row and its negative.
+   Row<Integer> values(2 * row.size());
+   for ( std::size_t i = 0; i < row.size(); ++i )
+   {
+      values[2 * i] = row[i];
+      values[2 * i + 1] = -row[i];
+   }
+   // every element of the group is a product of one transversal element per level.
+   // The search keeps all partial products that lead to the largest prefix, but only one per distinct permuted row.
+   std::set<Row<Integer>> candidates{values};
+   for ( const auto& level : levels )
+   {
+      auto best = candidates.cbegin()->at(level.base);
+      for ( const auto& candidate : candidates )
+      {
+         for ( const auto point : level.orbit )
+         {
+            best = std::max(best, candidate[point]);
+         }
+      }
+      std::set<Row<Integer>> next;
+      for ( const auto& candidate : candidates )
+      {
+         for ( const auto point : level.orbit )
+         {
+            if ( candidate[point] == best )
+            {
+               const auto& element = level.transversal[point];
+               Row<Integer> image(candidate.size());
+               for ( std::size_t i = 0; i < image.size(); ++i )
+               {
+                  image[i] = candidate[element[i]];
+               }
+               next.insert(std::move(image));
+            }
+         }
+      }
+      candidates.swap(next);
+   }
+   assert( !candidates.empty() );
+   const auto& largest = *candidates.cbegin();
+   Row<Integer> result(row.size());
+   for ( std::size_t i = 0; i < result.size(); ++i )
+   {
+      result[i] = largest[2 * i];
+   }
+   return result;
+}
+
+template <typename Integer>
+CompiledMaps panda::PermutationGroup::stabilizer(const Row<Integer>& row) const
+{
+   assert( row.size() == dimension() );
+   Row<Integer> values(2 * row.size());
+   for ( std::size_t i = 0; i < row.size(); ++i )
+   {
+      values[2 * i] = row[i];
+      values[2 * i + 1] = -row[i];
+   }
+   // when a level is processed, the generators found so far generate the stabiliser within the group of the next level.
+   // The stabiliser within the group of the level is generated by them and one element for each point of the orbit
+   // of the base point under the stabiliser, hence, points that are already reached by the generators are skipped.
+   std::vector<Permutation> generators;
+   for ( auto index = levels.size(); index-- > 0; )
+   {
+      const auto& level = levels[index];
+      for ( const auto point : level.orbit )
+      {
+         if ( point == level.base || values[point] != values[level.base] || inOrbit(generators, level.base, point) )
+         {
+            continue;
+         }
+         Permutation element;
+         if ( keepsValues(values, level.transversal[point], index + 1, element) )
+         {
+            generators.push_back(std::move(element));
+         }
+      }
+   }
+   CompiledMaps result;
+   result.reserve(generators.size());
+   for ( const auto& generator : generators )
+   {
+      result.push_back(compiled(generator));
+   }
+   return result;
+}
+
+std::size_t panda::PermutationGroup::dimension() const noexcept
+{
+   return levels.size();
+}
+
+template <typename TagType>
+panda::PermutationGroup::PermutationGroup(const Maps& maps, TagType tag)
+:
+   PermutationGroup(accepts(maps) ? algorithm::compile(maps, tag) : CompiledMaps{})
+{
+}
+
+panda::PermutationGroup::PermutationGroup(const CompiledMaps& maps)
+:
+   levels()
+{
+   if ( !signedPermutations(maps) )
+   {
+      throw std::invalid_argument("Permutation group: all maps have to be signed permutations of the coordinates.");
+   }
+   const auto points = 2 * maps.front().indices.size();
+   for ( std::size_t base = 0; base < points; base += 2 )
+   {
+      Level level{base, {}, std::vector<Permutation>(points), {base}};
+      level.transversal[base] = identity(points);
+      levels.push_back(std::move(level));
+   }
+   for ( const auto& map : maps )
+   {
+      const auto generator = permutation(map);
+      if ( !contains(generator, 0) )
+      {
+         add(0, generator);
+      }
+   }
+}
+
+bool panda::PermutationGroup::signedPermutations(const CompiledMaps& maps)
+{
+   if ( maps.empty() )
+   {
+      return false;
+   }
+   const auto dimension = maps.front().indices.size();
+   return std::all_of(maps.cbegin(), maps.cend(), [dimension](const CompiledMap& map)
+   {
+      return map.kind != MapKind::General && map.indices.size() == dimension;
+   });
+}
+
+PermutationGroup::Permutation panda::PermutationGroup::permutation(const CompiledMap& map)
+{
+   assert( map.kind != MapKind::General );
+   // entry i of the image is (the negative of) entry indices[i], i.e. the image is a gather of the points.
+   Permutation result(2 * map.indices.size());
+   for ( std::size_t i = 0; i < map.indices.size(); ++i )
+   {
+      result[2 * i] = 2 * map.indices[i] + (map.signs[i] < 0 ? 1 : 0);
+      result[2 * i + 1] = result[2 * i] ^ 1;
+   }
+   return result;
+}
+
+void panda::PermutationGroup::add(const std::size_t index, const Permutation& generator)
+{
+   assert( index < levels.size() );
+   levels[index].generators.push_back(generator);
+   // the orbit grows while the old points are combined with the new generator.
+   const auto orbit = levels[index].orbit;
+   for ( const auto point : orbit )
+   {
+      extend(index, compose(generator, levels[index].transversal[point]));
+   }
+}
+
+void panda::PermutationGroup::extend(const std::size_t index, const Permutation& element)
+{
+   auto& level = levels[index];
+   const auto point = element[level.base];
+   if ( level.transversal[point].empty() )
+   {
+      level.transversal[point] = element;
+      level.orbit.push_back(point);
+      for ( std::size_t i = 0; i < level.generators.size(); ++i )
+      {
+         extend(index, compose(level.generators[i], element));
+      }
+   }
+   else
+   {
+      // Schreier generator: fixes the base point, hence, it belongs to the next level.
+      const auto schreier = compose(inverse(level.transversal[point]), element);
+      if ( !contains(schreier, index + 1) )
+      {
+         add(index + 1, schreier);
+      }
+   }
+}
+
+bool panda::PermutationGroup::contains(Permutation element, std::size_t index) const
+{
+   for ( ; index < levels.size(); ++index )
+   {
+      const auto& level = levels[index];
+      const auto& transversal = level.transversal[element[level.base]];
+      if ( transversal.empty() )
+      {
+         return false;
+      }
+      element = compose(inverse(transversal), element);
+   }
+   // all base points are fixed, which only holds for the identity.
+   return true;
+}
+
+template <typename Integer>
+bool panda::PermutationGroup::keepsValues(const Row<Integer>& values, const Permutation& element, const std::size_t index, Permutation& result) const
+{
+   if ( index == levels.size() )
+   {
+      // the values of all coordinates (and hence their negatives) are kept.
+      result = element;
+      return true;
+   }
+   const auto& level = levels[index];
+   for ( const auto point : level.orbit )
+   {
+      // the base point gets the value of the image of the point under the element.
+      if ( values[element[point]] == values[level.base] && keepsValues(values, compose(element, level.transversal[point]), index + 1, result) )
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+CompiledMap panda::PermutationGroup::compiled(const Permutation& permutation)
+{
+   const auto size = permutation.size() / 2;
+   CompiledMap result{MapKind::Permutation, std::vector<Index>(size), std::vector<Factor>(size, 1), {}};
+   for ( std::size_t i = 0; i < size; ++i )
+   {
+      result.indices[i] = permutation[2 * i] / 2;
+      if ( permutation[2 * i] % 2 == 1 )
+      {
+         result.signs[i] = -1;
+         result.kind = MapKind::SignedPermutation;
+      }
+   }
+   return result;
+}
+
+template PermutationGroup::PermutationGroup(const Maps&, tag::facet);
+template PermutationGroup::PermutationGroup(const Maps&, tag::vertex);
+
+namespace
+{
+   Permutation compose(const Permutation& first, const Permutation& second)
+   {
+      assert( first.size() == second.size() );
+      Permutation result(second.size());
+      for ( std::size_t i = 0; i < second.size(); ++i )
+      {
+         result[i] = first[second[i]];
+      }
+      return result;
+   }
+
+   Permutation inverse(const Permutation& permutation)
+   {
+      Permutation result(permutation.size());
+      for ( std::size_t i = 0; i < permutation.size(); ++i )
+      {
+         result[permutation[i]] = i;
+      }
+      return result;
+   }
+
+   bool inOrbit(const std::vector<Permutation>& generators, const std::size_t start, const std::size_t point)
+   {
+      if ( start == point )
+      {
+         return true;
+      }
+      if ( generators.empty() )
+      {
+         return false;
+      }
+      std::vector<bool> reached(generators.front().size(), false);
+      std::vector<std::size_t> todo{start};
+      reached[start] = true;
+      while ( !todo.empty() )
+      {
+         const auto current = todo.back();
+         todo.pop_back();
+         for ( const auto& generator : generators )
+         {
+            const auto image = generator[current];
+            if ( image == point )
+            {
+               return true;
+            }
+            if ( !reached[image] )
+            {
+               reached[image] = true;
+               todo.push_back(image);
+            }
+         }
+      }
+      return false;
+   }
+
+   Permutation identity(const std::size_t size)
+   {
+      Permutation result(size);
+      for ( std::size_t i = 0; i < size; ++i )
+      {
+         result[i] = i;
+      }
+      return result;
+   }
+}
+
@@ -0,0 +1,83 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "compiled_map.h"
+#include "maps.h"
+#include "row.h"
+#include "tags.h"
+
+namespace panda
+{
+   /// Group generated by maps that are signed permutations, i.e. every image of a map is a single
+   /// coordinate with factor 1 or -1. A coordinate and its negative are two points of the permutations.
+   /// The group is stored as a stabilizer chain (base and strong generating set, built with Schreier-Sims)
+   /// with the coordinates in their natural order as base. Hence, the largest row of a class
+   /// can be found coordinate by coordinate without enumerating the whole class.
+   class PermutationGroup
+   {
+      public:
+         /// Returns true if all maps are signed permutations.
+         static bool accepts(const Maps&);
+         /// Returns true if all compiled maps are signed permutations of the same number of coordinates.
+         static bool signedPermutations(const CompiledMaps&);
+         /// Returns the lexicographically largest row in the class of the row (i.e. the representative of getClass).
+         /// Precondition: the entries of the row don't have a common divisor.
+         template <typename Integer>
+         Row<Integer> largestImage(const Row<Integer>&) const;
+         /// Returns generators of the stabiliser of the row, i.e. of all elements of the group that map the row onto itself.
+         /// The generators are found by a backtrack search along the stabilizer chain, level by level from the last one,
+         /// such that the result generates the whole stabiliser (not only the subgroup of generators fixing the row).
+         template <typename Integer>
+         CompiledMaps stabilizer(const Row<Integer>&) const;
+         /// Returns the number of coordinates.
+         std::size_t dimension() const noexcept;
+         /// Constructor. Throws std::invalid_argument if a map isn't a signed permutation.
+         template <typename TagType>
+         PermutationGroup(const Maps&, TagType);
+         /// Constructor for maps that are already compiled (for either tag).
+         /// Throws std::invalid_argument if a map isn't a signed permutation.
+         explicit PermutationGroup(const CompiledMaps&);
+      private:
+         /// Permutation of the points 0, ..., 2 * dimension - 1. Point 2i is coordinate i, point 2i+1 is its negative.
+         using Permutation = std::vector<std::size_t>;
+         /// One step of the stabilizer chain: the group that fixes all previous base points.
+         struct Level
+         {
+            /// the base point 2i of coordinate i.
+            std::size_t base;
+            /// the generators that were added on this level.
+            std::vector<Permutation> generators;
+            /// for every point of the orbit of the base point a permutation mapping the base point onto it, empty otherwise.
+            std::vector<Permutation> transversal;
+            /// the points of the orbit of the base point.
+            std::vector<std::size_t> orbit;
+         };
+         std::vector<Level> levels;
+      private:
+         /// Converts a compiled (signed) permutation into a permutation of the points.
+         static Permutation permutation(const CompiledMap&);
+         /// Adds a generator to a level of the stabilizer chain.
+         void add(const std::size_t, const Permutation&);
+         /// Extends the orbit of a level by the image of its base point under the permutation.
+         void extend(const std::size_t, const Permutation&);
+         /// Returns true if the permutation is in the group that fixes the base points of the previous levels.
+         bool contains(Permutation, std::size_t) const;
+         /// Searches the levels from the given one on for a product of transversal elements that, applied after the
+         /// given permutation, keeps the values of all base points. Stores the product in the last argument if found.
+         template <typename Integer>
+         bool keepsValues(const Row<Integer>&, const Permutation&, const std::size_t, Permutation&) const;
+         /// Converts a permutation of the points into a compiled (signed) permutation.
+         static CompiledMap compiled(const Permutation&);
+   };
+}
+
+#include "permutation_group.eti"
+
@@ -0,0 +1,64 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "recursion.h"
+
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace panda;
+
+namespace
+{
+   /// Tries to read a non-negative number from char*, the option name is used for the error message.
+   std::size_t interpretNumber(char*, const std::string&);
+}
+
+std::size_t panda::recursion::threshold(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--recursion-threshold=", 22) == 0 )
+      {
+         return interpretNumber(argv[i] + 22, "--recursion-threshold=<n>");
+      }
+   }
+   return 100; // default value
+}
+
+std::size_t panda::recursion::depth(int argc, char** argv)
+{
+   assert( argc > 0 && argv != nullptr );
+   for ( int i = 1; i < argc; ++i )
+   {
+      if ( std::strncmp(argv[i], "--recursion-depth=", 18) == 0 )
+      {
+         return interpretNumber(argv[i] + 18, "--recursion-depth=<n>");
+      }
+   }
+   return 0; // default value: no recursion
+}
+
+namespace
+{
+   std::size_t interpretNumber(char* string, const std::string& option)
+   {
+      assert( string != nullptr );
+      std::istringstream stream(string);
+      long n;
+      std::string rest;
+      if ( !(stream >> n) || (stream >> rest) || n < 0 )
+      {
+         throw std::invalid_argument("Command line option \"" + option + "\" needs a non-negative integral parameter.");
+      }
+      return static_cast<std::size_t>(n);
+   }
+}
+
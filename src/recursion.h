@@ -0,0 +1,30 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+
+namespace panda
+{
+   /// Parameters of the recursive adjacency decomposition of facets with many vertices.
+   /// The ridges of a facet with more vertices than the threshold are found by adjacency
+   /// decomposition of the facet instead of Fourier-Motzkin elimination, up to the given depth.
+   struct Recursion
+   {
+      std::size_t threshold;
+      std::size_t depth;
+   };
+
+   namespace recursion
+   {
+      /// Returns the number of vertices on a facet above which its ridges are found recursively.
+      std::size_t threshold(int, char**);
+      /// Returns the maximal depth of the recursion. Zero means no recursion.
+      std::size_t depth(int, char**);
+   }
+}
+
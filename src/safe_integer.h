@@ -15,6 +15,8 @@ namespace panda
 
    /// Absolute value.
    inline SafeInteger abs(SafeInteger);
+   /// Hash value (equal numbers have equal hash values).
+   inline std::size_t hash(const SafeInteger&) noexcept;
 
    class SafeInteger
    {
@@ -106,6 +108,18 @@ namespace panda
          inline SafeInteger operator-() const;
          /// Absolute value.
          friend SafeInteger abs(SafeInteger);
+         /// Hash value.
+         friend std::size_t hash(const SafeInteger&) noexcept;
+         /// The following operations work on whole ranges (e.g. rows). They combine the overflow checks of all entries
+         /// and evaluate them once at the end. If an exception is thrown, the values of a modified range are unspecified.
+         /// Returns the scalar product of [first, last) with the range starting at the third argument.
+         inline static SafeInteger scalarProduct(const SafeInteger*, const SafeInteger*, const SafeInteger*);
+         /// Multiplies all entries of [first, last) with a factor.
+         inline static void scale(SafeInteger*, SafeInteger*, const SafeInteger);
+         /// Adds the range starting at the third argument to [first, last).
+         inline static void add(SafeInteger*, SafeInteger*, const SafeInteger*);
+         /// Subtracts the range starting at the third argument from [first, last).
+         inline static void subtract(SafeInteger*, SafeInteger*, const SafeInteger*);
       public:
          /// Underlying data type.
          using DataType = int64_t;
@@ -4,6 +4,7 @@
 // License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
 //-------------------------------------------------------------------------------//
 
+#include <functional>
 #include <limits>
 #include <stdexcept>
 #include <string>
@@ -19,10 +20,17 @@ namespace panda
    }
 }
 
+// GCC and Clang detect overflows with the flags of the processor, which is much faster than the portable checks.
+#if defined(__GNUC__) || defined(__clang__)
+   #define SAFE_INTEGER_BUILTINS
+#endif
+
 #include "safe_integer_arithmetics.tpp"
 #include "safe_integer_comparisons.tpp"
 #include "safe_integer_constructors.tpp"
 
+#undef SAFE_INTEGER_BUILTINS
+
 panda::SafeInteger panda::SafeInteger::operator-() const
 {
    constexpr static bool symmetric_range = (DataLimits::min() + DataLimits::max() == 0);
@@ -40,6 +48,11 @@ panda::SafeInteger panda::abs(SafeInteger n)
    return (n < 0) ? -n : n;
 }
 
+std::size_t panda::hash(const SafeInteger& n) noexcept
+{
+   return std::hash<SafeInteger::DataType>()(n.data);
+}
+
 namespace panda
 {
    namespace
@@ -0,0 +1,31 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "safe_integer_128.h"
+
+#ifdef __SIZEOF_INT128__
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace panda;
+
+void panda::SafeInteger128::error(const char* reason, const DataType a)
+{
+   std::ostringstream message;
+   message << "Unsafe integer operation: " << reason << " Argument: " << a;
+   throw std::invalid_argument(message.str());
+}
+
+void panda::SafeInteger128::error(const char* reason, const DataType a, const DataType b)
+{
+   std::ostringstream message;
+   message << "Unsafe integer operation: " << reason << " Arguments: " << a << ", " << b;
+   throw std::invalid_argument(message.str());
+}
+
+#endif
+
@@ -0,0 +1,132 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "int128.h"
+
+#ifdef __SIZEOF_INT128__
+namespace panda
+{
+   class SafeInteger128;
+
+   /// Absolute value.
+   inline SafeInteger128 abs(SafeInteger128);
+   /// Hash value (equal numbers have equal hash values).
+   inline std::size_t hash(const SafeInteger128&) noexcept;
+
+   /// 128 bit integer that throws an exception if an operation is unsafe (like SafeInteger with 64 bits).
+   class SafeInteger128
+   {
+      public:
+         #pragma GCC diagnostic push
+         #pragma GCC diagnostic ignored "-Weffc++"
+         /// Default constructor (value zero).
+         SafeInteger128() = default;
+         #pragma GCC diagnostic pop
+         /// Default copy constructor.
+         SafeInteger128(const SafeInteger128&) = default;
+         /// Default move constructor.
+         SafeInteger128(SafeInteger128&&) = default;
+         /// Default copy assignment operator.
+         SafeInteger128& operator=(const SafeInteger128&) = default;
+         /// Default move assignment operator.
+         SafeInteger128& operator=(SafeInteger128&&) = default;
+         #ifdef INT16_MAX
+         /// Constructor from int16_t.
+         explicit inline SafeInteger128(const int16_t) noexcept;
+         #endif
+         #ifdef INT32_MAX
+         /// Constructor from int32_t.
+         explicit inline SafeInteger128(const int32_t) noexcept;
+         #endif
+         #ifdef INT64_MAX
+         /// Constructor from int64_t.
+         explicit inline SafeInteger128(const int64_t) noexcept;
+         #endif
+         #ifdef UINT16_MAX
+         /// Constructor from uint16_t.
+         explicit inline SafeInteger128(const uint16_t) noexcept;
+         #endif
+         #ifdef UINT32_MAX
+         /// Constructor from uint32_t.
+         explicit inline SafeInteger128(const uint32_t) noexcept;
+         #endif
+         #ifdef UINT64_MAX
+         /// Constructor from uint64_t.
+         explicit inline SafeInteger128(const uint64_t) noexcept;
+         #endif
+         /// Conversion to int.
+         inline operator int() const;
+         /// Comparison "equals" with integer.
+         inline bool operator==(const int) const noexcept;
+         /// Comparison "not equals" with integer.
+         inline bool operator!=(const int) const noexcept;
+         /// Comparison "less than" with integer.
+         inline bool operator<(const int) const noexcept;
+         /// Comparison "greater than" with integer.
+         inline bool operator>(const int) const noexcept;
+         /// Comparison "less than or equal to" with integer.
+         inline bool operator<=(const int) const noexcept;
+         /// Comparison "greater than or equal to" with integer.
+         inline bool operator>=(const int) const noexcept;
+         /// Comparison "equals" with SafeInteger128.
+         inline bool operator==(const SafeInteger128&) const noexcept;
+         /// Comparison "not equals" with SafeInteger128.
+         inline bool operator!=(const SafeInteger128&) const noexcept;
+         /// Comparison "less than" with SafeInteger128.
+         inline bool operator<(const SafeInteger128&) const noexcept;
+         /// Comparison "greater than" with SafeInteger128.
+         inline bool operator>(const SafeInteger128&) const noexcept;
+         /// Comparison "less than or equal to" with SafeInteger128.
+         inline bool operator<=(const SafeInteger128&) const noexcept;
+         /// Comparison "greater than or equal to" with SafeInteger128.
+         inline bool operator>=(const SafeInteger128&) const noexcept;
+         /// Multiplication (a *= b).
+         inline SafeInteger128& operator*=(const SafeInteger128&);
+         /// Division (a /= b).
+         inline SafeInteger128& operator/=(const SafeInteger128&);
+         /// Addition (a += b).
+         inline SafeInteger128& operator+=(const SafeInteger128&);
+         /// Subtraction (a -= b).
+         inline SafeInteger128& operator-=(const SafeInteger128&);
+         /// Modulo (a %= b).
+         inline SafeInteger128& operator%=(const SafeInteger128&);
+         /// Multiplication (a * b).
+         inline SafeInteger128 operator*(const SafeInteger128&) const;
+         /// Division (a / b).
+         inline SafeInteger128 operator/(const SafeInteger128&) const;
+         /// Addition (a + b).
+         inline SafeInteger128 operator+(const SafeInteger128&) const;
+         /// Subtraction (a - b).
+         inline SafeInteger128 operator-(const SafeInteger128&) const;
+         /// Modulo (a % b).
+         inline SafeInteger128 operator%(const SafeInteger128&) const;
+         /// Negation (-a).
+         inline SafeInteger128 operator-() const;
+         /// Absolute value.
+         friend SafeInteger128 abs(SafeInteger128);
+         /// Hash value.
+         friend std::size_t hash(const SafeInteger128&) noexcept;
+      public:
+         /// Underlying data type.
+         using DataType = int128_t;
+      private:
+         /// Throws std::invalid_argument with the reason and the arguments of the failed operation.
+         [[noreturn]] static void error(const char*, const DataType);
+         /// Same as above for binary operations.
+         [[noreturn]] static void error(const char*, const DataType, const DataType);
+      private:
+         DataType data;
+   };
+}
+
+#include "safe_integer_128.tpp"
+#endif
+
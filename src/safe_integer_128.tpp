@@ -0,0 +1,249 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include <functional>
+#include <limits>
+
+#ifdef INT16_MAX
+panda::SafeInteger128::SafeInteger128(const int16_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+#ifdef INT32_MAX
+panda::SafeInteger128::SafeInteger128(const int32_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+#ifdef INT64_MAX
+panda::SafeInteger128::SafeInteger128(const int64_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+#ifdef UINT16_MAX
+panda::SafeInteger128::SafeInteger128(const uint16_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+#ifdef UINT32_MAX
+panda::SafeInteger128::SafeInteger128(const uint32_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+#ifdef UINT64_MAX
+panda::SafeInteger128::SafeInteger128(const uint64_t value) noexcept
+:
+   data(value)
+{
+}
+#endif
+
+panda::SafeInteger128::operator int() const
+{
+   if ( data > std::numeric_limits<int>::max() || data < std::numeric_limits<int>::min() )
+   {
+      error("The value of type SafeInteger128 cannot be safely converted into an int.", data);
+   }
+   return static_cast<int>(data);
+}
+
+bool panda::SafeInteger128::operator==(const int second) const noexcept
+{
+   return data == second;
+}
+
+bool panda::SafeInteger128::operator!=(const int second) const noexcept
+{
+   return !(*this == second);
+}
+
+bool panda::SafeInteger128::operator<(const int second) const noexcept
+{
+   return data < second;
+}
+
+bool panda::SafeInteger128::operator>(const int second) const noexcept
+{
+   return data > second;
+}
+
+bool panda::SafeInteger128::operator<=(const int second) const noexcept
+{
+   return !(*this > second);
+}
+
+bool panda::SafeInteger128::operator>=(const int second) const noexcept
+{
+   return !(*this < second);
+}
+
+bool panda::SafeInteger128::operator==(const SafeInteger128& second) const noexcept
+{
+   return data == second.data;
+}
+
+bool panda::SafeInteger128::operator!=(const SafeInteger128& second) const noexcept
+{
+   return !(*this == second);
+}
+
+bool panda::SafeInteger128::operator<(const SafeInteger128& second) const noexcept
+{
+   return data < second.data;
+}
+
+bool panda::SafeInteger128::operator>(const SafeInteger128& second) const noexcept
+{
+   return second < *this;
+}
+
+bool panda::SafeInteger128::operator<=(const SafeInteger128& second) const noexcept
+{
+   return !(*this > second);
+}
+
+bool panda::SafeInteger128::operator>=(const SafeInteger128& second) const noexcept
+{
+   return !(*this < second);
+}
+
+panda::SafeInteger128& panda::SafeInteger128::operator*=(const SafeInteger128& second)
+{
+   DataType result;
+   if ( __builtin_mul_overflow(data, second.data, &result) )
+   {
+      error("Multiplication did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+}
+
+panda::SafeInteger128& panda::SafeInteger128::operator/=(const SafeInteger128& second)
+{
+   if ( second.data == 0 )
+   {
+      error("Dividing by zero.", data, second.data);
+   }
+   if ( second.data == -1 )
+   {
+      *this = -*this;
+      return *this;
+   }
+   data /= second.data; // cannot overflow, as either it's division by 1 or the magnitude will decrease.
+   return *this;
+}
+
+panda::SafeInteger128& panda::SafeInteger128::operator+=(const SafeInteger128& second)
+{
+   DataType result;
+   if ( __builtin_add_overflow(data, second.data, &result) )
+   {
+      error("Addition did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+}
+
+panda::SafeInteger128& panda::SafeInteger128::operator-=(const SafeInteger128& second)
+{
+   DataType result;
+   if ( __builtin_sub_overflow(data, second.data, &result) )
+   {
+      error("Subtraction did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+}
+
+panda::SafeInteger128& panda::SafeInteger128::operator%=(const SafeInteger128& second)
+{
+   if ( second.data == 0 )
+   {
+      error("Modulo zero is undefined.", data, second.data);
+   }
+   if ( second.data < 0 )
+   {
+      error("Modulo a negative number is non-sense.", data, second.data);
+   }
+   data %= second.data; // cannot overflow
+   if ( data < 0 )
+   {
+      data += second.data;
+   }
+   return *this;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator*(const SafeInteger128& second) const
+{
+   auto copy = *this;
+   copy *= second;
+   return copy;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator/(const SafeInteger128& second) const
+{
+   auto copy = *this;
+   copy /= second;
+   return copy;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator+(const SafeInteger128& second) const
+{
+   auto copy = *this;
+   copy += second;
+   return copy;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator-(const SafeInteger128& second) const
+{
+   auto copy = *this;
+   copy -= second;
+   return copy;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator%(const SafeInteger128& second) const
+{
+   auto copy = *this;
+   copy %= second;
+   return copy;
+}
+
+panda::SafeInteger128 panda::SafeInteger128::operator-() const
+{
+   if ( data == std::numeric_limits<DataType>::min() )
+   {
+      error("The value cannot be negated.", data);
+   }
+   SafeInteger128 result = *this;
+   result.data = -result.data;
+   return result;
+}
+
+panda::SafeInteger128 panda::abs(SafeInteger128 n)
+{
+   return (n < 0) ? -n : n;
+}
+
+std::size_t panda::hash(const SafeInteger128& n) noexcept
+{
+   const auto bits = static_cast<uint128_t>(n.data);
+   return std::hash<uint64_t>()(static_cast<uint64_t>(bits)) ^ (std::hash<uint64_t>()(static_cast<uint64_t>(bits >> 64)) * 31);
+}
+
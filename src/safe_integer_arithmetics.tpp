@@ -6,6 +6,15 @@
 
 panda::SafeInteger& panda::SafeInteger::operator*=(const SafeInteger& second)
 {
+   #ifdef SAFE_INTEGER_BUILTINS
+   DataType result;
+   if ( __builtin_mul_overflow(data, second.data, &result) )
+   {
+      error("Multiplication did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+   #else
    if ( data == 0 || second.data == 0 )
    {
       data = 0;
@@ -24,6 +33,7 @@ panda::SafeInteger& panda::SafeInteger::operator*=(const SafeInteger& second)
    }
    data *= second.data;
    return *this;
+   #endif
 }
 
 panda::SafeInteger& panda::SafeInteger::operator/=(const SafeInteger& second)
@@ -43,6 +53,15 @@ panda::SafeInteger& panda::SafeInteger::operator/=(const SafeInteger& second)
 
 panda::SafeInteger& panda::SafeInteger::operator+=(const SafeInteger& second)
 {
+   #ifdef SAFE_INTEGER_BUILTINS
+   DataType result;
+   if ( __builtin_add_overflow(data, second.data, &result) )
+   {
+      error("Addition did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+   #else
    if ( (data > 0 && second.data > 0 && second.data > DataLimits::max() - data) ||
         (data < 0 && second.data < 0 && second.data < DataLimits::min() - data) )
    {
@@ -50,10 +69,20 @@ panda::SafeInteger& panda::SafeInteger::operator+=(const SafeInteger& second)
    }
    data += second.data;
    return *this;
+   #endif
 }
 
 panda::SafeInteger& panda::SafeInteger::operator-=(const SafeInteger& second)
 {
+   #ifdef SAFE_INTEGER_BUILTINS
+   DataType result;
+   if ( __builtin_sub_overflow(data, second.data, &result) )
+   {
+      error("Subtraction did overflow.", data, second.data);
+   }
+   data = result;
+   return *this;
+   #else
    if ( second.data < 0 && data > DataLimits::max() + second.data )
    {  // A <= A - (-B), therefore MIN <= A - (-B) <= MAX, if A <= MAX + (-B)
       error("Subtraction did overflow.", data, second.data);
@@ -64,6 +93,7 @@ panda::SafeInteger& panda::SafeInteger::operator-=(const SafeInteger& second)
    }
    data -= second.data;
    return *this;
+   #endif
 }
 
 panda::SafeInteger& panda::SafeInteger::operator%=(const SafeInteger& second)
@@ -119,3 +149,86 @@ panda::SafeInteger panda::SafeInteger::operator%(const SafeInteger& second) cons
    return copy;
 }
 
+panda::SafeInteger panda::SafeInteger::scalarProduct(const SafeInteger* first, const SafeInteger* last, const SafeInteger* second)
+{
+   SafeInteger result{};
+   #ifdef SAFE_INTEGER_BUILTINS
+   bool overflow = false;
+   for ( auto entry = first, factor = second; entry != last; ++entry, ++factor )
+   {
+      DataType product;
+      overflow |= __builtin_mul_overflow(entry->data, factor->data, &product);
+      overflow |= __builtin_add_overflow(result.data, product, &result.data);
+   }
+   if ( !overflow )
+   {
+      return result;
+   }
+   result.data = 0; // repeat with the checks of the single operations to report the overflowing operation.
+   #endif
+   for ( ; first != last; ++first, ++second )
+   {
+      result += *first * *second;
+   }
+   return result;
+}
+
+void panda::SafeInteger::scale(SafeInteger* first, SafeInteger* last, const SafeInteger factor)
+{
+   #ifdef SAFE_INTEGER_BUILTINS
+   bool overflow = false;
+   for ( auto entry = first; entry != last; ++entry )
+   {
+      overflow |= __builtin_mul_overflow(entry->data, factor.data, &entry->data);
+   }
+   if ( overflow )
+   {
+      error("Multiplication of a row (with the given number of entries) did overflow.", last - first);
+   }
+   #else
+   for ( ; first != last; ++first )
+   {
+      *first *= factor;
+   }
+   #endif
+}
+
+void panda::SafeInteger::add(SafeInteger* first, SafeInteger* last, const SafeInteger* second)
+{
+   #ifdef SAFE_INTEGER_BUILTINS
+   bool overflow = false;
+   for ( auto entry = first; entry != last; ++entry, ++second )
+   {
+      overflow |= __builtin_add_overflow(entry->data, second->data, &entry->data);
+   }
+   if ( overflow )
+   {
+      error("Addition of rows (with the given number of entries) did overflow.", last - first);
+   }
+   #else
+   for ( ; first != last; ++first, ++second )
+   {
+      *first += *second;
+   }
+   #endif
+}
+
+void panda::SafeInteger::subtract(SafeInteger* first, SafeInteger* last, const SafeInteger* second)
+{
+   #ifdef SAFE_INTEGER_BUILTINS
+   bool overflow = false;
+   for ( auto entry = first; entry != last; ++entry, ++second )
+   {
+      overflow |= __builtin_sub_overflow(entry->data, second->data, &entry->data);
+   }
+   if ( overflow )
+   {
+      error("Subtraction of rows (with the given number of entries) did overflow.", last - first);
+   }
+   #else
+   for ( ; first != last; ++first, ++second )
+   {
+      *first -= *second;
+   }
+   #endif
+}
@@ -0,0 +1,102 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+namespace panda
+{
+   /// A vector for trivially copyable values, which stores up to InlineCapacity values without allocation.
+   /// Only larger sizes move the values to the heap (and they stay there until destruction).
+   template <typename T, std::size_t InlineCapacity>
+   class SmallVector
+   {
+      static_assert(std::is_trivially_copyable<T>::value, "SmallVector only holds trivially copyable values.");
+      static_assert(InlineCapacity > 0, "SmallVector needs inline storage.");
+      public:
+         using value_type = T;
+         using iterator = T*;
+         using const_iterator = const T*;
+         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+         /// Default constructor (empty vector).
+         SmallVector() noexcept;
+         /// Constructor: n copies of a value.
+         SmallVector(const std::size_t, const T&);
+         /// Constructor from a list of values.
+         SmallVector(std::initializer_list<T>);
+         /// Copy constructor.
+         SmallVector(const SmallVector&);
+         /// Move constructor.
+         SmallVector(SmallVector&&) noexcept;
+         /// Copy assignment operator.
+         SmallVector& operator=(const SmallVector&);
+         /// Move assignment operator.
+         SmallVector& operator=(SmallVector&&) noexcept;
+         /// Assignment from a list of values.
+         SmallVector& operator=(std::initializer_list<T>);
+         /// Destructor.
+         ~SmallVector();
+         /// Number of values.
+         std::size_t size() const noexcept;
+         /// Returns whether there are no values.
+         bool empty() const noexcept;
+         /// Number of values that fit into the current storage.
+         std::size_t capacity() const noexcept;
+         /// Returns whether the values are stored inline (no allocation).
+         bool isInline() const noexcept;
+         /// Access to the i-th value.
+         T& operator[](const std::size_t) noexcept;
+         /// Access to the i-th value.
+         const T& operator[](const std::size_t) const noexcept;
+         /// Last value.
+         T& back() noexcept;
+         /// Last value.
+         const T& back() const noexcept;
+         /// Pointer to the first value.
+         T* data() noexcept;
+         /// Pointer to the first value.
+         const T* data() const noexcept;
+         iterator begin() noexcept;
+         iterator end() noexcept;
+         const_iterator begin() const noexcept;
+         const_iterator end() const noexcept;
+         const_iterator cbegin() const noexcept;
+         const_iterator cend() const noexcept;
+         const_reverse_iterator crbegin() const noexcept;
+         const_reverse_iterator crend() const noexcept;
+         /// Appends a value.
+         void push_back(const T&);
+         /// Removes the last value.
+         void pop_back() noexcept;
+         /// Changes the number of values, new values are value-initialized.
+         void resize(const std::size_t);
+         /// Replaces the values by n copies of a value.
+         void assign(const std::size_t, const T&);
+         /// Makes room for at least n values.
+         void reserve(const std::size_t);
+         /// Removes all values (keeping the storage).
+         void clear() noexcept;
+      private:
+         /// Moves the values to a heap buffer with room for at least n values.
+         void grow(const std::size_t);
+         /// Frees the heap buffer (if any).
+         void release() noexcept;
+         union Storage
+         {
+            T local[InlineCapacity];
+            T* heap;
+         } storage;
+         std::size_t count;
+         std::size_t space;
+   };
+}
+
+#include "small_vector.tpp"
+
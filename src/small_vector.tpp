@@ -0,0 +1,287 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cassert>
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::SmallVector() noexcept
+:
+   storage(),
+   count(0),
+   space(InlineCapacity)
+{
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::SmallVector(const std::size_t n, const T& value)
+:
+   storage(),
+   count(0),
+   space(InlineCapacity)
+{
+   assign(n, value);
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::SmallVector(std::initializer_list<T> values)
+:
+   storage(),
+   count(0),
+   space(InlineCapacity)
+{
+   *this = values;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::SmallVector(const SmallVector& other)
+:
+   storage(),
+   count(0),
+   space(InlineCapacity)
+{
+   *this = other;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::SmallVector(SmallVector&& other) noexcept
+:
+   storage(other.storage),
+   count(other.count),
+   space(other.space)
+{
+   other.count = 0;
+   other.space = InlineCapacity;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>& panda::SmallVector<T, InlineCapacity>::operator=(const SmallVector& other)
+{
+   if ( this != &other )
+   {
+      count = 0;
+      reserve(other.count);
+      std::copy(other.begin(), other.end(), data());
+      count = other.count;
+   }
+   return *this;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>& panda::SmallVector<T, InlineCapacity>::operator=(SmallVector&& other) noexcept
+{
+   if ( this != &other )
+   {
+      release();
+      storage = other.storage;
+      count = other.count;
+      space = other.space;
+      other.count = 0;
+      other.space = InlineCapacity;
+   }
+   return *this;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>& panda::SmallVector<T, InlineCapacity>::operator=(std::initializer_list<T> values)
+{
+   count = 0;
+   reserve(values.size());
+   std::copy(values.begin(), values.end(), data());
+   count = values.size();
+   return *this;
+}
+
+template <typename T, std::size_t InlineCapacity>
+panda::SmallVector<T, InlineCapacity>::~SmallVector()
+{
+   release();
+}
+
+template <typename T, std::size_t InlineCapacity>
+std::size_t panda::SmallVector<T, InlineCapacity>::size() const noexcept
+{
+   return count;
+}
+
+template <typename T, std::size_t InlineCapacity>
+bool panda::SmallVector<T, InlineCapacity>::empty() const noexcept
+{
+   return count == 0;
+}
+
+template <typename T, std::size_t InlineCapacity>
+std::size_t panda::SmallVector<T, InlineCapacity>::capacity() const noexcept
+{
+   return space;
+}
+
+template <typename T, std::size_t InlineCapacity>
+bool panda::SmallVector<T, InlineCapacity>::isInline() const noexcept
+{
+   return space == InlineCapacity;
+}
+
+template <typename T, std::size_t InlineCapacity>
+T& panda::SmallVector<T, InlineCapacity>::operator[](const std::size_t i) noexcept
+{
+   assert( i < count );
+   return data()[i];
+}
+
+template <typename T, std::size_t InlineCapacity>
+const T& panda::SmallVector<T, InlineCapacity>::operator[](const std::size_t i) const noexcept
+{
+   assert( i < count );
+   return data()[i];
+}
+
+template <typename T, std::size_t InlineCapacity>
+T& panda::SmallVector<T, InlineCapacity>::back() noexcept
+{
+   assert( count > 0 );
+   return data()[count - 1];
+}
+
+template <typename T, std::size_t InlineCapacity>
+const T& panda::SmallVector<T, InlineCapacity>::back() const noexcept
+{
+   assert( count > 0 );
+   return data()[count - 1];
+}
+
+template <typename T, std::size_t InlineCapacity>
+T* panda::SmallVector<T, InlineCapacity>::data() noexcept
+{
+   return isInline() ? storage.local : storage.heap;
+}
+
+template <typename T, std::size_t InlineCapacity>
+const T* panda::SmallVector<T, InlineCapacity>::data() const noexcept
+{
+   return isInline() ? storage.local : storage.heap;
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::iterator panda::SmallVector<T, InlineCapacity>::begin() noexcept
+{
+   return data();
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::iterator panda::SmallVector<T, InlineCapacity>::end() noexcept
+{
+   return data() + count;
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_iterator panda::SmallVector<T, InlineCapacity>::begin() const noexcept
+{
+   return data();
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_iterator panda::SmallVector<T, InlineCapacity>::end() const noexcept
+{
+   return data() + count;
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_iterator panda::SmallVector<T, InlineCapacity>::cbegin() const noexcept
+{
+   return begin();
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_iterator panda::SmallVector<T, InlineCapacity>::cend() const noexcept
+{
+   return end();
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_reverse_iterator panda::SmallVector<T, InlineCapacity>::crbegin() const noexcept
+{
+   return const_reverse_iterator(end());
+}
+
+template <typename T, std::size_t InlineCapacity>
+typename panda::SmallVector<T, InlineCapacity>::const_reverse_iterator panda::SmallVector<T, InlineCapacity>::crend() const noexcept
+{
+   return const_reverse_iterator(begin());
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::push_back(const T& value)
+{
+   const T copy = value; // value may refer to an element, which moves on growth.
+   reserve(count + 1);
+   data()[count] = copy;
+   ++count;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::pop_back() noexcept
+{
+   assert( count > 0 );
+   --count;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::resize(const std::size_t n)
+{
+   reserve(n);
+   if ( n > count )
+   {
+      std::fill(data() + count, data() + n, T());
+   }
+   count = n;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::assign(const std::size_t n, const T& value)
+{
+   const T copy = value;
+   count = 0;
+   reserve(n);
+   std::fill(data(), data() + n, copy);
+   count = n;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::reserve(const std::size_t n)
+{
+   if ( n > space )
+   {
+      grow(n);
+   }
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::clear() noexcept
+{
+   count = 0;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::grow(const std::size_t n)
+{
+   const auto new_space = std::max(n, 2 * space);
+   auto buffer = new T[new_space];
+   std::copy(begin(), end(), buffer);
+   release();
+   storage.heap = buffer;
+   space = new_space;
+}
+
+template <typename T, std::size_t InlineCapacity>
+void panda::SmallVector<T, InlineCapacity>::release() noexcept
+{
+   if ( !isInline() )
+   {
+      delete[] storage.heap;
+   }
+}
+
@@ -0,0 +1,51 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace panda
+{
+   /// Index over a set of bitsets that answers whether any of them is a subset of the union of two query bitsets.
+   /// The bitsets are stored in a binary tree (pattern tree) that splits on single bits, the most balanced bits first.
+   /// Bitsets with a split bit set can only be subsets if the query has the bit, too, so most subtrees are never visited.
+   /// Small subtrees are leaves that are scanned linearly, with the smallest bitsets first.
+   template <typename Bitset>
+   class SubsetIndex
+   {
+      public:
+         /// Constructor: all bitsets, the indices of those to be stored (in order of preference) and the hint of highest set bit.
+         /// The bitsets are referenced, not copied, and must outlive the index.
+         SubsetIndex(const std::vector<Bitset>&, const std::vector<std::size_t>&, const std::size_t);
+         /// Returns whether a stored bitset is contained in the union of the two arguments.
+         bool containsSubsetOfUnion(const Bitset&, const Bitset&) const noexcept;
+      private:
+         struct Node
+         {
+            /// The bit all bitsets in subtree "with" have and all in subtree "without" don't have.
+            std::size_t bit;
+            std::size_t without;
+            std::size_t with;
+            /// Range of the stored indices in a leaf.
+            std::size_t begin;
+            std::size_t end;
+            bool leaf;
+         };
+         /// Creates the node for the stored indices in [begin, end), splitting on the bits from the given position on.
+         std::size_t build(const std::size_t, const std::size_t, const std::size_t);
+         bool search(const std::size_t, const Bitset&, const Bitset&) const noexcept;
+         const std::vector<Bitset>& bitsets;
+         const std::size_t max;
+         std::vector<std::size_t> stored;
+         std::vector<std::size_t> bits;
+         std::vector<Node> nodes;
+   };
+}
+
+#include "subset_index.tpp"
+
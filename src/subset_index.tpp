@@ -0,0 +1,118 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cassert>
+
+namespace panda
+{
+   namespace subset_index
+   {
+      /// Subtrees with at most this many bitsets are scanned linearly.
+      constexpr std::size_t leaf_size = 16;
+   }
+}
+
+template <typename Bitset>
+panda::SubsetIndex<Bitset>::SubsetIndex(const std::vector<Bitset>& bitsets_, const std::vector<std::size_t>& indices, const std::size_t max_)
+:
+   bitsets(bitsets_),
+   max(max_),
+   stored(indices),
+   bits(),
+   nodes()
+{
+   if ( stored.empty() )
+   {
+      return;
+   }
+   // bits that are set in about half of the bitsets split best, bits set in none or all of them don't split at all.
+   std::vector<std::size_t> frequencies(max, 0);
+   for ( const auto index : stored )
+   {
+      for ( std::size_t bit = 0; bit < max; ++bit )
+      {
+         frequencies[bit] += bitsets[index].test(bit) ? 1 : 0;
+      }
+   }
+   for ( std::size_t bit = 0; bit < max; ++bit )
+   {
+      if ( frequencies[bit] != 0 && frequencies[bit] != stored.size() )
+      {
+         bits.push_back(bit);
+      }
+   }
+   const auto balance = [&](const std::size_t bit)
+   {
+      const auto twice = 2 * frequencies[bit];
+      return ( twice > stored.size() ) ? twice - stored.size() : stored.size() - twice;
+   };
+   std::stable_sort(bits.begin(), bits.end(), [&](const std::size_t a, const std::size_t b)
+   {
+      return balance(a) < balance(b);
+   });
+   build(0, stored.size(), 0);
+}
+
+template <typename Bitset>
+bool panda::SubsetIndex<Bitset>::containsSubsetOfUnion(const Bitset& a, const Bitset& b) const noexcept
+{
+   return !nodes.empty() && search(0, a, b);
+}
+
+template <typename Bitset>
+std::size_t panda::SubsetIndex<Bitset>::build(const std::size_t begin, const std::size_t end, std::size_t position)
+{
+   const auto id = nodes.size();
+   nodes.push_back(Node{0, 0, 0, begin, end, true});
+   if ( end - begin <= subset_index::leaf_size )
+   {
+      return id;
+   }
+   const auto first = stored.begin() + static_cast<std::vector<std::size_t>::difference_type>(begin);
+   const auto last = stored.begin() + static_cast<std::vector<std::size_t>::difference_type>(end);
+   for ( ; position < bits.size(); ++position )
+   {
+      const auto bit = bits[position];
+      const auto with = static_cast<std::size_t>(std::count_if(first, last, [&](const std::size_t index) { return bitsets[index].test(bit); }));
+      if ( with == 0 || with == end - begin )
+      {
+         continue;
+      }
+      // the partition is stable, so the preferred order is kept within the leaves.
+      std::stable_partition(first, last, [&](const std::size_t index) { return !bitsets[index].test(bit); });
+      const auto middle = end - with;
+      const auto without_child = build(begin, middle, position + 1);
+      const auto with_child = build(middle, end, position + 1);
+      nodes[id] = Node{bit, without_child, with_child, begin, end, false};
+      return id;
+   }
+   // all remaining bitsets are equal on the splitting bits.
+   return id;
+}
+
+template <typename Bitset>
+bool panda::SubsetIndex<Bitset>::search(const std::size_t id, const Bitset& a, const Bitset& b) const noexcept
+{
+   const auto& node = nodes[id];
+   if ( node.leaf )
+   {
+      for ( auto i = node.begin; i < node.end; ++i )
+      {
+         if ( Bitset::unionContains(a, b, bitsets[stored[i]], max) )
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+   if ( search(node.without, a, b) )
+   {
+      return true;
+   }
+   return (a.test(node.bit) || b.test(node.bit)) && search(node.with, a, b);
+}
+
@@ -0,0 +1,31 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_SYMMETRIES
+#include "symmetries.h"
+#undef COMPILE_TEMPLATE_SYMMETRIES
+
+#include <cstddef>
+
+#include "algorithm_map_operations.h"
+
+using namespace panda;
+
+namespace
+{
+   /// Upper bound on the number of rows in the cache of representatives.
+   constexpr std::size_t maximum_cache_size = std::size_t{1} << 18;
+}
+
+template <typename Integer, typename TagType>
+panda::Symmetries<Integer, TagType>::Symmetries(const Maps& maps_)
+:
+   maps(maps_),
+   compiled_maps(algorithm::compile(maps_, TagType{})),
+   group(PermutationGroup::accepts(maps_) ? new PermutationGroup(compiled_maps) : nullptr),
+   cache(maximum_cache_size)
+{
+}
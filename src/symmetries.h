@@ -0,0 +1,37 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <memory>
+
+#include "class_cache.h"
+#include "compiled_map.h"
+#include "maps.h"
+#include "permutation_group.h"
+#include "tags.h"
+
+namespace panda
+{
+   /// Everything that is derived once from the maps of a problem and shared by all threads.
+   /// It is built when the maps are known and handed to every algorithm that determines classes.
+   template <typename Integer, typename TagType>
+   struct Symmetries
+   {
+      /// Constructor. The maps are compiled for the tag, the group is only built if all maps are signed permutations.
+      explicit Symmetries(const Maps&);
+      const Maps maps;
+      /// the maps, compiled once for all applications.
+      const CompiledMaps compiled_maps;
+      /// the group generated by the maps if all of them are signed permutations, nullptr otherwise.
+      const std::unique_ptr<const PermutationGroup> group;
+      /// representatives of all (normalized) rows whose class was determined before.
+      const ClassCache<Integer> cache;
+   };
+}
+
+#include "symmetries.eti"
+
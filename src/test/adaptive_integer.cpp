@@ -0,0 +1,209 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "adaptive_integer.h"
+#include "big_integer.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void test_constructors();
+   void test_promotion();
+   void test_demotion();
+   void test_arithmetics();
+   void test_comparisons();
+   void test_operator_int();
+   void test_division_by_zero();
+   void test_hash();
+}
+
+int main()
+try
+{
+   test_constructors();
+   test_promotion();
+   test_demotion();
+   test_arithmetics();
+   test_comparisons();
+   test_operator_int();
+   test_division_by_zero();
+   test_hash();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   using AI = AdaptiveInteger;
+   constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+   constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+
+   /// Compares the value of an AdaptiveInteger with a BigInteger by their decimal digits.
+   bool same(AI a, BigInteger b)
+   {
+      if ( (a < 0) != (b < 0) )
+      {
+         return false;
+      }
+      a = abs(a);
+      b = abs(b);
+      const AI ten(int64_t{10});
+      const BigInteger big_ten(int64_t{10});
+      while ( a != 0 || b != 0 )
+      {
+         if ( int(a % ten) != int(b % big_ten) )
+         {
+            return false;
+         }
+         a /= ten;
+         b /= big_ten;
+      }
+      return true;
+   }
+
+   void test_constructors()
+   {
+      ASSERT(AI() == 0 && !AI().isPromoted(), "Default value is zero.");
+      ASSERT(AI(int16_t{-7}) == -7 && AI(int32_t{-7}) == -7 && AI(int64_t{-7}) == -7, "Bad signed constructors.");
+      ASSERT(AI(uint16_t{7}) == 7 && AI(uint32_t{7}) == 7 && AI(uint64_t{7}) == 7, "Bad unsigned constructors.");
+      ASSERT(!AI(I64_MAX).isPromoted() && !AI(I64_MIN + 1).isPromoted(), "Values of int64_t are not promoted.");
+      ASSERT(AI(I64_MIN).isPromoted(), "The smallest value of int64_t is promoted.");
+      ASSERT(AI(std::numeric_limits<uint64_t>::max()).isPromoted(), "Large unsigned values are promoted.");
+      ASSERT(same(AI(I64_MIN), BigInteger(I64_MIN)), "Bad value of smallest int64_t.");
+      ASSERT(same(AI(std::numeric_limits<uint64_t>::max()), BigInteger(std::numeric_limits<uint64_t>::max())), "Bad value of largest uint64_t.");
+   }
+
+   void test_promotion()
+   {
+      AI a(I64_MAX);
+      a += AI(int64_t{1});
+      ASSERT(a.isPromoted() && a > AI(I64_MAX), "Addition must promote on overflow.");
+      AI b(-I64_MAX);
+      b -= AI(int64_t{1});
+      ASSERT(b.isPromoted() && b < AI(-I64_MAX), "Subtraction must promote on overflow.");
+      ASSERT(same(b, BigInteger(I64_MIN)), "Bad promoted value.");
+      AI c(int64_t{1} << 40);
+      c *= c;
+      ASSERT(c.isPromoted(), "Multiplication must promote on overflow.");
+      auto expected = BigInteger(int64_t{1} << 40);
+      expected *= BigInteger(int64_t{1} << 40);
+      ASSERT(same(c, expected), "Bad promoted product.");
+      c *= c;
+      expected *= expected;
+      ASSERT(same(c, expected), "Bad product of promoted values.");
+   }
+
+   void test_demotion()
+   {
+      AI a(I64_MAX);
+      a += AI(int64_t{5});
+      a -= AI(int64_t{10});
+      ASSERT(!a.isPromoted() && a == AI(I64_MAX - 5), "Values have to be demoted when they fit again.");
+      AI b(int64_t{1} << 40);
+      b *= b;
+      b /= AI(int64_t{1} << 30);
+      ASSERT(!b.isPromoted() && b == AI(int64_t{1} << 50), "Quotients have to be demoted.");
+      AI c(int64_t{1} << 40);
+      c *= c;
+      c = -c;
+      ASSERT(c.isPromoted() && c < 0, "Negation keeps the promotion.");
+      c %= AI(int64_t{1000});
+      ASSERT(!c.isPromoted() && c < 0 && c > -1000, "The remainder has the sign of the dividend.");
+      AI d(int64_t{1} << 40);
+      d *= d;
+      d -= d;
+      ASSERT(!d.isPromoted() && d == 0, "Subtraction from itself gives zero.");
+   }
+
+   void test_arithmetics()
+   {
+      const std::vector<int64_t> values{0, 1, -1, 2, -3, 1000003, -999999937, int64_t{1} << 31, -(int64_t{1} << 33), int64_t{1} << 62,
+                                        I64_MAX, I64_MAX - 1, -I64_MAX, I64_MIN};
+      for ( const auto x : values )
+      {
+         for ( const auto y : values )
+         {
+            const AI a(x);
+            const AI b(y);
+            const BigInteger big_a(x);
+            const BigInteger big_b(y);
+            ASSERT(same(a + b, big_a + big_b), "Bad sum.");
+            ASSERT(same(a - b, big_a - big_b), "Bad difference.");
+            ASSERT(same(a * b, big_a * big_b), "Bad product.");
+            ASSERT(same(-a, -big_a), "Bad negation.");
+            ASSERT(same(abs(a), abs(big_a)), "Bad absolute value.");
+            if ( y != 0 )
+            {
+               ASSERT(same(a / b, big_a / big_b), "Bad quotient.");
+               ASSERT(same(a - (a / b) * b, big_a - (big_a / big_b) * big_b), "Bad remainder.");
+               ASSERT(a % b == a - (a / b) * b, "The remainder doesn't match the quotient.");
+               ASSERT(abs(a % b) < abs(b) && (a % b == 0 || (a % b < 0) == (a < 0)), "Bad sign of the remainder.");
+            }
+            const auto products = (a * b) * (a * b);
+            ASSERT(same(products, (big_a * big_b) * (big_a * big_b)), "Bad product of promoted values.");
+            if ( y != 0 )
+            {
+               ASSERT(products / (b * b) == a * a, "Bad quotient of promoted values.");
+            }
+         }
+      }
+   }
+
+   void test_comparisons()
+   {
+      AI big(I64_MAX);
+      big += big;
+      const auto negative = -big;
+      const AI small(int64_t{5});
+      ASSERT(big > small && small < big && big > 0 && big >= 7 && big != 0, "Promoted positive numbers are large.");
+      ASSERT(negative < small && small > negative && negative < 0 && negative <= -7 && negative != 0, "Promoted negative numbers are small.");
+      ASSERT(negative < big && big > negative && big == -negative && big != negative, "Bad comparison of promoted numbers.");
+      ASSERT(big <= big && big >= big && !(big < big), "Bad comparison with itself.");
+   }
+
+   void test_operator_int()
+   {
+      ASSERT(int(AI(int64_t{-12345})) == -12345, "Bad conversion to int.");
+      ASSERT_ANY_EXCEPTION(int(AI(I64_MAX)), "Out of range of int.");
+      AI big(I64_MAX);
+      big *= big;
+      ASSERT_ANY_EXCEPTION(int(big), "Out of range of int.");
+   }
+
+   void test_division_by_zero()
+   {
+      AI a(int64_t{5});
+      ASSERT_ANY_EXCEPTION(a / AI(), "Division by zero.");
+      ASSERT_ANY_EXCEPTION(a % AI(), "Modulo by zero.");
+      a *= AI(I64_MAX);
+      ASSERT_ANY_EXCEPTION(a / AI(), "Division by zero.");
+   }
+
+   void test_hash()
+   {
+      AI a(I64_MAX);
+      a += AI(int64_t{1});
+      a -= AI(int64_t{1});
+      ASSERT(hash(a) == hash(AI(I64_MAX)), "Equal values have equal hashes.");
+      AI b(I64_MAX);
+      b *= AI(int64_t{4});
+      AI c(I64_MAX);
+      c *= AI(int64_t{2});
+      c += c;
+      ASSERT(b == c && hash(b) == hash(c), "Equal promoted values have equal hashes.");
+   }
+}
+
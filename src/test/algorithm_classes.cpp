@@ -16,6 +16,9 @@ namespace
 {
    void facet_class();
    void representative();
+   void canonical_form();
+   void equivalence();
+   void cache();
 }
 
 int main()
@@ -23,6 +26,9 @@ try
 {
    facet_class();
    representative();
+   canonical_form();
+   equivalence();
+   cache();
 }
 catch ( const TestingGearException& e )
 {
@@ -51,5 +57,46 @@ namespace
       const auto rep = algorithm::classRepresentative(facet, {xy, x}, tag::facet{});
       ASSERT((rep == Facet<int>{1, 0, 0, -1}), "");
    }
+
+   void canonical_form()
+   {
+      const Deterministics<int> dets{{1, 0}, {0, 1}, {1, 1}};
+      ASSERT((algorithm::canonicalForm(Row<int>{1, 2, 1}, dets) == Row<int>{0, 1, 2}), "Values have to be shifted to zero.");
+      ASSERT((algorithm::canonicalForm(Row<int>{2, 4, 1}, dets) == Row<int>{0, 1, 2}), "Values have to be divided by their gcd.");
+      ASSERT((algorithm::canonicalForm(Row<int>{-3, 3, 1}, dets) == Row<int>{0, 2, 1}), "Negative values have to be shifted to zero.");
+      ASSERT(algorithm::canonicalForm(Row<int>{0, 0, 1}, dets).empty(), "Equal values have no canonical form.");
+   }
+
+   void equivalence()
+   {
+      const Deterministics<int> dets{{1, 0}, {0, 1}, {1, 1}};
+      const Maps swap{{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}}};
+      ASSERT(algorithm::checkEquivalenceMaps(Row<int>{1, 2, 1}, Row<int>{3, 6, 1}, dets, Maps{}, tag::vertex{}), "Scaled rows are equivalent.");
+      ASSERT(!algorithm::checkEquivalenceMaps(Row<int>{1, 2, 1}, Row<int>{2, 1, 1}, dets, Maps{}, tag::vertex{}), "Permuted rows need a map.");
+      ASSERT(algorithm::checkEquivalenceMaps(Row<int>{1, 2, 1}, Row<int>{2, 1, 1}, dets, swap, tag::vertex{}), "Rows mapped onto each other are equivalent.");
+      #ifndef ROUNDED_DETERMINISTICS
+      // rounding to three digits (the optional previous comparison) considers these rows equivalent.
+      ASSERT(!algorithm::checkEquivalenceMaps(Row<int>{1, 3001, 1}, Row<int>{1, 4001, 1}, dets, swap, tag::vertex{}), "Rows that only differ slightly aren't equivalent.");
+      #endif
+      ASSERT(!algorithm::checkEquivalenceMaps(Row<int>{0, 0, 1}, Row<int>{0, 0, 1}, dets, swap, tag::vertex{}), "Rows with equal values are never equivalent.");
+   }
+
+   void cache()
+   {
+      // x0 -> 1 - x0 isn't a permutation, hence, the classes are enumerated.
+      Map xy{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      Map x{{std::make_pair(0u, -1), std::make_pair(3u, 1)},{std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const Symmetries<int, tag::facet> symmetries(Maps{xy, x, xy});
+      ASSERT(symmetries.group == nullptr, "Affine maps don't generate a permutation group.");
+      const auto before = symmetries.cache.statistics();
+      ASSERT(before.lookups == 0, "Cache has to be unused.");
+      ASSERT((algorithm::classRepresentative(Facet<int>{1, 0, 0, -1}, symmetries, tag::facet{}) == Facet<int>{1, 0, 0, -1}), "");
+      ASSERT((algorithm::classRepresentative(Facet<int>{0, -1, 0, 0}, symmetries, tag::facet{}) == Facet<int>{1, 0, 0, -1}), "");
+      const auto classes = algorithm::classes(Matrix<int>{{-1, 0, 0, 0}, {0, 0, 1, 0}, {0, 1, 0, -1}}, symmetries, tag::facet{});
+      ASSERT((classes == Matrix<int>{{1, 0, 0, -1}, {0, 0, 1, 0}}), "");
+      const auto after = symmetries.cache.statistics();
+      ASSERT(after.size == 5, "All rows of an enumerated class have to be stored.");
+      ASSERT(after.lookups == 5 && after.hits == 3, "Rows of known classes have to be found.");
+   }
 }
 
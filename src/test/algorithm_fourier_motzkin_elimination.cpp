@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <random>
 
 using namespace panda;
@@ -18,6 +20,10 @@ namespace
 {
    void facetsConvexOnly();
    void vertices();
+   void multipleThreads();
+   void insertionOrders();
+   /// Distinct points on a paraboloid, they are in convex position. Seeded, such that the instance is the same in every run.
+   Vertices<int64_t> paraboloid(const std::size_t, const unsigned int);
 }
 
 int main()
@@ -25,6 +31,8 @@ try
 {
    facetsConvexOnly();
    vertices();
+   multipleThreads();
+   insertionOrders();
 }
 catch ( const TestingGearException& e )
 {
@@ -164,5 +172,51 @@ namespace
          ASSERT(vs == correct, "Data mismatch.");
       }
    }
-}
 
+   void multipleThreads()
+   {
+      // some hundred points give elimination steps with thousands of pairs, which are split among the threads.
+      const auto points = paraboloid(300, 5);
+      const auto sequential = algorithm::fourierMotzkinElimination(points, 1, InsertionOrder::MinIndex);
+      ASSERT(sequential.size() > 300, "Data mismatch.");
+      for ( const std::size_t threads : {2u, 3u, 8u} )
+      {
+         ASSERT(algorithm::fourierMotzkinElimination(points, threads, InsertionOrder::MinIndex) == sequential, "The result must not depend on the number of threads.");
+      }
+   }
+
+   void insertionOrders()
+   {
+      // the order of insertion changes the intermediate systems, but not the facets.
+      const auto points = paraboloid(200, 17);
+      auto expected = algorithm::fourierMotzkinElimination(points, 1, InsertionOrder::MinIndex);
+      std::sort(expected.begin(), expected.end());
+      for ( const auto order : {InsertionOrder::MinIndex, InsertionOrder::MaxIndex, InsertionOrder::LexMin, InsertionOrder::MinCutoff, InsertionOrder::Random} )
+      {
+         for ( const std::size_t threads : {1u, 4u} )
+         {
+            auto facets = algorithm::fourierMotzkinElimination(points, threads, order);
+            std::sort(facets.begin(), facets.end());
+            ASSERT(facets == expected, "The facets must not depend on the insertion order.");
+         }
+      }
+   }
+
+   Vertices<int64_t> paraboloid(const std::size_t count, const unsigned int seed)
+   {
+      std::mt19937 g(seed);
+      std::uniform_int_distribution<int64_t> coordinate(-20, 20);
+      Vertices<int64_t> points;
+      while ( points.size() < count )
+      {
+         const auto x = coordinate(g);
+         const auto y = coordinate(g);
+         const Vertex<int64_t> point{x, y, x * x + y * y, 1};
+         if ( std::find(points.cbegin(), points.cend(), point) == points.cend() )
+         {
+            points.push_back(point);
+         }
+      }
+      return points;
+   }
+}
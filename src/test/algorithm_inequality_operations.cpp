@@ -8,6 +8,9 @@
 
 #include "algorithm_inequality_operations.h"
 
+#include <cstdint>
+#include <limits>
+
 using namespace panda;
 
 namespace
@@ -16,6 +19,8 @@ namespace
    void distances();
    void furthest_vertex();
    void nearest_vertex();
+   template <typename Integer>
+   void dense_vertices();
 }
 
 int main()
@@ -25,6 +30,8 @@ try
    distances();
    furthest_vertex();
    nearest_vertex();
+   dense_vertices<int32_t>();
+   dense_vertices<int64_t>();
 }
 catch ( const TestingGearException& e )
 {
@@ -57,5 +64,24 @@ namespace
       ASSERT((algorithm::nearestVertex(vs, Inequality<int>{1, 0, -1}) == Vertex<int>{1, 0, 1}) ||
              (algorithm::nearestVertex(vs, Inequality<int>{1, 0, -1}) == Vertex<int>{1, 1, 1}), "");
    }
+   template <typename Integer>
+   void dense_vertices()
+   {
+      const Vertices<Integer> vs{{0, 0, 1}, {0, 1, 1}, {1, 0, 1}, {1, 1, 1}, {2, 1, 1}};
+      const DenseMatrix<Integer> dense(vs);
+      for ( const auto& inequality : Matrix<Integer>{{1, 0, -1}, {0, 1, -1}, {-1, 1, 0}, {1, 1, -2}} )
+      {
+         ASSERT(algorithm::furthestVertex(dense, inequality) == algorithm::furthestVertex(vs, inequality), "Dense and generic vertices must agree.");
+         ASSERT(algorithm::nearestVertex(dense, inequality) == algorithm::nearestVertex(vs, inequality), "Dense and generic vertices must agree.");
+      }
+      ASSERT((algorithm::incidence(dense, Inequality<Integer>{1, 0, -1}) == std::vector<std::size_t>{2, 3}), "Bad incidence.");
+      ASSERT(algorithm::incidence(dense, Inequality<Integer>{0, 0, 1}).empty(), "Bad incidence.");
+      // for int64_t, these entries are beyond the 32 bit multiplications of the vectorized kernels.
+      const Integer big = std::numeric_limits<Integer>::max() / 2;
+      const Vertices<Integer> large{{big, 1}, {1, big}, {big, big}};
+      const DenseMatrix<Integer> dense_large(large);
+      ASSERT((algorithm::furthestVertex(dense_large, Inequality<Integer>{1, 1}) == Vertex<Integer>{big, 1}), "Bad fallback.");
+      ASSERT((algorithm::incidence(dense_large, Inequality<Integer>{1, -1}) == std::vector<std::size_t>{2}), "Bad fallback.");
+   }
 }
 
@@ -20,6 +20,28 @@ try
    Equations<int> equations{{1, 1, 1, -3}};
    const auto nmaps = algorithm::normalize(maps, equations);
    ASSERT((nmaps[0] == Map{{}, {std::make_pair(1u, 1), std::make_pair(2u, 1), std::make_pair(3u, -2)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}}), "Data mismatch.");
+   // x0 <-> x1 fixes x0 + x1 <= 1, but not x0 <= 1.
+   const Map swap{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}};
+   const Map identity{{std::make_pair(0u, 1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}};
+   ASSERT((algorithm::stabilizer(Maps{swap, identity}, Row<int>{2, 2, -2}, tag::facet{}) == Maps{swap, identity}), "Both maps fix the row.");
+   ASSERT((algorithm::stabilizer(Maps{swap, identity}, Row<int>{1, 0, -1}, tag::facet{}) == Maps{identity}), "Only the identity fixes the row.");
+   // compiled maps: x0 <-> x1 is a permutation, x0 -> -x1, x1 -> x0 a signed permutation, x1 -> 1 - x0 is general.
+   const Map rotation{{std::make_pair(1u, -1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}};
+   ASSERT(algorithm::compile(swap, tag::vertex{}).kind == MapKind::Permutation, "Map is a permutation.");
+   ASSERT(algorithm::compile(rotation, tag::facet{}).kind == MapKind::SignedPermutation, "Map is a signed permutation.");
+   ASSERT(algorithm::compile(map, tag::facet{}).kind == MapKind::General, "Map is affine.");
+   ASSERT(algorithm::compile(nmaps[0], tag::facet{}).kind == MapKind::General, "Map has an empty image.");
+   for ( const auto& row : Matrix<int>{{1, 0, -1}, {2, -3, 1}, {0, 5, 7}} )
+   {
+      for ( const auto& m : Maps{swap, rotation, identity} )
+      {
+         ASSERT(algorithm::apply(algorithm::compile(m, tag::facet{}), row, tag::facet{}) == algorithm::apply(m, row, tag::facet{}), "Compiled map has to give the same facet.");
+         ASSERT(algorithm::apply(algorithm::compile(m, tag::vertex{}), row, tag::vertex{}) == algorithm::apply(m, row, tag::vertex{}), "Compiled map has to give the same vertex.");
+      }
+   }
+   const Row<int> vertex{1, 2, 0, 1};
+   ASSERT(algorithm::apply(algorithm::compile(map, tag::vertex{}), vertex, tag::vertex{}) == algorithm::apply(map, vertex, tag::vertex{}), "General maps are applied as they are.");
+   ASSERT((algorithm::apply(algorithm::compile(rotation, tag::vertex{}), Row<int>{2, 4, 6}, tag::vertex{}) == Row<int>{-4, 2, 6}), "Permutations keep a common divisor.");
 }
 catch ( const TestingGearException& e )
 {
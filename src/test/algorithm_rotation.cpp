@@ -0,0 +1,166 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "algorithm_inequality_operations.h"
+#include "algorithm_rotation.h"
+#include "dense_matrix.h"
+#include "helper_pool.h"
+#include "symmetries.h"
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void ridgesByElimination();
+   void ridgesByDecomposition();
+   void ridgesBySymmetricDecomposition();
+   void ridgesByStabilizerChain();
+   void rotationWithRecursion();
+   /// Returns the sets of vertices on the given ridges and checks that the ridges are valid for all vertices.
+   std::set<std::set<std::size_t>> incidences(const Vertices<int>&, const Inequalities<int>&);
+   /// Cube [0,1]^3.
+   const Vertices<int> cube{{0, 0, 0, 1}, {0, 0, 1, 1}, {0, 1, 0, 1}, {0, 1, 1, 1}, {1, 0, 0, 1}, {1, 0, 1, 1}, {1, 1, 0, 1}, {1, 1, 1, 1}};
+   /// Facet x0 >= 0 of the cube, containing the first four vertices.
+   const Facet<int> facet{-1, 0, 0, 0};
+   /// Edges of the facet.
+   const std::set<std::set<std::size_t>> edges{{0, 1}, {0, 2}, {1, 3}, {2, 3}};
+}
+
+int main()
+try
+{
+   ridgesByElimination();
+   ridgesByDecomposition();
+   ridgesBySymmetricDecomposition();
+   ridgesByStabilizerChain();
+   rotationWithRecursion();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void ridgesByElimination()
+   {
+      const auto ridges = algorithm::ridges(cube, facet, Maps{}, Recursion{100, 1}, tag::facet{});
+      ASSERT(incidences(cube, ridges) == edges, "Facets with few vertices are handled by elimination.");
+      const auto no_recursion = algorithm::ridges(cube, facet, Maps{}, Recursion{0, 0}, tag::facet{});
+      ASSERT(incidences(cube, no_recursion) == edges, "Depth zero means no recursion.");
+   }
+
+   void ridgesByDecomposition()
+   {
+      for ( std::size_t depth = 1; depth <= 3; ++depth )
+      {
+         const auto ridges = algorithm::ridges(cube, facet, Maps{}, Recursion{0, depth}, tag::facet{});
+         ASSERT(ridges.size() == 4, "Without maps, every ridge is returned exactly once.");
+         ASSERT(incidences(cube, ridges) == edges, "Decomposition has to find all ridges.");
+      }
+   }
+
+   void ridgesBySymmetricDecomposition()
+   {
+      // x0 <-> 1 - x0 doesn't fix the facet and must not be used.
+      const Map mirror_0{{std::make_pair(3u, 1), std::make_pair(0u, -1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const Map mirror_1{{std::make_pair(0u, 1)}, {std::make_pair(3u, 1), std::make_pair(1u, -1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const Map swap_12{{std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(1u, 1)}, {std::make_pair(3u, 1)}};
+      {
+         const auto ridges = algorithm::ridges(cube, facet, Maps{mirror_0, mirror_1, swap_12}, Recursion{0, 1}, tag::facet{});
+         ASSERT(ridges.size() == 1, "All ridges are equivalent under the maps that fix the facet.");
+         ASSERT(edges.count(*incidences(cube, ridges).begin()) == 1, "Data returned is invalid.");
+      }
+      {
+         const auto ridges = algorithm::ridges(cube, facet, Maps{mirror_0, mirror_1}, Recursion{0, 2}, tag::facet{});
+         const auto found = incidences(cube, ridges);
+         ASSERT(ridges.size() == 3 && found.size() == 3, "Ridges {0, 1} and {2, 3} are equivalent under the mirror.");
+         ASSERT(found.count({0, 2}) == 1 && found.count({1, 3}) == 1, "Decomposition has to find all classes of ridges.");
+         ASSERT(found.count({0, 1}) + found.count({2, 3}) == 1, "Decomposition has to find all classes of ridges.");
+      }
+   }
+
+   void ridgesByStabilizerChain()
+   {
+      // cube [-1,1]^3 with cyclic shifts and sign changes, the facet x0 <= 1 is fixed by the sign changes of x1 and x2,
+      // but by none of the maps. Hence, x1 <= 1 and x1 >= -1 (as well as x2 <= 1 and x2 >= -1) are equivalent ridges.
+      const Vertices<int> centered{{-1, -1, -1, 1}, {-1, -1, 1, 1}, {-1, 1, -1, 1}, {-1, 1, 1, 1}, {1, -1, -1, 1}, {1, -1, 1, 1}, {1, 1, -1, 1}, {1, 1, 1, 1}};
+      const Facet<int> right{1, 0, 0, -1};
+      const Map shift{{std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(3u, 1)}};
+      const Map sign_0{{std::make_pair(0u, -1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const auto ridges = algorithm::ridges(centered, right, Maps{shift, sign_0}, Recursion{0, 1}, tag::facet{});
+      ASSERT(ridges.size() == 2, "The ridges have to be classified by the whole stabiliser of the facet.");
+      std::set<std::size_t> coordinates;
+      for ( const auto& ridge : ridges )
+      {
+         ASSERT(ridge[0] == 0 && (ridge[1] == 0) != (ridge[2] == 0), "Data returned is invalid.");
+         coordinates.insert(ridge[1] == 0 ? 2 : 1);
+      }
+      ASSERT(coordinates.size() == 2, "Ridges of x1 and x2 aren't equivalent.");
+   }
+
+   void rotationWithRecursion()
+   {
+      // the facets adjacent to x0 >= 0: x1 >= 0, x1 <= 1, x2 >= 0 and x2 <= 1.
+      const std::set<std::set<std::size_t>> neighbours{{0, 1, 4, 5}, {2, 3, 6, 7}, {0, 2, 4, 6}, {1, 3, 5, 7}};
+      const DenseMatrix<int> dense(cube);
+      const Symmetries<int, tag::facet> symmetries(Maps{});
+      const HelperPool helpers(3);
+      for ( std::size_t depth = 0; depth <= 2; ++depth )
+      for ( std::size_t parallelism = 1; parallelism <= 4; parallelism += 3 )
+      {
+         const auto adjacent = algorithm::rotation(dense, facet, symmetries, helpers, parallelism, Recursion{0, depth}, tag::facet{});
+         std::set<std::set<std::size_t>> found;
+         for ( const auto& row : adjacent )
+         {
+            std::set<std::size_t> on_facet;
+            for ( std::size_t i = 0; i < cube.size(); ++i )
+            {
+               const auto d = algorithm::distance(row, cube[i]);
+               ASSERT(d >= 0, "Adjacent facets have to be valid for all vertices.");
+               if ( d == 0 )
+               {
+                  on_facet.insert(i);
+               }
+            }
+            found.insert(on_facet);
+         }
+         ASSERT(adjacent.size() == 4 && found == neighbours, "Rotation has to find all adjacent facets, with or without recursion and helpers.");
+      }
+   }
+
+   std::set<std::set<std::size_t>> incidences(const Vertices<int>& vertices, const Inequalities<int>& ridges)
+   {
+      std::set<std::set<std::size_t>> result;
+      for ( const auto& ridge : ridges )
+      {
+         std::set<std::size_t> on_ridge;
+         for ( std::size_t i = 0; i < vertices.size(); ++i )
+         {
+            if ( algorithm::distance(facet, vertices[i]) != 0 )
+            {
+               continue;
+            }
+            const auto d = algorithm::distance(ridge, vertices[i]);
+            ASSERT(d >= 0, "Ridges have to be valid for all vertices of the facet.");
+            if ( d == 0 )
+            {
+               on_ridge.insert(i);
+            }
+         }
+         result.insert(on_ridge);
+      }
+      return result;
+   }
+}
+
@@ -8,6 +8,9 @@
 
 #include "big_integer.h"
 
+#include <limits>
+#include <random>
+
 using namespace panda;
 
 namespace
@@ -22,6 +25,10 @@ namespace
    void test_operator_add();
    void test_operator_subtract();
    void test_operator_modulo();
+   void test_large_multiply();
+   void test_large_divide();
+   void test_large_signs();
+   void test_int64_boundaries();
 }
 
 int main()
@@ -37,6 +44,10 @@ try
    test_operator_add();
    test_operator_subtract();
    test_operator_modulo();
+   test_large_multiply();
+   test_large_divide();
+   test_large_signs();
+   test_int64_boundaries();
 }
 catch ( const TestingGearException& e )
 {
@@ -143,5 +154,99 @@ namespace
       ASSERT(((BI(0) % BI(7)) == BI(0)), "operator%(BigInteger)");
       ASSERT_ANY_EXCEPTION(((BI(9) % BI(0)) == BI(0)), "operator%(BigInteger)");
    }
-}
 
+   BI power(const BI& base, const int exponent)
+   {
+      BI result(1);
+      for ( int i = 0; i < exponent; ++i )
+      {
+         result *= base;
+      }
+      return result;
+   }
+
+   /// Random number with the given number of 31 bit chunks.
+   BI random(std::mt19937& generator, const int chunks)
+   {
+      BI result(0);
+      for ( int i = 0; i < chunks; ++i )
+      {
+         result = result * BI(int32_t{1} << 30) * BI(2) + BI(static_cast<int32_t>(generator() & 0x7FFFFFFF));
+      }
+      return result;
+   }
+
+   void test_large_multiply()
+   {
+      const BI max(std::numeric_limits<uint64_t>::max());
+      ASSERT(max * max == power(BI(2), 128) - power(BI(2), 65) + BI(1), "operator*(BigInteger)");
+      ASSERT(max * -max == -(max * max) && -max * -max == max * max, "operator*(BigInteger)");
+      std::mt19937 generator(11);
+      // large products (Karatsuba) are compared to sums of products with single chunks (schoolbook).
+      for ( const int size : {2, 30, 45, 90, 130} )
+      {
+         const auto a = random(generator, size);
+         const auto b = random(generator, size / 2 + 1);
+         auto b_rest = b;
+         auto scale = BI(1);
+         auto sum = BI(0);
+         const auto base = BI(int32_t{1} << 30) * BI(2);
+         while ( b_rest != 0 )
+         {
+            sum += a * (b_rest % base) * scale;
+            b_rest /= base;
+            scale *= base;
+         }
+         ASSERT(a * b == sum, "operator*(BigInteger)");
+         ASSERT(a * a == (a - b) * (a + b) + b * b, "operator*(BigInteger)");
+      }
+   }
+
+   void test_large_divide()
+   {
+      std::mt19937 generator(13);
+      for ( const int a_size : {1, 3, 8, 50, 120} )
+      {
+         for ( const int b_size : {1, 2, 3, 7, 49, 60} )
+         {
+            const auto a = random(generator, a_size);
+            const auto b = random(generator, b_size) + BI(1);
+            const auto q = a / b;
+            const auto r = a % b;
+            ASSERT(q * b + r == a && r >= 0 && r < b, "operator/(BigInteger)");
+            ASSERT((a * b) / b == a && (a * b) % b == 0, "operator/(BigInteger)");
+         }
+      }
+      // divisors whose leading digit needs normalization, and quotient estimates that are too large
+      const auto top = power(BI(2), 96);
+      ASSERT((top * top - BI(1)) / (top - BI(1)) == top + BI(1), "operator/(BigInteger)");
+      ASSERT((top * top) % (top - BI(1)) == BI(1), "operator%(BigInteger)");
+      ASSERT((top * top) / (top + BI(3)) == top - BI(3), "operator/(BigInteger)");
+   }
+
+   void test_large_signs()
+   {
+      const auto a = power(BI(2), 100);
+      const auto half = power(BI(2), 99);
+      ASSERT(-a / BI(2) == -half && -a / BI(-2) == half && a / BI(-2) == -half, "operator/(BigInteger)");
+      ASSERT((-a - BI(1)) / BI(2) == -half, "operator/(BigInteger)");
+      ASSERT((-a - BI(1)) % BI(2) == BI(1) && -a % BI(2) == BI(0), "operator%(BigInteger)");
+      ASSERT(-a % (half + BI(1)) == BI(2), "operator%(BigInteger)");
+      ASSERT(BI(-6) % BI(3) == BI(0), "operator%(BigInteger)");
+   }
+
+   void test_int64_boundaries()
+   {
+      const BI max(std::numeric_limits<int64_t>::max());
+      const BI min(std::numeric_limits<int64_t>::min());
+      ASSERT(max + BI(1) > max && (max + BI(1)) - BI(1) == max, "operator+(BigInteger)");
+      ASSERT(min == -max - BI(1) && min - BI(1) < min, "operator-(BigInteger)");
+      ASSERT(min * BI(-1) == max + BI(1) && min / BI(-1) == max + BI(1), "operator*(BigInteger)");
+      ASSERT(max * BI(2) / BI(2) == max && (max * BI(2)) % max == BI(0), "operator/(BigInteger)");
+      ASSERT(min % BI(3) == BI(1) && min / BI(2) == BI(std::numeric_limits<int64_t>::min() / 2), "operator%(BigInteger)");
+      const BI root(int64_t{3037000500}); // root^2 > max > (root - 1)^2
+      ASSERT(root * root == root * (root - BI(1)) + root && root * root > max, "operator*(BigInteger)");
+      ASSERT((root - BI(1)) * (root - BI(1)) < max, "operator*(BigInteger)");
+      ASSERT(BI(int64_t{1} << 40) * BI(int64_t{1} << 20) == BI(int64_t{1} << 60), "operator*(BigInteger)");
+   }
+}
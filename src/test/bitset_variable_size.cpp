@@ -85,6 +85,8 @@ namespace
       {
          a.set(i);
          ASSERT(a.count(10) == i + 1, "Count mismatch");
+         ASSERT(a.test(i), "Bit has to be set");
+         ASSERT(i + 1 == 10 || !a.test(i + 1), "Bit must not be set");
       }
    }
 }
@@ -0,0 +1,135 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "bitset_variable_size.h"
+#include "bitset_wide.h"
+
+#include <random>
+
+using namespace panda;
+
+namespace
+{
+   void construction();
+   void equality();
+   void merge();
+   void intersect();
+   void count();
+   void kernels();
+}
+
+int main()
+try
+{
+   construction();
+   equality();
+   merge();
+   intersect();
+   count();
+   kernels();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void construction()
+   {
+      ASSERT_NOTHROW(BitsetWide(10), "Reasonably small bitset");
+      ASSERT_NOTHROW(BitsetWide(1000), "Reasonably small bitset");
+      ASSERT_NOTHROW(BitsetWide(100000), "Reasonably small bitset");
+   }
+   void equality()
+   {
+      ASSERT(BitsetWide(10).equals(BitsetWide(10), 10), "Just constructed should be equal");
+      BitsetWide a(10);
+      BitsetWide b(10);
+      a.set(7);
+      a.set(9);
+      b.set(7);
+      b.set(9);
+      ASSERT(a.equals(b, 10), "Same bits set should be equal");
+   }
+   void merge()
+   {
+      BitsetWide a(10);
+      BitsetWide b(10);
+      BitsetWide c(10);
+      a.set(7);
+      b.set(9);
+      c.set(7);
+      c.set(9);
+      ASSERT(c.equals(a.merge(b, 10), 10), "Merge of {7} and {9} should be {7, 9}");
+   }
+   void intersect()
+   {
+      BitsetWide a(10);
+      BitsetWide b(10);
+      BitsetWide c(10);
+      a.set(7);
+      a.set(8);
+      a.set(9);
+      b.set(7);
+      b.set(8);
+      c.set(1);
+      ASSERT(a.contains(b, 10), "{7, 8} is contained in {7, 8, 9}");
+      ASSERT(!a.contains(c, 10), "{1} is not contained in {7, 8, 9}");
+   }
+   void count()
+   {
+      BitsetWide a(10);
+      for ( std::size_t i = 0; i < 10; ++i )
+      {
+         a.set(i);
+         ASSERT(a.count(10) == i + 1, "Count mismatch");
+         ASSERT(a.test(i), "Bit has to be set");
+         ASSERT(i + 1 == 10 || !a.test(i + 1), "Bit must not be set");
+      }
+   }
+   void kernels()
+   {
+      // the vectorized kernels have to agree with BitsetVariableSize for sizes that are and aren't multiples of the vector width.
+      std::mt19937 generator(42);
+      for ( const std::size_t bits : {1u, 63u, 64u, 65u, 255u, 256u, 300u, 511u, 512u, 513u, 1000u, 2048u} )
+      {
+         for ( int trial = 0; trial < 100; ++trial )
+         {
+            BitsetWide a(bits), b(bits), inner(bits);
+            BitsetVariableSize a_reference(bits), b_reference(bits), inner_reference(bits);
+            std::bernoulli_distribution dense(0.3);
+            std::bernoulli_distribution sparse(0.01);
+            for ( std::size_t i = 0; i < bits; ++i )
+            {
+               if ( dense(generator) )
+               {
+                  a.set(i);
+                  a_reference.set(i);
+               }
+               if ( dense(generator) )
+               {
+                  b.set(i);
+                  b_reference.set(i);
+               }
+               if ( sparse(generator) )
+               {
+                  inner.set(i);
+                  inner_reference.set(i);
+               }
+            }
+            ASSERT(BitsetWide::unionCount(a, b, bits) == BitsetVariableSize::unionCount(a_reference, b_reference, bits), "Union count mismatch");
+            ASSERT(BitsetWide::unionContains(a, b, inner, bits) == BitsetVariableSize::unionContains(a_reference, b_reference, inner_reference, bits), "Union containment mismatch");
+            ASSERT(a.contains(inner, bits) == a_reference.contains(inner_reference, bits), "Containment mismatch");
+            ASSERT(a.merge(b, bits).contains(inner, bits) == BitsetWide::unionContains(a, b, inner, bits), "Merge mismatch");
+            ASSERT(a.merge(b, bits).count(bits) == BitsetWide::unionCount(a, b, bits), "Count mismatch");
+         }
+      }
+   }
+}
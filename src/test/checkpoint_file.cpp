@@ -0,0 +1,172 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "big_integer.h"
+#include "checkpoint.h"
+#include "checkpoint_file.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void roundTrip();
+   void wideNumbers();
+   void longNumbers();
+   void emptyState();
+   void invalidFile();
+   void optionDefaults();
+   void optionInvalid();
+   void optionValid();
+   const std::string filename = "checkpoint_file_test.chk";
+}
+
+int main()
+try
+{
+   roundTrip();
+   wideNumbers();
+   longNumbers();
+   emptyState();
+   invalidFile();
+   optionDefaults();
+   optionInvalid();
+   optionValid();
+   std::remove(filename.c_str());
+}
+catch ( const TestingGearException& e )
+{
+   std::remove(filename.c_str());
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void roundTrip()
+   {
+      const Matrix<int> rows{{1, -2, 3}, {0, 0, 1}, {-7, 5, 2}};
+      checkpoint::write<int>(filename, {&rows[0], &rows[1], &rows[2]}, {&rows[2], &rows[0]});
+      const auto state = checkpoint::read<int>(filename);
+      ASSERT(state.first == rows, "Classes have to be restored in order.");
+      ASSERT((state.second == Matrix<int>{rows[2], rows[0]}), "Jobs have to be restored in order.");
+      std::ifstream temporary((filename + ".tmp").c_str());
+      ASSERT(!temporary, "The temporary file has to be replaced.");
+   }
+
+   void wideNumbers()
+   {
+      const auto max = std::numeric_limits<int64_t>::max();
+      const auto min = std::numeric_limits<int64_t>::min();
+      const Matrix<int64_t> rows{{max, min, 0}, {-1, 10, -100000000000}};
+      checkpoint::write<int64_t>(filename, {&rows[0], &rows[1]}, {&rows[0]});
+      ASSERT(checkpoint::read<int64_t>(filename).first == rows, "Numbers beyond int have to be restored.");
+      const BigInteger big = BigInteger(max) * BigInteger(max) * BigInteger(max);
+      const Matrix<BigInteger> big_rows{{big, -big, BigInteger(int32_t(0))}};
+      checkpoint::write<BigInteger>(filename, {&big_rows[0]}, {&big_rows[0]});
+      const auto state = checkpoint::read<BigInteger>(filename);
+      ASSERT(state.first == big_rows && state.second == big_rows, "Numbers of arbitrary size have to be restored.");
+   }
+
+   void longNumbers()
+   {
+      // 10^1500 has more decimal digits than any fixed width integer.
+      BigInteger huge(int32_t(1));
+      for ( int i = 0; i < 1500; ++i )
+      {
+         huge *= BigInteger(int32_t(10));
+      }
+      const Matrix<BigInteger> rows{{huge, BigInteger(int32_t(1))}, {BigInteger(int32_t(2)), -huge}};
+      checkpoint::write<BigInteger>(filename, {&rows[0], &rows[1]}, {&rows[1]});
+      const auto state = checkpoint::read<BigInteger>(filename);
+      ASSERT(state.first == rows, "Numbers with more than 1024 digits have to be restored.");
+      ASSERT((state.second == Matrix<BigInteger>{rows[1]}), "Jobs with more than 1024 digits have to be restored.");
+   }
+
+   void emptyState()
+   {
+      checkpoint::write<int>(filename, {}, {});
+      const auto state = checkpoint::read<int>(filename);
+      ASSERT(state.first.empty() && state.second.empty(), "Empty state has to be restored.");
+   }
+
+   void invalidFile()
+   {
+      ASSERT_EXCEPTION(checkpoint::read<int>("nonexistent_checkpoint_file"), std::invalid_argument, "File doesn't exist");
+      {
+         std::ofstream file(filename.c_str());
+         file << "Names:\nx1 x2\n";
+      }
+      ASSERT_EXCEPTION(checkpoint::read<int>(filename), std::invalid_argument, "File isn't a checkpoint");
+      const Matrix<int> rows{{1, 2}, {3, 4}};
+      checkpoint::write<int>(filename, {&rows[0], &rows[1]}, {&rows[1]});
+      std::string content;
+      {
+         std::ifstream file(filename.c_str(), std::ios::binary);
+         content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+      }
+      {
+         std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+         file << content.substr(0, content.size() - 3);
+      }
+      ASSERT_EXCEPTION(checkpoint::read<int>(filename), std::invalid_argument, "File is truncated");
+   }
+
+   void optionDefaults()
+   {
+      char** argv = new char*[1];
+      argv[0] = nullptr;
+      ASSERT(checkpoint::filename(1, argv).empty(), "No checkpoints by default");
+      ASSERT(checkpoint::resumeFilename(1, argv).empty(), "No resume by default");
+      ASSERT(checkpoint::interval(1, argv).count() > 0, "Default interval must be positive");
+      delete [] argv;
+   }
+
+   void optionInvalid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[40];
+      strcpy(argv[1], "--checkpoint=");
+      ASSERT_EXCEPTION(checkpoint::filename(2, argv), std::invalid_argument, "Missing file name");
+      strcpy(argv[1], "--resume=");
+      ASSERT_EXCEPTION(checkpoint::resumeFilename(2, argv), std::invalid_argument, "Missing file name");
+      strcpy(argv[1], "--checkpoint-interval=0");
+      ASSERT_EXCEPTION(checkpoint::interval(2, argv), std::invalid_argument, "Parameter is zero");
+      strcpy(argv[1], "--checkpoint-interval=1h");
+      ASSERT_EXCEPTION(checkpoint::interval(2, argv), std::invalid_argument, "Parameter is not a number");
+      delete [] argv[1];
+      delete [] argv;
+   }
+
+   void optionValid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[40];
+      strcpy(argv[1], "--checkpoint=run.chk");
+      ASSERT(checkpoint::filename(2, argv) == "run.chk", "Parameter is run.chk");
+      ASSERT(checkpoint::resumeFilename(2, argv).empty(), "--checkpoint is not --resume");
+      strcpy(argv[1], "--resume=run.chk");
+      ASSERT(checkpoint::resumeFilename(2, argv) == "run.chk", "Parameter is run.chk");
+      strcpy(argv[1], "--checkpoint-interval=60");
+      ASSERT(checkpoint::interval(2, argv) == std::chrono::seconds(60), "Parameter is 60");
+      delete [] argv[1];
+      delete [] argv;
+   }
+}
+
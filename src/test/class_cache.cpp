@@ -0,0 +1,99 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "class_cache.h"
+
+#include <atomic>
+#include <list>
+#include <set>
+#include <thread>
+
+using namespace panda;
+
+namespace
+{
+   void lookup();
+   void capacity();
+   void multipleThreads();
+}
+
+int main()
+try
+{
+   lookup();
+   capacity();
+   multipleThreads();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void lookup()
+   {
+      const ClassCache<int> cache(1000);
+      ASSERT(cache.find(Row<int>{0, 1}) == nullptr, "Empty cache doesn't know any row.");
+      cache.insert({{0, 1}, {1, 0}}, Row<int>{1, 0});
+      const auto first = cache.find(Row<int>{0, 1});
+      const auto second = cache.find(Row<int>{1, 0});
+      ASSERT(first != nullptr && (*first == Row<int>{1, 0}), "All rows of the class have to be found.");
+      ASSERT(second != nullptr && (*second == Row<int>{1, 0}), "All rows of the class have to be found.");
+      ASSERT(cache.find(Row<int>{1, 1}) == nullptr, "Rows of other classes aren't known.");
+      const auto statistics = cache.statistics();
+      ASSERT(statistics.size == 2, "Every row has to be stored once.");
+      ASSERT(statistics.lookups == 4, "Every lookup has to be counted.");
+      ASSERT(statistics.hits == 2, "Every hit has to be counted.");
+   }
+
+   void capacity()
+   {
+      const ClassCache<int> cache(100);
+      std::set<Row<int>> rows;
+      for ( int i = 0; i < 10000; ++i )
+      {
+         rows.insert(Row<int>{i, 1});
+      }
+      cache.insert(rows, Row<int>{0, 1});
+      ASSERT(cache.statistics().size <= 100, "The cache must not exceed its capacity.");
+      ASSERT(cache.statistics().size > 0, "The cache has to keep recent rows.");
+   }
+
+   void multipleThreads()
+   {
+      const ClassCache<int> cache(100000);
+      std::atomic<int> missed(0);
+      std::list<std::thread> threads;
+      for ( int t = 0; t < 8; ++t )
+      {
+         threads.emplace_back([&, t]()
+         {
+            for ( int i = 0; i < 1000; ++i )
+            {
+               cache.insert({{t, i}}, Row<int>{i, t});
+               const auto found = cache.find(Row<int>{t, i});
+               if ( found == nullptr || *found != Row<int>{i, t} )
+               {
+                  ++missed;
+               }
+            }
+         });
+      }
+      for ( auto& thread : threads )
+      {
+         thread.join();
+      }
+      ASSERT(missed == 0, "Row of the same thread has to be found.");
+      const auto statistics = cache.statistics();
+      ASSERT(statistics.size == 8000, "Every row has to be stored once.");
+      ASSERT(statistics.hits == 8000, "Every lookup has to be a hit.");
+   }
+}
+
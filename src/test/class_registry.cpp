@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "class_registry.h"
+
+#include <atomic>
+#include <list>
+#include <thread>
+
+#include "algorithm_row_operations.h"
+#include "big_integer.h"
+
+using namespace panda;
+
+int main()
+try
+{
+   for ( const auto type : {ClassRegistryType::Ordered, ClassRegistryType::Hashed} )
+   {
+      {  // A row is only stored once
+         ClassRegistry<int> registry(type);
+         ASSERT(registry.size() == 0, "A new registry has to be empty.");
+         const auto first = registry.insert(Row<int>{1, 2, 3});
+         ASSERT(first != nullptr, "A new row has to be stored.");
+         ASSERT(*first == (Row<int>{1, 2, 3}), "The stored row has to equal the inserted row.");
+         ASSERT(registry.insert(Row<int>{1, 2, 3}) == nullptr, "A known row mustn't be stored twice.");
+         ASSERT(registry.insert(Row<int>{3, 2, 1}) != nullptr, "A new row has to be stored.");
+         ASSERT(registry.size() == 2, "Wrong number of rows.");
+         ASSERT(registry.contains(Row<int>{3, 2, 1}), "A stored row has to be found.");
+         ASSERT(!registry.contains(Row<int>{2, 2, 2}), "A row that wasn't stored mustn't be found.");
+         ASSERT(*first == (Row<int>{1, 2, 3}), "Stored rows have to stay valid.");
+         ASSERT(registry.sorted() == (Matrix<int>{{1, 2, 3}, {3, 2, 1}}), "Rows have to be in lexicographical order.");
+      }
+      {  // Inserting with a precomputed hash value is equivalent
+         ClassRegistry<BigInteger> registry(type);
+         const Row<BigInteger> row{BigInteger(1), BigInteger(-4)};
+         ASSERT(registry.insert(row, algorithm::hash(row)) != nullptr, "A new row has to be stored.");
+         ASSERT(registry.insert(row) == nullptr, "A known row mustn't be stored twice.");
+      }
+      {  // A batch stores every new row once and keeps the order of the batch
+         ClassRegistry<int> registry(type);
+         registry.insert(Row<int>{5});
+         const auto stored = registry.insert(Matrix<int>{{7}, {5}, {1}, {7}, {3}});
+         ASSERT(stored.size() == 3, "Only new rows have to be stored.");
+         ASSERT(*stored[0] == Row<int>{7} && *stored[1] == Row<int>{1} && *stored[2] == Row<int>{3}, "The order of the batch has to be kept.");
+         ASSERT(registry.size() == 4, "Wrong number of rows.");
+         ASSERT(registry.insert(Matrix<int>{{1}, {3}}).empty(), "Known rows mustn't be stored twice.");
+      }
+      {  // Concurrent insertion stores every row exactly once
+         ClassRegistry<int> registry(type);
+         std::atomic<int> stored(0);
+         std::list<std::thread> threads;
+         for ( int t = 0; t < 4; ++t )
+         {
+            threads.emplace_back([&]()
+            {
+               for ( int i = 0; i < 200; ++i )
+               {
+                  if ( registry.insert(Row<int>{i % 50, i / 50}) != nullptr )
+                  {
+                     ++stored;
+                  }
+               }
+            });
+         }
+         for ( auto& thread : threads )
+         {
+            thread.join();
+         }
+         ASSERT(stored.load() == 200, "Every row has to be stored exactly once.");
+         ASSERT(registry.size() == 200, "Wrong number of rows.");
+      }
+   }
+   {  // Equal rows have equal hash values
+      ASSERT(algorithm::hash(Row<int>{1, 2}) == algorithm::hash(Row<int>{1, 2}), "Hash values of equal rows differ.");
+      const Row<BigInteger> a{BigInteger(7), BigInteger(0)};
+      const Row<BigInteger> b{BigInteger(14) / BigInteger(2), BigInteger(3) - BigInteger(3)};
+      ASSERT(algorithm::hash(a) == algorithm::hash(b), "Hash values of equal rows differ.");
+   }
+}
+catch (const TestingGearException& e)
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
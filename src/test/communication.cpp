@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "adaptive_integer.h"
+#include "big_integer.h"
+#include "communication.h"
+#include "message_passing_interface_session.h"
+
+#include <cstdint>
+#include <limits>
+
+using namespace panda;
+
+namespace
+{
+   void bytewise();
+   void adaptiveIntegers();
+   void bigIntegers();
+   void emptyTransfers();
+   /// Sends the row from the master to itself and returns what arrived.
+   template <typename Integer>
+   Row<Integer> roundTrip(const Row<Integer>&);
+   /// Sends the matrix from a slave to the master (both are this process) and returns what arrived.
+   template <typename Integer>
+   Matrix<Integer> roundTrip(const Matrix<Integer>&);
+}
+
+int main()
+try
+{
+   #ifdef MPI_SUPPORT
+   mpi::getSession();
+   bytewise();
+   adaptiveIntegers();
+   bigIntegers();
+   emptyTransfers();
+   #endif
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+#ifdef MPI_SUPPORT
+
+namespace
+{
+   void bytewise()
+   {
+      const auto max = std::numeric_limits<int64_t>::max();
+      const auto min = std::numeric_limits<int64_t>::min();
+      const Row<int64_t> row{max, min, 0, -1};
+      ASSERT(roundTrip(row) == row, "Rows of int64_t have to arrive unchanged.");
+      const Matrix<int64_t> matrix{{max, 1, -100000000000}, {min, 0, 7}};
+      ASSERT(roundTrip(matrix) == matrix, "Matrices of int64_t have to arrive unchanged.");
+   }
+
+   void adaptiveIntegers()
+   {
+      const AdaptiveInteger max(std::numeric_limits<int64_t>::max());
+      const AdaptiveInteger min(std::numeric_limits<int64_t>::min());
+      const AdaptiveInteger wide(int64_t(-100000000000));
+      const AdaptiveInteger promoted = max * max * AdaptiveInteger(int32_t(-3));
+      ASSERT(promoted.isPromoted(), "The product has to exceed 64 bits.");
+      const Row<AdaptiveInteger> row{max, min, wide, promoted, AdaptiveInteger(int32_t(0)), AdaptiveInteger(int32_t(-1))};
+      const auto received = roundTrip(row);
+      ASSERT(received == row, "Adaptive integers have to arrive at full width.");
+      ASSERT(received[3].isPromoted(), "Values beyond 64 bits have to arrive promoted.");
+      const Matrix<AdaptiveInteger> matrix{{promoted, wide, max}, {min, -promoted, AdaptiveInteger(int32_t(5))}};
+      ASSERT(roundTrip(matrix) == matrix, "Matrices of adaptive integers have to arrive at full width.");
+   }
+
+   void bigIntegers()
+   {
+      const BigInteger max(std::numeric_limits<int64_t>::max());
+      const BigInteger big = max * max * max;
+      const Row<BigInteger> row{big, -big, BigInteger(int32_t(0))};
+      ASSERT(roundTrip(row) == row, "Big integers have to arrive unchanged.");
+      const Matrix<BigInteger> matrix{{big, BigInteger(int32_t(1))}, {-big, BigInteger(int32_t(-10))}};
+      ASSERT(roundTrip(matrix) == matrix, "Matrices of big integers have to arrive unchanged.");
+   }
+
+   void emptyTransfers()
+   {
+      // the empty row terminates a slave, the empty matrix is the result of a job without new classes.
+      ASSERT(roundTrip(Row<AdaptiveInteger>{}).empty(), "The empty row has to arrive empty.");
+      ASSERT(roundTrip(Matrix<AdaptiveInteger>{}).empty(), "The empty matrix has to arrive empty.");
+      ASSERT(roundTrip(Matrix<int64_t>{}).empty(), "The empty matrix has to arrive empty.");
+   }
+
+   template <typename Integer>
+   Row<Integer> roundTrip(const Row<Integer>& row)
+   {
+      const Communication communication;
+      communication.toSlave(row, 0);
+      return communication.fromMaster<Integer>();
+   }
+
+   template <typename Integer>
+   Matrix<Integer> roundTrip(const Matrix<Integer>& matrix)
+   {
+      const Communication communication;
+      communication.toMaster(matrix);
+      return communication.fromSlave<Integer>(0);
+   }
+}
+
+#endif
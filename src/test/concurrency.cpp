@@ -21,6 +21,12 @@ namespace
    void shortValid();
    void longInvalid();
    void longValid();
+   void schedulerDefault();
+   void schedulerInvalid();
+   void schedulerValid();
+   void registryDefault();
+   void registryInvalid();
+   void registryValid();
 }
 
 int main()
@@ -31,6 +37,12 @@ try
    shortValid();
    longInvalid();
    longValid();
+   schedulerDefault();
+   schedulerInvalid();
+   schedulerValid();
+   registryDefault();
+   registryInvalid();
+   registryValid();
 }
 catch ( const TestingGearException& e )
 {
@@ -115,5 +127,68 @@ namespace
       delete [] argv[1];
       delete [] argv;
    }
+   void schedulerDefault()
+   {
+      char** argv = new char*[1];
+      argv[0] = nullptr;
+      ASSERT(concurrency::jobScheduler(1, argv) == JobScheduler::SingleQueue, "Default is the single queue");
+      delete [] argv;
+   }
+   void schedulerInvalid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--job-scheduler=");
+      ASSERT_EXCEPTION(concurrency::jobScheduler(2, argv), std::invalid_argument, "No parameter provided.");
+      strcpy(argv[1], "--job-scheduler=fifo");
+      ASSERT_EXCEPTION(concurrency::jobScheduler(2, argv), std::invalid_argument, "Unknown scheduler");
+      delete [] argv[1];
+      delete [] argv;
+   }
+   void schedulerValid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--job-scheduler=ws");
+      ASSERT(concurrency::jobScheduler(2, argv) == JobScheduler::WorkStealing, "Parameter is ws");
+      strcpy(argv[1], "--job-scheduler=work-stealing");
+      ASSERT(concurrency::jobScheduler(2, argv) == JobScheduler::WorkStealing, "Parameter is work-stealing");
+      strcpy(argv[1], "--job-scheduler=single");
+      ASSERT(concurrency::jobScheduler(2, argv) == JobScheduler::SingleQueue, "Parameter is single");
+      delete [] argv[1];
+      delete [] argv;
+   }
+   void registryDefault()
+   {
+      char** argv = new char*[1];
+      argv[0] = nullptr;
+      ASSERT(concurrency::classRegistryType(1, argv) == ClassRegistryType::Hashed, "Default is the hashed registry");
+      delete [] argv;
+   }
+   void registryInvalid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--class-registry=");
+      ASSERT_EXCEPTION(concurrency::classRegistryType(2, argv), std::invalid_argument, "No parameter provided.");
+      strcpy(argv[1], "--class-registry=tree");
+      ASSERT_EXCEPTION(concurrency::classRegistryType(2, argv), std::invalid_argument, "Unknown registry");
+      delete [] argv[1];
+      delete [] argv;
+   }
+   void registryValid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--class-registry=ordered");
+      ASSERT(concurrency::classRegistryType(2, argv) == ClassRegistryType::Ordered, "Parameter is ordered");
+      strcpy(argv[1], "--class-registry=hashed");
+      ASSERT(concurrency::classRegistryType(2, argv) == ClassRegistryType::Hashed, "Parameter is hashed");
+      delete [] argv[1];
+      delete [] argv;
+   }
 }
-
@@ -0,0 +1,75 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "dense_matrix.h"
+
+#include <cstdint>
+
+using namespace panda;
+
+namespace
+{
+   void construction();
+   void layout();
+   void copy();
+}
+
+int main()
+try
+{
+   construction();
+   layout();
+   copy();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void construction()
+   {
+      const DenseMatrix<int> empty;
+      ASSERT(empty.empty() && empty.rows() == 0, "Default constructed matrix has to be empty.");
+      const Matrix<int> matrix{{1, 2, 3}, {4, 5, 6}};
+      const DenseMatrix<int> dense(matrix);
+      ASSERT(dense.rows() == 2 && dense.columns() == 3, "Data returned is invalid.");
+      ASSERT((dense[1].toRow() == Row<int>{4, 5, 6}), "Data returned is invalid.");
+      ASSERT(dense[0][2] == 3 && dense[0].size() == 3, "Data returned is invalid.");
+      ASSERT(dense.toMatrix() == matrix, "Conversion has to preserve the data.");
+      const DenseMatrix<int> zeros(3, 2);
+      ASSERT((zeros.toMatrix() == Matrix<int>(3, Row<int>(2, 0))), "New matrix has to be zero.");
+   }
+
+   void layout()
+   {
+      const DenseMatrix<int32_t> dense(5, 3);
+      ASSERT(dense.stride() == 8, "Rows have to be padded to 32 bytes.");
+      ASSERT(reinterpret_cast<std::uintptr_t>(dense.data(0)) % 64 == 0, "First row has to start on a cache line.");
+      ASSERT(dense.data(1) - dense.data(0) == 8, "Rows have to be contiguous.");
+      ASSERT(DenseMatrix<int64_t>(1, 5).stride() == 8, "Rows have to be padded to 32 bytes.");
+      ASSERT(DenseMatrix<int16_t>(1, 16).stride() == 16, "Rows that fill whole blocks aren't padded.");
+   }
+
+   void copy()
+   {
+      DenseMatrix<int> dense(Matrix<int>{{1, 2}, {3, 4}});
+      DenseMatrix<int> second(dense);
+      second.data(0)[0] = 7;
+      ASSERT(dense[0][0] == 1 && second[0][0] == 7, "Copies have to be independent.");
+      ASSERT(reinterpret_cast<std::uintptr_t>(second.data(0)) % 64 == 0, "Copies have to be aligned.");
+      DenseMatrix<int> third;
+      third = second;
+      ASSERT((third.toMatrix() == Matrix<int>{{7, 2}, {3, 4}}), "Data returned is invalid.");
+      const auto moved = std::move(third);
+      ASSERT(moved.rows() == 2 && moved[1][1] == 4, "Data returned is invalid.");
+   }
+}
+
@@ -0,0 +1,164 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "distance_kernels.h"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void instructionSet();
+   template <typename Entry>
+   void randomRows();
+   void overflow32();
+   void overflow64();
+}
+
+int main()
+try
+{
+   instructionSet();
+   randomRows<int32_t>();
+   randomRows<int64_t>();
+   overflow32();
+   overflow64();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   bool vectorized()
+   {
+      return std::strcmp(algorithm::distanceKernelInstructionSet(), "scalar") != 0;
+   }
+
+   void instructionSet()
+   {
+      const std::string name = algorithm::distanceKernelInstructionSet();
+      ASSERT(name == "avx512" || name == "avx2" || name == "scalar", "Unknown instruction set.");
+   }
+
+   template <typename Entry>
+   void randomRows()
+   {
+      std::mt19937 generator(7);
+      std::uniform_int_distribution<int> entry(-3, 3);
+      for ( std::size_t columns = 1; columns <= 40; ++columns )
+      {
+         for ( const auto padding : {std::size_t{0}, std::size_t{3}} )
+         {
+            const auto stride = columns + padding;
+            const std::size_t rows = 1 + columns * 3;
+            std::vector<Entry> matrix(rows * stride, 7);
+            std::vector<Entry> vector(columns);
+            for ( std::size_t i = 0; i < rows; ++i )
+            {
+               for ( std::size_t j = 0; j < columns; ++j )
+               {
+                  matrix[i * stride + j] = static_cast<Entry>(entry(generator));
+               }
+            }
+            for ( auto& value : vector )
+            {
+               value = static_cast<Entry>(entry(generator));
+            }
+            std::vector<int64_t> products(rows);
+            for ( std::size_t i = 0; i < rows; ++i )
+            {
+               for ( std::size_t j = 0; j < columns; ++j )
+               {
+                  products[i] += static_cast<int64_t>(matrix[i * stride + j]) * static_cast<int64_t>(vector[j]);
+               }
+            }
+            std::size_t minimum = 0;
+            std::size_t maximum = 0;
+            std::vector<std::size_t> zeros;
+            for ( std::size_t i = 0; i < rows; ++i )
+            {
+               minimum = ( products[i] < products[minimum] ) ? i : minimum;
+               maximum = ( products[i] > products[maximum] ) ? i : maximum;
+               if ( products[i] == 0 )
+               {
+                  zeros.push_back(i);
+               }
+            }
+            algorithm::ExtremalRows result{rows, rows};
+            std::vector<std::size_t> indices;
+            const auto extremal = algorithm::extremalScalarProducts(matrix.data(), rows, columns, stride, vector.data(), result);
+            const auto zero = algorithm::zeroScalarProducts(matrix.data(), rows, columns, stride, vector.data(), indices);
+            ASSERT(extremal == vectorized() && zero == vectorized(), "Kernels must succeed exactly if they are vectorized.");
+            if ( vectorized() )
+            {
+               ASSERT(result.minimum == minimum && result.maximum == maximum, "Kernels must return the first extremal rows.");
+               ASSERT(indices == zeros, "Kernels must return all rows with product zero.");
+            }
+         }
+      }
+   }
+
+   void overflow32()
+   {
+      const auto big = std::numeric_limits<int32_t>::max();
+      std::vector<int32_t> matrix{1, 1, big, big, 1, -1};
+      std::vector<int32_t> vector{big, 1};
+      algorithm::ExtremalRows result;
+      std::vector<std::size_t> indices;
+      ASSERT(algorithm::extremalScalarProducts(matrix.data(), 3, 2, 2, vector.data(), result) == false, "Products beyond 32 bits must be detected.");
+      ASSERT(algorithm::zeroScalarProducts(matrix.data(), 3, 2, 2, vector.data(), indices) == false && indices.empty(), "Products beyond 32 bits must be detected.");
+      // each product fits into 64 bits, but their sum doesn't.
+      const auto low = std::numeric_limits<int32_t>::min();
+      std::vector<int32_t> extreme{low, low, low, low};
+      std::vector<int32_t> scale{low, low, low, low};
+      ASSERT(algorithm::extremalScalarProducts(extreme.data(), 1, 4, 4, scale.data(), result) == false, "Overflow of the accumulation must be detected.");
+      std::vector<int32_t> unit{1, 0};
+      std::vector<int32_t> lowest{low, 5};
+      ASSERT(algorithm::extremalScalarProducts(unit.data(), 1, 2, 2, lowest.data(), result) == false, "The smallest value must be rejected.");
+      if ( vectorized() )
+      {
+         std::vector<int32_t> small{1, 1, 0, 2, -1, -1};
+         std::vector<int32_t> weights{int32_t{1} << 28, 1};
+         ASSERT(algorithm::extremalScalarProducts(small.data(), 3, 2, 2, weights.data(), result), "Products within 32 bits must be accepted.");
+         ASSERT(result.minimum == 2 && result.maximum == 0, "Bad extremal rows.");
+      }
+   }
+
+   void overflow64()
+   {
+      const int64_t wide = int64_t{1} << 40;
+      std::vector<int64_t> matrix{1, 1, 1, 2, 3, 4};
+      std::vector<int64_t> vector{1, wide};
+      algorithm::ExtremalRows result;
+      std::vector<std::size_t> indices;
+      ASSERT(algorithm::extremalScalarProducts(matrix.data(), 3, 2, 2, vector.data(), result) == false, "Entries beyond 32 bits must be rejected.");
+      ASSERT(algorithm::zeroScalarProducts(matrix.data(), 3, 2, 2, vector.data(), indices) == false, "Entries beyond 32 bits must be rejected.");
+      const auto big = int64_t{std::numeric_limits<int32_t>::min()};
+      std::vector<int64_t> extreme{big, big, big, big, big, big, big, big};
+      ASSERT(algorithm::extremalScalarProducts(extreme.data(), 1, 8, 8, extreme.data(), result) == false, "Overflow of the accumulation must be detected.");
+      if ( vectorized() )
+      {
+         std::vector<int64_t> products{big, 1, big, -1};
+         ASSERT(algorithm::extremalScalarProducts(products.data(), 2, 2, 2, vector.data(), result) == false, "Entries beyond 32 bits must be rejected.");
+         const auto half = -(int64_t{1} << 30);
+         std::vector<int64_t> factors{half, 1, half, -1};
+         std::vector<int64_t> halves{half, half};
+         ASSERT(algorithm::extremalScalarProducts(factors.data(), 2, 2, 2, halves.data(), result), "Products of 32 bit entries fit into 64 bits.");
+         ASSERT(result.minimum == 0 && result.maximum == 1, "Bad extremal rows.");
+      }
+   }
+}
+
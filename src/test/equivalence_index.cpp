@@ -0,0 +1,111 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "algorithm_classes.h"
+#include "equivalence_index.h"
+
+#include <atomic>
+#include <list>
+#include <stdexcept>
+#include <thread>
+
+using namespace panda;
+
+namespace
+{
+   void fingerprints();
+   void withoutMaps();
+   void withMaps();
+   void multipleThreads();
+   void noDeterministics();
+   /// Deterministic points x0, x1 and x0 + x1.
+   const Deterministics<int> deterministics{{1, 0}, {0, 1}, {1, 1}};
+   /// Map x0 <-> x1.
+   const Maps swap{{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}}};
+}
+
+int main()
+try
+{
+   fingerprints();
+   withoutMaps();
+   withMaps();
+   multipleThreads();
+   noDeterministics();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void fingerprints()
+   {
+      const auto a = algorithm::fingerprint(Row<int>{1, 2, 1}, deterministics);
+      ASSERT((a == Row<int>{0, 1, 2}), "Values have to be shifted to zero, divided by their gcd and sorted.");
+      ASSERT(a == algorithm::fingerprint(Row<int>{2, 1, 1}, deterministics), "Permuted values have the same fingerprint.");
+      ASSERT(a == algorithm::fingerprint(Row<int>{2, 4, 1}, deterministics), "Scaled values have the same fingerprint.");
+      ASSERT(a != algorithm::fingerprint(Row<int>{1, 3, 1}, deterministics), "Data returned is invalid.");
+   }
+
+   void withoutMaps()
+   {
+      const EquivalenceIndex<int, tag::vertex> index(deterministics, Maps{});
+      ASSERT(index.insert(Row<int>{1, 2, 1}), "First row of a class has to be new.");
+      ASSERT(!index.insert(Row<int>{2, 4, 1}), "Rows with the same rescaled values are equivalent.");
+      ASSERT(index.insert(Row<int>{2, 1, 1}), "Without maps, permuted values aren't equivalent.");
+      ASSERT(index.insert(Row<int>{1, 3, 1}), "First row of a class has to be new.");
+      ASSERT(index.insert(Row<int>{1, 3001, 1}), "First row of a class has to be new.");
+      ASSERT(index.insert(Row<int>{1, 4001, 1}), "Rows that only differ slightly aren't equivalent.");
+      ASSERT(index.insert(Row<int>{0, 0, 1}), "Rows with equal values are always new.");
+      ASSERT(index.insert(Row<int>{0, 0, 1}), "Rows with equal values are always new.");
+      ASSERT(index.size() == 7, "Every class has to be stored once.");
+   }
+
+   void withMaps()
+   {
+      const EquivalenceIndex<int, tag::vertex> index(deterministics, swap);
+      ASSERT(index.insert(Row<int>{1, 2, 1}), "First row of a class has to be new.");
+      ASSERT(!index.insert(Row<int>{2, 1, 1}), "Rows mapped onto each other are equivalent.");
+      ASSERT(index.insert(Row<int>{1, 3, 1}), "First row of a class has to be new.");
+      ASSERT(index.size() == 2, "Every class has to be stored once.");
+   }
+
+   void multipleThreads()
+   {
+      const EquivalenceIndex<int, tag::vertex> index(deterministics, swap);
+      std::atomic<int> inserted(0);
+      std::list<std::thread> threads;
+      for ( int t = 0; t < 8; ++t )
+      {
+         threads.emplace_back([&]()
+         {
+            for ( int k = 1; k <= 50; ++k )
+            {
+               inserted += index.insert(Row<int>{k, 2 * k, 1}) ? 1 : 0;
+               inserted += index.insert(Row<int>{2 * k, k, 1}) ? 1 : 0;
+               inserted += index.insert(Row<int>{k, 3 * k, 1}) ? 1 : 0;
+            }
+         });
+      }
+      for ( auto& thread : threads )
+      {
+         thread.join();
+      }
+      ASSERT(inserted == 2, "Each class has to be new for exactly one thread.");
+      ASSERT(index.size() == 2, "Every class has to be stored once.");
+   }
+
+   void noDeterministics()
+   {
+      ASSERT_EXCEPTION((EquivalenceIndex<int, tag::vertex>(Deterministics<int>{}, Maps{})), std::invalid_argument, "Deterministic points are needed.");
+   }
+}
+
@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "helper_pool.h"
+#include "joining_thread.h"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace panda;
+
+namespace
+{
+   void withoutHelpers();
+   void concurrentHelpers();
+   void concurrentCallers();
+   void exceptions();
+}
+
+int main()
+try
+{
+   withoutHelpers();
+   concurrentHelpers();
+   concurrentCallers();
+   exceptions();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void withoutHelpers()
+   {
+      const HelperPool pool(0);
+      ASSERT(pool.size() == 0, "");
+      std::size_t calls = 0;
+      pool.run([&]() { ++calls; ASSERT(true, ""); }, 3);
+      ASSERT(calls == 1, "Without helpers, only the caller runs the task.");
+      const HelperPool helpers(2);
+      helpers.run([&]() { ++calls; }, 0);
+      ASSERT(calls == 2, "Without requested helpers, only the caller runs the task.");
+   }
+
+   void concurrentHelpers()
+   {
+      const HelperPool pool(3);
+      ASSERT(pool.size() == 3, "");
+      // the task only ends if all four threads run it at the same time.
+      std::atomic<std::size_t> arrived(0);
+      std::mutex mutex;
+      std::set<std::thread::id> threads;
+      pool.run([&]()
+      {
+         {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+         }
+         ++arrived;
+         while ( arrived < 4 )
+         {
+            std::this_thread::yield();
+         }
+      }, 3);
+      ASSERT(threads.size() == 4 && threads.count(std::this_thread::get_id()) == 1, "The caller and the helpers have to run the task.");
+      // the threads are kept for the next task.
+      std::atomic<std::size_t> items(0);
+      std::atomic<std::size_t> next(0);
+      for ( int i = 0; i < 100; ++i )
+      {
+         next = 0;
+         pool.run([&]()
+         {
+            for ( auto j = next++; j < 50; j = next++ )
+            {
+               ++items;
+            }
+         }, 3);
+      }
+      ASSERT(items == 5000, "Every item has to be processed exactly once.");
+   }
+
+   void concurrentCallers()
+   {
+      const HelperPool pool(2);
+      std::atomic<std::size_t> items(0);
+      {
+         std::list<JoiningThread> callers;
+         for ( int i = 0; i < 4; ++i )
+         {
+            callers.emplace_back([&]()
+            {
+               for ( int k = 0; k < 100; ++k )
+               {
+                  std::atomic<std::size_t> next(0);
+                  pool.run([&]()
+                  {
+                     for ( auto j = next++; j < 10; j = next++ )
+                     {
+                        ++items;
+                     }
+                  }, 2);
+               }
+            });
+         }
+      }
+      ASSERT(items == 4000, "Tasks of different callers must not be mixed up.");
+   }
+
+   void exceptions()
+   {
+      const HelperPool pool(2);
+      std::atomic<std::size_t> calls(0);
+      ASSERT_EXCEPTION(pool.run([&]() { if ( calls++ == 0 ) { throw std::runtime_error("fail"); } }, 2), std::runtime_error, "Exceptions of the caller have to be passed on.");
+      std::atomic<bool> caller_done(false);
+      const auto caller = std::this_thread::get_id();
+      ASSERT_EXCEPTION(pool.run([&]()
+      {
+         if ( std::this_thread::get_id() == caller )
+         {
+            // wait until a helper picked up the task.
+            while ( !caller_done )
+            {
+               std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return;
+         }
+         caller_done = true;
+         throw std::runtime_error("fail");
+      }, 1), std::runtime_error, "Exceptions of helpers have to be passed on.");
+   }
+}
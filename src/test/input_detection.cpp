@@ -9,6 +9,7 @@
 #include "input_detection.h"
 
 #include <cstring>
+#include <stdexcept>
 
 using namespace panda;
 
@@ -16,6 +17,7 @@ namespace
 {
    void testContainsMultipleFilenames();
    void testGetFilename();
+   void testGetJobOrder();
 }
 
 int main()
@@ -23,6 +25,7 @@ try
 {
    testContainsMultipleFilenames();
    testGetFilename();
+   testGetJobOrder();
 }
 catch ( const TestingGearException& e )
 {
@@ -68,5 +71,29 @@ namespace
       delete [] argv[1];
       delete [] argv;
    }
+
+   void testGetJobOrder()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[40];
+      ASSERT(getJobOrder(1, argv).type == JobOrderType::Fifo, "Default order is FIFO");
+      strcpy(argv[1], "--job-order=inc_asc");
+      ASSERT(getJobOrder(2, argv).type == JobOrderType::IncidenceAscending, "Parameter is inc_asc");
+      strcpy(argv[1], "--job-order=incidence_descending");
+      ASSERT(getJobOrder(2, argv).type == JobOrderType::IncidenceDescending, "Parameter is incidence_descending");
+      strcpy(argv[1], "--job-order=score:1,-2,0");
+      const auto order = getJobOrder(2, argv);
+      ASSERT(order.type == JobOrderType::Score, "Parameter is score");
+      ASSERT((order.weights == std::vector<int>{1, -2, 0}), "Weights are 1, -2, 0");
+      strcpy(argv[1], "--job-order=score:1,,2");
+      ASSERT_EXCEPTION(getJobOrder(2, argv), std::invalid_argument, "Missing weight");
+      strcpy(argv[1], "--job-order=score:1,x");
+      ASSERT_EXCEPTION(getJobOrder(2, argv), std::invalid_argument, "Weight is not a number");
+      strcpy(argv[1], "--job-order=random");
+      ASSERT_EXCEPTION(getJobOrder(2, argv), std::invalid_argument, "Unknown order");
+      delete [] argv[1];
+      delete [] argv;
+   }
 }
 
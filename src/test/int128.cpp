@@ -0,0 +1,69 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "int128.h"
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace panda;
+
+#ifdef __SIZEOF_INT128__
+namespace
+{
+   void test_output();
+   void test_input();
+}
+
+int main()
+try
+{
+   test_output();
+   test_input();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   std::string print(const int128_t value)
+   {
+      std::ostringstream stream;
+      stream << value;
+      return stream.str();
+   }
+
+   void test_output()
+   {
+      ASSERT(print(0) == "0" && print(-1) == "-1" && print(1234567) == "1234567", "Bad output.");
+      ASSERT(print(std::numeric_limits<int128_t>::max()) == "170141183460469231731687303715884105727", "Bad output of the largest value.");
+      ASSERT(print(std::numeric_limits<int128_t>::min()) == "-170141183460469231731687303715884105728", "Bad output of the smallest value.");
+   }
+
+   void test_input()
+   {
+      std::istringstream stream("  42 -170141183460469231731687303715884105728 +7 170141183460469231731687303715884105728");
+      int128_t value = 0;
+      ASSERT(stream >> value && value == 42, "Bad input.");
+      ASSERT(stream >> value && value == std::numeric_limits<int128_t>::min(), "Bad input of the smallest value.");
+      ASSERT(stream >> value && value == 7, "Bad input with sign.");
+      ASSERT(!(stream >> value), "Values out of range must fail.");
+      std::istringstream letters("x");
+      ASSERT(!(letters >> value), "Input without digits must fail.");
+   }
+}
+#else
+int main()
+{
+}
+#endif
+
@@ -0,0 +1,164 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "algorithm_map_operations.h"
+#include "algorithm_matrix_operations.h"
+#include "big_integer.h"
+#include "integer_type_analysis.h"
+
+#include <cmath>
+#include <cstdint>
+
+using namespace panda;
+
+namespace
+{
+   void test_empty();
+   void test_cube();
+   void test_bound();
+   void test_selection();
+   void test_all_terms();
+   void test_wide_input();
+   void test_equations();
+}
+
+int main()
+try
+{
+   test_empty();
+   test_cube();
+   test_bound();
+   test_selection();
+   test_all_terms();
+   test_wide_input();
+   test_equations();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   /// Square matrix with the given value on and below the diagonal.
+   Matrix<int> triangle(const std::size_t size, const int value)
+   {
+      Matrix<int> matrix(size, Row<int>(size, 0));
+      for ( std::size_t i = 0; i < size; ++i )
+      {
+         for ( std::size_t j = 0; j <= i; ++j )
+         {
+            matrix[i][j] = value;
+         }
+      }
+      return matrix;
+   }
+
+   void test_empty()
+   {
+      ASSERT(narrowestSafeIntegerType(Matrix<int>{}) == IntegerType::Fixed32, "Empty input is safe with 32 bits.");
+      ASSERT(narrowestSafeIntegerType(Matrix<int>{Row<int>{0, 0, 0}}) == IntegerType::Fixed32, "Zero rows are safe with 32 bits.");
+   }
+
+   void test_cube()
+   {
+      Matrix<int> cube;
+      for ( int i = 0; i < 8; ++i )
+      {
+         cube.push_back(Row<int>{i & 1, (i >> 1) & 1, (i >> 2) & 1, 1});
+      }
+      // the largest row norms are 2, sqrt(3), sqrt(3), sqrt(3), hence the bound is 2 * sqrt(4) * (2 * sqrt(27))^2 * 2.
+      ASSERT(std::fabs(coefficientGrowthBound(cube) - (5.0 + 3.0 * std::log2(3.0))) < 1e-9, "Bad bound for the cube.");
+      ASSERT(narrowestSafeIntegerType(cube) == IntegerType::Fixed32, "The cube is safe with 32 bits.");
+   }
+
+   void test_bound()
+   {
+      auto matrix = triangle(4, 3);
+      const auto bound = coefficientGrowthBound(matrix);
+      matrix.push_back(Row<int>{1, 0, 0, 0});
+      ASSERT(std::fabs(coefficientGrowthBound(matrix) - bound) < 1e-9, "Short rows beyond the dimension don't change the bound.");
+      matrix.push_back(Row<int>{100, 100, 100, 100});
+      ASSERT(coefficientGrowthBound(matrix) > bound, "Long rows increase the bound.");
+      auto negative = triangle(4, -3);
+      ASSERT(std::fabs(coefficientGrowthBound(negative) - bound) < 1e-9, "The bound doesn't depend on signs.");
+   }
+
+   void test_selection()
+   {
+      ASSERT(narrowestSafeIntegerType(triangle(5, 10)) == IntegerType::Fixed64, "Expected 64 bits.");
+      #ifdef __SIZEOF_INT128__
+      ASSERT(narrowestSafeIntegerType(triangle(6, 100)) == IntegerType::Fixed128, "Expected 128 bits.");
+      #else
+      ASSERT(narrowestSafeIntegerType(triangle(6, 100)) == IntegerType::Variable, "Expected arbitrary precision.");
+      #endif
+      ASSERT(narrowestSafeIntegerType(triangle(10, 1000)) == IntegerType::Variable, "Expected arbitrary precision.");
+   }
+
+   void test_all_terms()
+   {
+      const auto input = triangle(5, 1);
+      ASSERT(narrowestSafeIntegerType(input, {}, {}, {}) == IntegerType::Fixed32, "Expected 32 bits.");
+      ASSERT(narrowestSafeIntegerType(input, triangle(5, 10), {}, {}) == IntegerType::Fixed64, "Known rows have to be part of the bound.");
+      ASSERT(narrowestSafeIntegerType(input, {}, Matrix<int>{{1000, 1000, 1000, 1000}}, {}) != IntegerType::Fixed32, "Deterministic points have to be part of the bound.");
+      const Maps permutation{{{{1, -1}}, {{0, 1}}, {{2, 1}}, {{3, 1}}, {{4, 1}}}};
+      ASSERT(narrowestSafeIntegerType(input, {}, {}, permutation) == IntegerType::Fixed32, "Signed permutations keep the magnitudes.");
+      const Maps scaling{{{{0, 2}}, {{1, 1}}, {{2, 1}}, {{3, 1}}, {{4, 1}}}};
+      ASSERT(narrowestSafeIntegerType(input, {}, {}, scaling) == IntegerType::Safe, "Other maps need a checked type.");
+      const Maps sum{{{{0, 1}, {1, 1}}, {{1, 1}}, {{2, 1}}, {{3, 1}}, {{4, 1}}}};
+      ASSERT(narrowestSafeIntegerType(input, {}, {}, sum) == IntegerType::Safe, "Other maps need a checked type.");
+      ASSERT(narrowestSafeIntegerType(input, Matrix<int>{{1, 1, 1, 1, 1, 1}}, {}, {}) == IntegerType::Safe, "Rows that don't fit the input need a checked type.");
+   }
+
+   void test_wide_input()
+   {
+      Matrix<BigInteger> matrix;
+      for ( const auto& row : triangle(5, 10) )
+      {
+         matrix.emplace_back();
+         for ( const auto entry : row )
+         {
+            matrix.back().emplace_back(int32_t(entry));
+         }
+      }
+      ASSERT(std::fabs(coefficientGrowthBound(matrix) - coefficientGrowthBound(triangle(5, 10))) < 1e-9, "The bound doesn't depend on the integer type.");
+      ASSERT(narrowestSafeIntegerType(matrix) == IntegerType::Fixed64, "Expected 64 bits.");
+      // entries beyond int.
+      matrix.front().front() = BigInteger(int64_t(1) << 40);
+      ASSERT(coefficientGrowthBound(matrix) > 80.0, "Wide entries have to enter the bound.");
+      // entries beyond double.
+      BigInteger huge(int32_t(1));
+      for ( int i = 0; i < 400; ++i )
+      {
+         huge *= BigInteger(int32_t(10));
+      }
+      matrix.front().front() = huge;
+      ASSERT(narrowestSafeIntegerType(matrix) == IntegerType::Variable, "Expected arbitrary precision.");
+      ASSERT(narrowestSafeIntegerType(matrix, {}, {}, {}) == IntegerType::Variable, "Expected arbitrary precision.");
+   }
+
+   void test_equations()
+   {
+      Matrix<int> cube;
+      for ( int i = 0; i < 8; ++i )
+      {
+         cube.push_back(Row<int>{i & 1, (i >> 1) & 1, (i >> 2) & 1, 1});
+      }
+      // hexagon of the permutations of (0, 1, 2), it lies in the plane x0 + x1 + x2 = 3.
+      const Matrix<int> hexagon{{0, 1, 2, 1}, {0, 2, 1, 1}, {1, 0, 2, 1}, {1, 2, 0, 1}, {2, 0, 1, 1}, {2, 1, 0, 1}};
+      const Maps swap{{{{1, 1}}, {{0, 1}}, {{2, 1}}, {{3, 1}}}};
+      ASSERT(narrowestSafeIntegerTypeForFacets(cube, {}, swap) == IntegerType::Fixed32, "Full dimensional input with signed permutations is safe with 32 bits.");
+      ASSERT(narrowestSafeIntegerTypeForFacets(hexagon, {}, Maps{}) == IntegerType::Safe, "Equations reduce the rows, a checked type is needed.");
+      ASSERT(narrowestSafeIntegerTypeForFacets(hexagon, {}, swap) == IntegerType::Safe, "Equations reduce the rows, a checked type is needed.");
+      // the swap becomes a map with sums of coordinates once the equation is used to eliminate a coordinate.
+      const auto equations = algorithm::extractEquations(hexagon);
+      ASSERT(equations.size() == 1, "The hexagon has one equation.");
+      ASSERT(narrowestSafeIntegerType(hexagon, {}, {}, algorithm::normalize(swap, equations)) == IntegerType::Safe, "Normalized maps are no signed permutations.");
+   }
+}
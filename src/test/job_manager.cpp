@@ -0,0 +1,42 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "job_manager.h"
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+using namespace panda;
+
+int main()
+try
+{
+   // We do not care for the output here.
+   SILENCE_CERR();
+   std::cout.rdbuf(nullptr);
+   {  // Idle threads are only handed out to one job at a time.
+      JobManager<int, tag::facet> manager({}, 1, 4, JobScheduler::SingleQueue, ClassRegistryType::Hashed, "", std::chrono::milliseconds(100), "", std::chrono::seconds(600), JobPriority<int>());
+      manager.put(Facets<int>{{0}});
+      ASSERT(manager.get() == Facet<int>{0}, "Data returned is invalid.");
+      ASSERT(manager.parallelism() == 4, "A single job may use all threads.");
+      ASSERT(manager.parallelism() == 4, "Asking again replaces the threads reserved by the caller.");
+      std::size_t other = 0;
+      std::thread([&]() { other = manager.parallelism(); }).join();
+      ASSERT(other == 1, "Threads that help another job mustn't be handed out again.");
+      manager.put(Facets<int>{});
+      ASSERT(manager.get().empty(), "All jobs are done.");
+      std::thread([&]() { other = manager.parallelism(); }).join();
+      ASSERT(other == 4, "Threads of a finished job have to be free again.");
+   }
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
@@ -9,9 +9,14 @@
 #include "list.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using namespace panda;
 
@@ -22,7 +27,8 @@ try
    SILENCE_CERR();
    std::cout.rdbuf(nullptr);
    {  // A get call has to block until new data is available
-      List<int, tag::facet> list({});
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      List<int, tag::facet> list({}, ClassRegistryType::Hashed, output, JobPriority<int>());
       list.put(Facets<int>{{0}});
       ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
       std::atomic<bool> empty = ATOMIC_VAR_INIT(true);
@@ -50,7 +56,8 @@ try
       setter.join();
    }
    { // A blocked get call has to be unblocked once the empty state is detected
-      List<int, tag::facet> list({});
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      List<int, tag::facet> list({}, ClassRegistryType::Hashed, output, JobPriority<int>());
       list.put(Facets<int>{{0}});
       ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
       std::atomic<bool> empty = ATOMIC_VAR_INIT(true);
@@ -78,6 +85,57 @@ try
       getter.join();
       setter.join();
    }
+   { // A snapshot lists all classes and the unfinished jobs, a restored list continues with them
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      List<int, tag::facet> list({}, ClassRegistryType::Hashed, output, JobPriority<int>());
+      list.put(Facets<int>{{0}});
+      ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
+      list.put(Facets<int>{{1}, {2}});
+      const auto job = list.get();
+      ASSERT((list.load() == std::make_pair<std::size_t, std::size_t>(1, 1)), "One job has to be in progress and one has to be queued.");
+      const auto state = list.snapshot();
+      std::set<Facet<int>> classes;
+      std::set<Facet<int>> jobs;
+      for ( const auto row : state.first )
+      {
+         classes.insert(*row);
+      }
+      for ( const auto row : state.second )
+      {
+         jobs.insert(*row);
+      }
+      ASSERT((classes == std::set<Facet<int>>{{0}, {1}, {2}}), "All classes have to be in the snapshot.");
+      ASSERT((jobs == std::set<Facet<int>>{{1}, {2}}), "Queued jobs and jobs in progress have to be in the snapshot.");
+      List<int, tag::facet> restored({}, ClassRegistryType::Hashed, output, JobPriority<int>());
+      restored.restore(Facets<int>{{0}, {1}, {2}}, Facets<int>{{1}, {2}});
+      std::set<Facet<int>> processed;
+      while ( true )
+      {
+         const auto row = restored.get();
+         if ( row.empty() )
+         {
+            break;
+         }
+         processed.insert(row);
+         restored.put(Facets<int>{{0}, {1}});
+      }
+      ASSERT((processed == std::set<Facet<int>>{{1}, {2}}), "Exactly the unfinished jobs have to be processed after restoring.");
+      ASSERT((restored.load() == std::make_pair<std::size_t, std::size_t>(0, 0)), "No job may be left once all jobs are done.");
+      ASSERT(job == Facet<int>{1} || job == Facet<int>{2}, "Data returned is invalid.");
+   }
+   { // With a priority, jobs are handed out lowest priority first (ties in order of insertion)
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      List<int, tag::facet> list({}, ClassRegistryType::Hashed, output, [](const Facet<int>& row) { return row[1]; });
+      list.put(Facets<int>{{0, 5}});
+      ASSERT((list.get() == Facet<int>{0, 5}), "Data returned is invalid.");
+      list.put(Facets<int>{{1, 3}, {2, 1}, {3, 3}, {4, 2}});
+      std::vector<int> order;
+      for ( int i = 0; i < 4; ++i )
+      {
+         order.push_back(list.get()[0]);
+      }
+      ASSERT((order == std::vector<int>{2, 4, 1, 3}), "Jobs have to be handed out by priority.");
+   }
 }
 catch ( const TestingGearException& e )
 {
@@ -0,0 +1,118 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "job_manager.h"
+#include "method_adjacency_decomposition_implementation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void withoutRecursion();
+   void withRecursion();
+   void withRecursionAndMaps();
+   /// Runs facet enumeration by adjacency decomposition on the cube with the given options and returns the facets printed.
+   std::multiset<std::string> decompose(const Maps&, std::vector<std::string>);
+   /// Aborts if the decomposition ended the process early (which reports success otherwise).
+   void checkFinished();
+   /// Cube [0,1]^3.
+   const Matrix<int> cube{{0, 0, 0, 1}, {0, 0, 1, 1}, {0, 1, 0, 1}, {0, 1, 1, 1}, {1, 0, 0, 1}, {1, 0, 1, 1}, {1, 1, 0, 1}, {1, 1, 1, 1}};
+   const std::multiset<std::string> facets{"-x0 <= 0", "-x1 <= 0", "-x2 <= 0", "x0 <= 1", "x1 <= 1", "x2 <= 1"};
+   const std::string filename = "method_adjacency_decomposition_implementation_test.out";
+   bool finished = false;
+}
+
+int main()
+try
+{
+   std::atexit(checkFinished);
+   withoutRecursion();
+   withRecursion();
+   withRecursionAndMaps();
+   std::remove(filename.c_str());
+   finished = true;
+}
+catch ( const TestingGearException& e )
+{
+   std::remove(filename.c_str());
+   std::cerr << e.what() << "\n";
+   finished = true;
+   return 1;
+}
+
+namespace
+{
+   void withoutRecursion()
+   {
+      ASSERT(decompose(Maps{}, {}) == facets, "Adjacency decomposition has to find every facet exactly once.");
+      ASSERT(decompose(Maps{}, {"-t", "3"}) == facets, "Adjacency decomposition has to find every facet exactly once.");
+   }
+
+   void withRecursion()
+   {
+      ASSERT(decompose(Maps{}, {"--recursion-depth=2", "--recursion-threshold=1"}) == facets, "Recursion must not change the facets found.");
+      ASSERT(decompose(Maps{}, {"--recursion-depth=2", "--recursion-threshold=1", "-t", "3"}) == facets, "Recursion must not change the facets found.");
+      ASSERT(decompose(Maps{}, {"--recursion-depth=1", "--recursion-threshold=1", "-t", "3", "--job-scheduler=ws"}) == facets, "Recursion must not change the facets found.");
+   }
+
+   void withRecursionAndMaps()
+   {
+      const Map mirror_0{{std::make_pair(3u, 1), std::make_pair(0u, -1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const Map swap_01{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}};
+      const Map swap_12{{std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(1u, 1)}, {std::make_pair(3u, 1)}};
+      const auto found = decompose(Maps{mirror_0, swap_01, swap_12}, {"--recursion-depth=2", "--recursion-threshold=1", "-t", "2"});
+      ASSERT(!found.empty(), "Adjacency decomposition has to find a facet.");
+      for ( const auto& facet : found )
+      {
+         ASSERT(facets.count(facet) == 1, "Adjacency decomposition may only find facets.");
+      }
+   }
+
+   std::multiset<std::string> decompose(const Maps& maps, std::vector<std::string> options)
+   {
+      options.insert(options.begin(), {"panda", "--output=" + filename});
+      std::vector<char*> argv;
+      for ( auto& option : options )
+      {
+         argv.push_back(&option[0]);
+      }
+      argv.push_back(nullptr);
+      const auto data = std::make_tuple(cube, Names{"x0", "x1", "x2"}, maps, Matrix<int>{});
+      implementation::adjacencyDecomposition<JobManager>(static_cast<int>(options.size()), argv.data(), data, tag::facet{});
+      std::ifstream file(filename.c_str());
+      std::string line;
+      std::getline(file, line);
+      ASSERT(line.find("Inequalities:") != std::string::npos, "Output has to start with the header.");
+      std::multiset<std::string> result;
+      while ( std::getline(file, line) )
+      {
+         if ( !line.empty() )
+         {
+            result.insert(line);
+         }
+      }
+      return result;
+   }
+
+   void checkFinished()
+   {
+      if ( !finished )
+      {
+         std::cerr << "Adjacency decomposition ended the process.\n";
+         std::_Exit(1);
+      }
+   }
+}
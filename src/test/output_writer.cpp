@@ -0,0 +1,161 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "output.h"
+#include "output_writer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void singleThread();
+   void multipleThreads();
+   void invalidFile();
+   void optionDefaults();
+   void optionInvalid();
+   void optionValid();
+   std::vector<std::string> readLines(const std::string&);
+   const std::string filename = "output_writer_test.out";
+}
+
+int main()
+try
+{
+   singleThread();
+   multipleThreads();
+   invalidFile();
+   optionDefaults();
+   optionInvalid();
+   optionValid();
+   std::remove(filename.c_str());
+}
+catch ( const TestingGearException& e )
+{
+   std::remove(filename.c_str());
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void singleThread()
+   {
+      {
+         const OutputWriter output(filename, std::chrono::milliseconds(1));
+         output.write("a\n");
+         output.write("b\nc\n");
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+         output.write("d\n");
+      } // destructor writes the remaining text
+      const auto lines = readLines(filename);
+      ASSERT((lines == std::vector<std::string>{"a", "b", "c", "d"}), "Text of a single thread has to be written in order.");
+   }
+
+   void multipleThreads()
+   {
+      const int thread_count = 8;
+      const int lines_per_thread = 1000;
+      {
+         const OutputWriter output(filename, std::chrono::milliseconds(1));
+         std::list<std::thread> threads;
+         for ( int t = 0; t < thread_count; ++t )
+         {
+            threads.emplace_back([&, t]()
+            {
+               for ( int i = 0; i < lines_per_thread; ++i )
+               {
+                  output.write(std::to_string(t) + ' ' + std::to_string(i) + '\n');
+               }
+            });
+         }
+         for ( auto& thread : threads )
+         {
+            thread.join();
+         }
+      }
+      const auto lines = readLines(filename);
+      ASSERT(lines.size() == thread_count * lines_per_thread, "No text may be lost.");
+      std::vector<int> next(thread_count, 0);
+      for ( const auto& line : lines )
+      {
+         const auto space = line.find(' ');
+         ASSERT(space != std::string::npos, "Text of different write calls must not be interleaved.");
+         const auto t = std::stoi(line.substr(0, space));
+         const auto i = std::stoi(line.substr(space + 1));
+         ASSERT(i == next[t], "Text of a single thread has to be written in order.");
+         ++next[t];
+      }
+   }
+
+   void invalidFile()
+   {
+      ASSERT_EXCEPTION(OutputWriter("/nonexistent/directory/file", std::chrono::milliseconds(1)), std::invalid_argument, "File cannot be opened");
+   }
+
+   void optionDefaults()
+   {
+      char** argv = new char*[1];
+      argv[0] = nullptr;
+      ASSERT(output::filename(1, argv).empty(), "Default output is standard output");
+      ASSERT(output::flushInterval(1, argv).count() > 0, "Default interval must be positive");
+      delete [] argv;
+   }
+
+   void optionInvalid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--output=");
+      ASSERT_EXCEPTION(output::filename(2, argv), std::invalid_argument, "Missing file name");
+      strcpy(argv[1], "--flush-interval=0");
+      ASSERT_EXCEPTION(output::flushInterval(2, argv), std::invalid_argument, "Parameter is zero");
+      strcpy(argv[1], "--flush-interval=-5");
+      ASSERT_EXCEPTION(output::flushInterval(2, argv), std::invalid_argument, "Parameter is negative");
+      strcpy(argv[1], "--flush-interval=10ms");
+      ASSERT_EXCEPTION(output::flushInterval(2, argv), std::invalid_argument, "Parameter is not a number");
+      delete [] argv[1];
+      delete [] argv;
+   }
+
+   void optionValid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--output=result.txt");
+      ASSERT(output::filename(2, argv) == "result.txt", "Parameter is result.txt");
+      strcpy(argv[1], "--flush-interval=250");
+      ASSERT(output::flushInterval(2, argv) == std::chrono::milliseconds(250), "Parameter is 250");
+      delete [] argv[1];
+      delete [] argv;
+   }
+
+   std::vector<std::string> readLines(const std::string& name)
+   {
+      std::ifstream file(name.c_str());
+      std::vector<std::string> lines;
+      std::string line;
+      while ( std::getline(file, line) )
+      {
+         lines.push_back(line);
+      }
+      return lines;
+   }
+}
+
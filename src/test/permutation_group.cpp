@@ -0,0 +1,164 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "algorithm_classes.h"
+#include "algorithm_map_operations.h"
+#include "algorithm_row_operations.h"
+#include "permutation_group.h"
+#include "symmetries.h"
+
+#include <cstddef>
+#include <deque>
+#include <set>
+#include <stdexcept>
+
+using namespace panda;
+
+namespace
+{
+   void recognition();
+   void invalidMaps();
+   template <typename TagType>
+   void largestImage(TagType);
+   void classes();
+   void stabilizer();
+   /// Returns the number of elements of the group generated by the maps.
+   std::size_t order(const CompiledMaps&);
+   /// Cyclic shift of x0, ..., x3.
+   const Map shift{{std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(4u, 1)}};
+   /// Map x0 <-> x1.
+   const Map swap{{std::make_pair(1u, 1)}, {std::make_pair(0u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}, {std::make_pair(4u, 1)}};
+   /// Map x0 -> -x0.
+   const Map sign{{std::make_pair(0u, -1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}, {std::make_pair(4u, 1)}};
+   /// Map x0 -> 1 - x0, which isn't a signed permutation.
+   const Map mirror{{std::make_pair(0u, -1), std::make_pair(4u, 1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}, {std::make_pair(4u, 1)}};
+   /// Map x0 -> x1, x1 -> x1, which isn't a permutation.
+   const Map collapse{{std::make_pair(1u, 1)}, {std::make_pair(1u, 1)}, {std::make_pair(2u, 1)}, {std::make_pair(3u, 1)}, {std::make_pair(4u, 1)}};
+}
+
+int main()
+try
+{
+   recognition();
+   invalidMaps();
+   largestImage(tag::vertex{});
+   largestImage(tag::facet{});
+   classes();
+   stabilizer();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void recognition()
+   {
+      ASSERT(PermutationGroup::accepts({shift, swap, sign}), "Signed permutations have to be accepted.");
+      ASSERT(!PermutationGroup::accepts({shift, mirror}), "Affine maps aren't signed permutations.");
+      ASSERT(!PermutationGroup::accepts({collapse}), "Maps have to be bijective.");
+      ASSERT(!PermutationGroup::accepts({}), "There has to be at least one map.");
+      const PermutationGroup group({shift, swap}, tag::vertex{});
+      ASSERT(group.dimension() == 5, "Data returned is invalid.");
+   }
+
+   void invalidMaps()
+   {
+      ASSERT_EXCEPTION(PermutationGroup({mirror}, tag::facet{}), std::invalid_argument, "Affine maps aren't signed permutations.");
+   }
+
+   template <typename TagType>
+   void largestImage(TagType tag)
+   {
+      const Maps maps{shift, swap, sign};
+      const PermutationGroup group(maps, tag);
+      const Symmetries<int, TagType> symmetries(maps);
+      ASSERT(symmetries.group != nullptr, "Signed permutations generate a permutation group.");
+      std::size_t compared = 0;
+      for ( int a = -2; a <= 2; ++a )
+      for ( int b = -2; b <= 2; ++b )
+      for ( int c = -1; c <= 2; ++c )
+      for ( int d = -1; d <= 1; ++d )
+      for ( int e = -1; e <= 1; ++e )
+      {
+         const Row<int> row{a, b, c, d, e};
+         if ( algorithm::gcd(row) != 1 )
+         {
+            continue;
+         }
+         const auto expected = *algorithm::getClass(row, maps, tag).crbegin();
+         ASSERT(group.largestImage(row) == expected, "The largest image has to be the largest row of the class.");
+         ASSERT(algorithm::classRepresentative(row, symmetries, tag) == expected, "The representative has to be the largest row of the class.");
+         ++compared;
+      }
+      ASSERT(compared > 0, "");
+   }
+
+   void classes()
+   {
+      // the vertices of the cube [-1, 1]^4 and its faces: two rows are equivalent iff they have the same number of zeros.
+      const Maps maps{shift, swap, sign};
+      std::set<Row<int>> rows;
+      for ( int a = -1; a <= 1; ++a )
+      for ( int b = -1; b <= 1; ++b )
+      for ( int c = -1; c <= 1; ++c )
+      for ( int d = -1; d <= 1; ++d )
+      {
+         rows.insert(Row<int>{a, b, c, d, 1});
+      }
+      const auto result = algorithm::classes(rows, Symmetries<int, tag::vertex>(maps), tag::vertex{});
+      ASSERT(result == algorithm::classes(rows, maps, tag::vertex{}), "The group has to give the same classes as their enumeration.");
+      ASSERT((result == Matrix<int>{{1, 1, 1, 1, 1}, {1, 1, 1, 0, 1}, {1, 1, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 0, 0, 0, 1}}), "Data returned is invalid.");
+   }
+
+   void stabilizer()
+   {
+      // the group of order 64 generated by the shift and the sign, none of the maps fixes a row with few zeros.
+      const PermutationGroup group({shift, sign}, tag::vertex{});
+      ASSERT(order(algorithm::compile(Maps{shift, sign}, tag::vertex{})) == 64, "");
+      const std::vector<std::pair<Row<int>, std::size_t>> expected{
+         {{1, 1, 0, 0, 1}, 4},
+         {{1, 0, 1, 0, 1}, 8},
+         {{1, 1, 1, 1, 1}, 4},
+         {{1, 2, 3, 4, 1}, 1},
+         {{0, 0, 0, 0, 1}, 64}};
+      for ( const auto& entry : expected )
+      {
+         const auto generators = group.stabilizer(entry.first);
+         for ( const auto& generator : generators )
+         {
+            ASSERT(algorithm::apply(generator, entry.first, tag::vertex{}) == entry.first, "Generators of the stabiliser have to fix the row.");
+         }
+         ASSERT(order(generators) == entry.second, "The generators have to generate the whole stabiliser.");
+      }
+      ASSERT(algorithm::stabilizer(Maps{shift, sign}, Row<int>{1, 1, 0, 0, 1}, tag::vertex{}).empty(), "None of the maps fixes the row.");
+   }
+
+   std::size_t order(const CompiledMaps& maps)
+   {
+      // signed permutations don't fix any row with distinct absolute values except for the identity.
+      std::set<Row<int>> elements{{1, 2, 3, 4, 5}};
+      std::deque<Row<int>> todo(elements.cbegin(), elements.cend());
+      while ( !todo.empty() )
+      {
+         const auto current = todo.front();
+         todo.pop_front();
+         for ( const auto& map : maps )
+         {
+            const auto image = algorithm::apply(map, current, tag::vertex{});
+            if ( elements.insert(image).second )
+            {
+               todo.push_back(image);
+            }
+         }
+      }
+      return elements.size();
+   }
+}
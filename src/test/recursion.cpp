@@ -0,0 +1,75 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "recursion.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace panda;
+
+namespace
+{
+   void optionDefaults();
+   void optionInvalid();
+   void optionValid();
+}
+
+int main()
+try
+{
+   optionDefaults();
+   optionInvalid();
+   optionValid();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void optionDefaults()
+   {
+      char** argv = new char*[1];
+      argv[0] = nullptr;
+      ASSERT(recursion::depth(1, argv) == 0, "Recursion is disabled by default");
+      ASSERT(recursion::threshold(1, argv) > 0, "Default threshold must be positive");
+      delete [] argv;
+   }
+
+   void optionInvalid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--recursion-depth=");
+      ASSERT_EXCEPTION(recursion::depth(2, argv), std::invalid_argument, "Missing parameter");
+      strcpy(argv[1], "--recursion-depth=-1");
+      ASSERT_EXCEPTION(recursion::depth(2, argv), std::invalid_argument, "Parameter is negative");
+      strcpy(argv[1], "--recursion-threshold=a");
+      ASSERT_EXCEPTION(recursion::threshold(2, argv), std::invalid_argument, "Parameter is not a number");
+      delete [] argv[1];
+      delete [] argv;
+   }
+
+   void optionValid()
+   {
+      char** argv = new char*[2];
+      argv[0] = nullptr;
+      argv[1] = new char[30];
+      strcpy(argv[1], "--recursion-depth=2");
+      ASSERT(recursion::depth(2, argv) == 2, "Parameter is 2");
+      strcpy(argv[1], "--recursion-threshold=0");
+      ASSERT(recursion::threshold(2, argv) == 0, "Parameter is 0");
+      delete [] argv[1];
+      delete [] argv;
+   }
+}
+
@@ -28,6 +28,7 @@ namespace
    void test_operator_modulo_assign();
    void test_operator_int();
    void test_operator_unary_minus();
+   void test_batched_operations();
 }
 
 int main()
@@ -46,6 +47,7 @@ try
    test_operator_modulo_assign();
    test_operator_int();
    test_operator_unary_minus();
+   test_batched_operations();
 }
 catch ( const TestingGearException& e )
 {
@@ -386,5 +388,32 @@ namespace
          ASSERT_ANY_EXCEPTION(-SI(std::numeric_limits<SID>::min()), "operator-() has to throw on invalid argument.");
       }
    }
+   void test_batched_operations()
+   {
+      const std::vector<SI> a{SI(2), SI(-3), SI(5)};
+      const std::vector<SI> b{SI(7), SI(11), SI(-13)};
+      ASSERT(SI::scalarProduct(a.data(), a.data() + a.size(), b.data()) == -84, "Bad scalar product.");
+      auto sum = a;
+      SI::add(sum.data(), sum.data() + sum.size(), b.data());
+      ASSERT(sum == std::vector<SI>({SI(9), SI(8), SI(-8)}), "Bad sum of ranges.");
+      auto difference = a;
+      SI::subtract(difference.data(), difference.data() + difference.size(), b.data());
+      ASSERT(difference == std::vector<SI>({SI(-5), SI(-14), SI(18)}), "Bad difference of ranges.");
+      auto scaled = a;
+      SI::scale(scaled.data(), scaled.data() + scaled.size(), SI(-2));
+      ASSERT(scaled == std::vector<SI>({SI(-4), SI(6), SI(-10)}), "Bad scaling of a range.");
+      // an overflow in a single entry has to be detected, even if it is followed by valid operations.
+      const std::vector<SI> large{SI(1), SI(SID_MAX), SI(1)};
+      const std::vector<SI> ones{SI(1), SI(1), SI(1)};
+      ASSERT_ANY_EXCEPTION(SI::scalarProduct(large.data(), large.data() + large.size(), ones.data()), "Scalar product did overflow.");
+      auto overflowing = large;
+      ASSERT_ANY_EXCEPTION(SI::add(overflowing.data(), overflowing.data() + overflowing.size(), ones.data()), "Addition did overflow.");
+      overflowing = std::vector<SI>{SI(0), SI(SID_MIN), SI(0)};
+      ASSERT_ANY_EXCEPTION(SI::subtract(overflowing.data(), overflowing.data() + overflowing.size(), ones.data()), "Subtraction did overflow.");
+      overflowing = large;
+      ASSERT_ANY_EXCEPTION(SI::scale(overflowing.data(), overflowing.data() + overflowing.size(), SI(2)), "Multiplication did overflow.");
+      // intermediate sums beyond the range are overflows, too.
+      const std::vector<SI> cancelling{SI(SID_MAX), SI(1), SI(-2)};
+      ASSERT_ANY_EXCEPTION(SI::scalarProduct(cancelling.data(), cancelling.data() + cancelling.size(), ones.data()), "Scalar product did overflow.");
+   }
 }
-
@@ -0,0 +1,156 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "algorithm_integer_operations.h"
+#include "safe_integer_128.h"
+
+#include <limits>
+#include <vector>
+
+using namespace panda;
+
+#ifdef __SIZEOF_INT128__
+namespace
+{
+   void test_constructors();
+   void test_operator_multiply_assign();
+   void test_operator_divide_assign();
+   void test_operator_add_assign();
+   void test_operator_subtract_assign();
+   void test_operator_modulo_assign();
+   void test_operator_int();
+   void test_operator_unary_minus();
+   void test_gcd();
+}
+
+int main()
+try
+{
+   test_constructors();
+   test_operator_multiply_assign();
+   test_operator_divide_assign();
+   test_operator_add_assign();
+   test_operator_subtract_assign();
+   test_operator_modulo_assign();
+   test_operator_int();
+   test_operator_unary_minus();
+   test_gcd();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   using SI = SafeInteger128;
+   constexpr static int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+   constexpr static int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+
+   /// Largest value of SafeInteger128 (2^127 - 1), built from 64 bit values only.
+   SI maximum()
+   {
+      const SI half = SI(int64_t{1} << 62) * SI(int64_t{2});
+      return (half * SI(I64_MAX) + SI(I64_MAX)) * SI(int64_t{2}) + SI(int64_t{1});
+   }
+
+   void test_constructors()
+   {
+      ASSERT(SI() == 0, "Default value is zero.");
+      ASSERT(SI(int16_t{-7}) == -7 && SI(int32_t{-7}) == -7 && SI(int64_t{-7}) == -7, "Bad signed constructors.");
+      ASSERT(SI(uint16_t{7}) == 7 && SI(uint32_t{7}) == 7 && SI(uint64_t{7}) == 7, "Bad unsigned constructors.");
+      ASSERT(SI(std::numeric_limits<uint64_t>::max()) == SI(I64_MAX) * SI(int64_t{2}) + SI(int64_t{1}), "Bad conversion of uint64_t.");
+      ASSERT(SI(I64_MIN) < SI(I64_MIN + 1) && SI(I64_MIN) < 0, "Bad conversion of int64_t.");
+   }
+
+   void test_operator_multiply_assign()
+   {
+      const SI a(I64_MAX);
+      ASSERT((a * a) / a == a, "Products of 64 bit values fit into 128 bits.");
+      ASSERT(SI(I64_MIN) * SI(I64_MIN) > a * a, "Products of 64 bit values fit into 128 bits.");
+      ASSERT_NOTHROW(maximum(), "The largest value is valid.");
+      ASSERT_ANY_EXCEPTION(maximum() * SI(int64_t{2}), "Multiplication did overflow.");
+      ASSERT_ANY_EXCEPTION(a * a * SI(int64_t{4}), "Multiplication did overflow.");
+      ASSERT_NOTHROW(-maximum() * SI(int64_t{1}), "Multiplication within the range.");
+   }
+
+   void test_operator_divide_assign()
+   {
+      ASSERT(SI(int64_t{-7}) / SI(int64_t{2}) == -3, "Division rounds towards zero.");
+      ASSERT_ANY_EXCEPTION(SI(int64_t{1}) / SI(), "Dividing by zero.");
+      const auto minimum = -maximum() - SI(int64_t{1});
+      ASSERT_ANY_EXCEPTION(minimum / SI(int64_t{-1}), "Division did overflow.");
+   }
+
+   void test_operator_add_assign()
+   {
+      ASSERT_ANY_EXCEPTION(maximum() + SI(int64_t{1}), "Addition did overflow.");
+      ASSERT_NOTHROW(-maximum() + SI(int64_t{-1}), "Addition within the range.");
+      ASSERT_ANY_EXCEPTION(-maximum() + SI(int64_t{-2}), "Addition did overflow.");
+      ASSERT(SI(I64_MAX) + SI(I64_MAX) > SI(I64_MAX), "Sums of 64 bit values fit into 128 bits.");
+   }
+
+   void test_operator_subtract_assign()
+   {
+      ASSERT_ANY_EXCEPTION(-maximum() - SI(int64_t{2}), "Subtraction did overflow.");
+      ASSERT_ANY_EXCEPTION(maximum() - SI(int64_t{-1}), "Subtraction did overflow.");
+      ASSERT(SI(I64_MIN) - SI(I64_MAX) < SI(I64_MIN), "Differences of 64 bit values fit into 128 bits.");
+   }
+
+   void test_operator_modulo_assign()
+   {
+      ASSERT(SI(int64_t{-7}) % SI(int64_t{3}) == 2, "Modulo is non-negative.");
+      ASSERT(maximum() % SI(int64_t{2}) == 1, "Bad modulo.");
+      ASSERT_ANY_EXCEPTION(SI(int64_t{7}) % SI(), "Modulo zero is undefined.");
+      ASSERT_ANY_EXCEPTION(SI(int64_t{7}) % SI(int64_t{-3}), "Modulo a negative number is non-sense.");
+   }
+
+   void test_operator_int()
+   {
+      constexpr static auto int_min = std::numeric_limits<int>::min();
+      constexpr static auto int_max = std::numeric_limits<int>::max();
+      std::vector<int64_t> values{I64_MIN, int_min, -2, -1, 0, 1, 2, int_max, I64_MAX};
+      for ( auto a : values )
+      {
+         if ( a < int_min || int_max < a )
+         {
+            ASSERT_ANY_EXCEPTION(static_cast<int>(SI(a)), "Conversion of out-of-range-value is invalid.");
+         }
+         else
+         {
+            ASSERT(static_cast<int>(SI(a)) == a, "Conversion of in-of-range-value is valid.");
+         }
+      }
+      ASSERT_ANY_EXCEPTION(static_cast<int>(maximum()), "Conversion of out-of-range-value is invalid.");
+   }
+
+   void test_operator_unary_minus()
+   {
+      ASSERT(-SI(int64_t{0}) == SI(int64_t{0}), "operator-()");
+      ASSERT(-SI(int64_t{1}) == SI(int64_t{-1}), "operator-()");
+      ASSERT(-SI(I64_MIN) > SI(I64_MAX), "operator-()");
+      ASSERT_ANY_EXCEPTION(-(-maximum() - SI(int64_t{1})), "operator-() has to throw on invalid argument.");
+   }
+
+   void test_gcd()
+   {
+      const SI a = SI(I64_MAX) * SI(int64_t{6});
+      const SI b = SI(I64_MAX) * SI(int64_t{-4});
+      ASSERT(algorithm::gcd(a, b) == SI(I64_MAX) * SI(int64_t{2}), "Bad gcd.");
+      const int128_t c = static_cast<int128_t>(I64_MAX) * 6;
+      const int128_t d = static_cast<int128_t>(I64_MAX) * -4;
+      ASSERT(algorithm::gcd(c, d) == static_cast<int128_t>(I64_MAX) * 2, "Bad gcd of int128_t.");
+   }
+}
+#else
+int main()
+{
+}
+#endif
+
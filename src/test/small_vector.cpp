@@ -0,0 +1,126 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "small_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+using namespace panda;
+
+namespace
+{
+   void construction();
+   void growth();
+   void copy();
+   void move();
+   void modification();
+}
+
+int main()
+try
+{
+   construction();
+   growth();
+   copy();
+   move();
+   modification();
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   using Vector = SmallVector<uint64_t, 2>;
+
+   bool equal(const Vector& vector, std::initializer_list<uint64_t> values)
+   {
+      return vector.size() == values.size() && std::equal(values.begin(), values.end(), vector.cbegin());
+   }
+
+   void construction()
+   {
+      ASSERT(Vector().empty() && Vector().isInline(), "Default constructed vectors are empty.");
+      const Vector one(1, 5);
+      ASSERT(equal(one, {5}) && one.isInline(), "Small vectors are stored inline.");
+      const Vector three(3, 7);
+      ASSERT(equal(three, {7, 7, 7}) && !three.isInline(), "Large vectors are stored on the heap.");
+      const Vector list{1, 2};
+      ASSERT(equal(list, {1, 2}) && list.isInline(), "Construction from list.");
+   }
+
+   void growth()
+   {
+      Vector vector;
+      for ( uint64_t i = 0; i < 100; ++i )
+      {
+         vector.push_back(i);
+         ASSERT(vector.isInline() == (i < 2), "Vectors are stored inline up to the inline capacity.");
+      }
+      ASSERT(vector.size() == 100 && vector.capacity() >= 100, "Bad size after growth.");
+      for ( uint64_t i = 0; i < 100; ++i )
+      {
+         ASSERT(vector[i] == i, "Growth must keep the values.");
+      }
+      Vector alias{1, 2};
+      alias.push_back(alias[0]);
+      ASSERT(equal(alias, {1, 2, 1}), "Appending an element of the vector itself.");
+   }
+
+   void copy()
+   {
+      const Vector small{4, 5};
+      const Vector large{1, 2, 3};
+      Vector a(small);
+      Vector b(large);
+      ASSERT(equal(a, {4, 5}) && a.isInline() && equal(b, {1, 2, 3}), "Copy construction.");
+      a = large;
+      b = small;
+      ASSERT(equal(a, {1, 2, 3}) && equal(b, {4, 5}), "Copy assignment between inline and heap storage.");
+      b[0] = 9;
+      ASSERT(equal(small, {4, 5}), "Copies are independent.");
+      const auto& same = a;
+      a = same;
+      ASSERT(equal(a, {1, 2, 3}), "Self assignment.");
+   }
+
+   void move()
+   {
+      Vector small{4, 5};
+      Vector large{1, 2, 3};
+      const Vector a(std::move(small));
+      const Vector b(std::move(large));
+      ASSERT(equal(a, {4, 5}) && equal(b, {1, 2, 3}), "Move construction.");
+      ASSERT(small.empty() && small.isInline() && large.empty() && large.isInline(), "Moved from vectors are empty.");
+      Vector c{7};
+      c = Vector{6, 6, 6};
+      ASSERT(equal(c, {6, 6, 6}), "Move assignment of heap storage.");
+      c = Vector{8};
+      ASSERT(equal(c, {8}), "Move assignment of inline storage.");
+   }
+
+   void modification()
+   {
+      Vector vector{1, 2, 3, 0, 0};
+      vector.pop_back();
+      ASSERT(equal(vector, {1, 2, 3, 0}) && vector.back() == 0, "pop_back");
+      vector.resize(6);
+      ASSERT(equal(vector, {1, 2, 3, 0, 0, 0}), "resize fills with zeros.");
+      vector.assign(1, 4);
+      ASSERT(equal(vector, {4}), "assign");
+      vector = {3, 2, 1};
+      ASSERT(equal(vector, {3, 2, 1}) && *vector.crbegin() == 1, "Assignment from list.");
+      vector.clear();
+      ASSERT(vector.empty(), "clear");
+   }
+}
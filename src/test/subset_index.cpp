@@ -0,0 +1,101 @@
+
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "bitset_fixed_size.h"
+#include "bitset_wide.h"
+#include "subset_index.h"
+
+#include <random>
+#include <vector>
+
+using namespace panda;
+
+namespace
+{
+   void empty();
+   template <typename Bitset>
+   void bruteForce(const std::size_t);
+}
+
+int main()
+try
+{
+   empty();
+   bruteForce<BitsetFixedSize<4>>(100);
+   bruteForce<BitsetWide>(100);
+   bruteForce<BitsetWide>(700);
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
+
+namespace
+{
+   void empty()
+   {
+      const std::vector<BitsetWide> bitsets(3, BitsetWide(10));
+      const SubsetIndex<BitsetWide> index(bitsets, {}, 10);
+      ASSERT(!index.containsSubsetOfUnion(bitsets[0], bitsets[1]), "An empty index has no subsets.");
+      const SubsetIndex<BitsetWide> all(bitsets, {0, 1, 2}, 10);
+      ASSERT(all.containsSubsetOfUnion(bitsets[0], bitsets[1]), "The empty set is a subset of any set.");
+   }
+
+   template <typename Bitset>
+   void bruteForce(const std::size_t bits)
+   {
+      std::mt19937 generator(7);
+      std::bernoulli_distribution stored_bit(0.3);
+      std::bernoulli_distribution query_bit(0.45);
+      std::vector<Bitset> bitsets(2000, Bitset(bits));
+      std::vector<std::size_t> indices;
+      for ( std::size_t i = 0; i < 1000; ++i )
+      {
+         for ( std::size_t bit = 0; bit < bits; ++bit )
+         {
+            if ( stored_bit(generator) )
+            {
+               bitsets[i].set(bit);
+            }
+         }
+         indices.push_back(i);
+      }
+      for ( std::size_t i = 1000; i < bitsets.size(); ++i )
+      {
+         for ( std::size_t bit = 0; bit < bits; ++bit )
+         {
+            if ( query_bit(generator) )
+            {
+               bitsets[i].set(bit);
+            }
+         }
+         // random queries hardly ever contain a stored bitset, so some of them are made to.
+         if ( i % 20 == 0 )
+         {
+            bitsets[i] = bitsets[i].merge(bitsets[i % 1000], bits);
+         }
+      }
+      const SubsetIndex<Bitset> index(bitsets, indices, bits);
+      std::size_t found = 0;
+      for ( std::size_t i = 1000; i + 1 < bitsets.size(); i += 2 )
+      {
+         const auto& a = bitsets[i];
+         const auto& b = bitsets[i + 1];
+         bool expected = false;
+         for ( const auto j : indices )
+         {
+            expected = expected || Bitset::unionContains(a, b, bitsets[j], bits);
+         }
+         ASSERT(index.containsSubsetOfUnion(a, b) == expected, "The index has to agree with a linear scan.");
+         found += expected ? 1 : 0;
+      }
+      ASSERT(found > 0 && found < 500, "Both answers have to be tested.");
+   }
+}
+
@@ -0,0 +1,161 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#include "testing_gear.h"
+
+#include "work_stealing_list.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+using namespace panda;
+
+int main()
+try
+{
+   // We do not care for the output here.
+   SILENCE_CERR();
+   std::cout.rdbuf(nullptr);
+   {  // A get call has to block until new data is available
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      WorkStealingList<int, tag::facet> list({}, 2, ClassRegistryType::Hashed, output);
+      list.put(Facets<int>{{0}});
+      ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
+      std::atomic<bool> empty = ATOMIC_VAR_INIT(true);
+      std::atomic<bool> ready = ATOMIC_VAR_INIT(false);
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::thread getter([&]()
+      {
+         {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.store(true);
+            cv.notify_all();
+         }
+         list.get();
+         ASSERT(!empty.load(), "The list.get() call may only suceed once the setter has done its job.");
+      });
+      std::thread setter([&]()
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         cv.wait(lock, [&]() { return ready.load(); });
+         empty.store(false);
+         list.put(Facets<int>{{1}});
+      });
+      getter.join();
+      setter.join();
+   }
+   { // A blocked get call has to be unblocked once all jobs are done
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      WorkStealingList<int, tag::facet> list({}, 2, ClassRegistryType::Hashed, output);
+      list.put(Facets<int>{{0}});
+      ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
+      std::atomic<bool> ready = ATOMIC_VAR_INIT(false);
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::thread getter([&]()
+      {
+         {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.store(true);
+            cv.notify_all();
+         }
+         ASSERT(list.get().empty(), "After the last job is done, an empty row has to be returned.");
+      });
+      std::thread setter([&]()
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         cv.wait(lock, [&]() { return ready.load(); });
+         list.put(Facets<int>{{0}});
+         ASSERT(list.get().empty(), "After the last job is done, an empty row has to be returned.");
+      });
+      getter.join();
+      setter.join();
+   }
+   { // Every row is handed out exactly once, no matter which thread queued it
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      WorkStealingList<int, tag::vertex> list({}, 4, ClassRegistryType::Hashed, output);
+      list.put(Vertices<int>{{0}});
+      std::mutex mutex;
+      std::multiset<int> processed;
+      std::list<std::thread> threads;
+      for ( int t = 0; t < 4; ++t )
+      {
+         threads.emplace_back([&]()
+         {
+            while ( true )
+            {
+               const auto row = list.get();
+               if ( row.empty() )
+               {
+                  break;
+               }
+               {
+                  std::lock_guard<std::mutex> lock(mutex);
+                  processed.insert(row[0]);
+               }
+               // every job "finds" its two successors modulo 100, which produces many duplicates.
+               list.put(Vertices<int>{{(row[0] + 1) % 100}, {(row[0] + 2) % 100}});
+            }
+         });
+      }
+      for ( auto& thread : threads )
+      {
+         thread.join();
+      }
+      ASSERT(processed.size() == 100, "Each row has to be processed exactly once.");
+      ASSERT(std::set<int>(processed.begin(), processed.end()).size() == 100, "Each row has to be processed exactly once.");
+   }
+   { // A snapshot lists all classes and the unfinished jobs, a restored list continues with them
+      const OutputWriter output("", std::chrono::milliseconds(100));
+      WorkStealingList<int, tag::facet> list({}, 2, ClassRegistryType::Hashed, output);
+      list.put(Facets<int>{{0}});
+      ASSERT(list.get() == Facet<int>{0}, "Data returned is invalid.");
+      list.put(Facets<int>{{1}, {2}});
+      const auto job = list.get();
+      ASSERT((list.load() == std::make_pair<std::size_t, std::size_t>(1, 1)), "One job has to be in progress and one has to be queued.");
+      const auto state = list.snapshot();
+      std::set<Facet<int>> classes;
+      std::set<Facet<int>> jobs;
+      for ( const auto row : state.first )
+      {
+         classes.insert(*row);
+      }
+      for ( const auto row : state.second )
+      {
+         jobs.insert(*row);
+      }
+      ASSERT((classes == std::set<Facet<int>>{{0}, {1}, {2}}), "All classes have to be in the snapshot.");
+      ASSERT((jobs == std::set<Facet<int>>{{1}, {2}}), "Queued jobs and jobs in progress have to be in the snapshot.");
+      WorkStealingList<int, tag::facet> restored({}, 2, ClassRegistryType::Hashed, output);
+      restored.restore(Facets<int>{{0}, {1}, {2}}, Facets<int>{{1}, {2}});
+      std::set<Facet<int>> processed;
+      while ( true )
+      {
+         const auto row = restored.get();
+         if ( row.empty() )
+         {
+            break;
+         }
+         processed.insert(row);
+         restored.put(Facets<int>{{0}, {1}});
+      }
+      ASSERT((processed == std::set<Facet<int>>{{1}, {2}}), "Exactly the unfinished jobs have to be processed after restoring.");
+      ASSERT((restored.load() == std::make_pair<std::size_t, std::size_t>(0, 0)), "No job may be left once all jobs are done.");
+      ASSERT(job == Facet<int>{1} || job == Facet<int>{2}, "Data returned is invalid.");
+   }
+}
+catch ( const TestingGearException& e )
+{
+   std::cerr << e.what() << "\n";
+   return 1;
+}
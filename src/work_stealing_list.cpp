@@ -0,0 +1,271 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#define COMPILE_TEMPLATE_WORK_STEALING_LIST
+#include "work_stealing_list.h"
+#undef COMPILE_TEMPLATE_WORK_STEALING_LIST
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#include "algorithm_row_operations.h"
+#include "cpp_feature_check_thread_local.h"
+
+using namespace panda;
+
+#define PRINT_DONE_COUNTER /// if enabled, the beginning of processing a row will be announced.
+
+namespace
+{
+   #if HAS_FEATURE_THREAD_LOCAL != 0
+   std::atomic<std::size_t> next_slot(0);
+   thread_local std::size_t own_slot = next_slot++;
+   #endif
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::put(const Matrix<Integer>& matrix) const
+{
+   const auto stored = seen.insert(matrix);
+   // new jobs are accounted for before the finished one is removed, hence pending can't drop to zero too early.
+   pending += stored.size();
+   push(stored, true);
+   print(stored);
+   if ( pending.fetch_sub(1) == 1 )
+   {
+      wakeAll();
+   }
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::put(const Row<Integer>& row) const
+{
+   const auto stored = seen.insert(row);
+   if ( stored == nullptr )
+   {
+      return;
+   }
+   ++pending;
+   push({stored}, false);
+   print({stored});
+}
+
+template <typename Integer, typename TagType>
+Row<Integer> panda::WorkStealingList<Integer, TagType>::get() const
+{
+   Row<Integer> row;
+   while ( !pop(row) )
+   {
+      std::unique_lock<std::mutex> lock(idle_mutex);
+      idle.wait(lock, [&]() { return queued.load() > 0 || pending.load() == 0; });
+      if ( pending.load() == 0 )
+      {
+         return Row<Integer>{};
+      }
+   }
+   #ifdef PRINT_DONE_COUNTER
+   const auto index = ++counter;
+   const auto classes = seen.size();
+   std::stringstream stream;
+   stream << "Processing #" << index << " of at least " << classes;
+   stream << " class" << ((classes == 1) ? "" : "es") << '\n';
+   std::cerr << stream.str();
+   #endif
+   return row;
+}
+
+template <typename Integer, typename TagType>
+std::pair<std::vector<const Row<Integer>*>, std::vector<const Row<Integer>*>> panda::WorkStealingList<Integer, TagType>::snapshot() const
+{
+   // all deques are locked at once (in order, like std::lock would), such that no job is moved in between.
+   // Only pointers are copied under the locks, the rows themselves never change.
+   std::vector<std::unique_lock<std::mutex>> locks;
+   locks.reserve(deques.size());
+   for ( auto& deque : deques )
+   {
+      locks.emplace_back(deque.mutex);
+   }
+   std::vector<const Row<Integer>*> classes;
+   std::vector<const Row<Integer>*> jobs;
+   for ( const auto& deque : deques )
+   {
+      classes.insert(classes.end(), deque.discovered.cbegin(), deque.discovered.cend());
+      jobs.insert(jobs.end(), deque.jobs.cbegin(), deque.jobs.cend());
+      for ( const auto& entry : deque.in_progress )
+      {
+         jobs.push_back(entry.second);
+      }
+   }
+   return std::make_pair(std::move(classes), std::move(jobs));
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::restore(const Matrix<Integer>& classes, const Matrix<Integer>& jobs) const
+{
+   const auto stored = seen.insert(classes);
+   if ( stored.size() != classes.size() )
+   {
+      throw std::invalid_argument("Checkpoint contains duplicate classes.");
+   }
+   pending += jobs.size();
+   {
+      std::lock_guard<std::mutex> lock(deques.front().mutex);
+      deques.front().discovered.insert(deques.front().discovered.end(), stored.cbegin(), stored.cend());
+   }
+   // spread the jobs over all deques.
+   for ( std::size_t i = 0; i < jobs.size(); ++i )
+   {
+      const auto job = seen.find(jobs[i]);
+      assert( job != nullptr );
+      auto& deque = deques[i % deques.size()];
+      std::lock_guard<std::mutex> lock(deque.mutex);
+      deque.jobs.push_back(job);
+      ++queued;
+   }
+   counter = classes.size() - jobs.size();
+   print(stored);
+   pending.fetch_sub(1);
+   wakeAll();
+}
+
+template <typename Integer, typename TagType>
+std::pair<std::size_t, std::size_t> panda::WorkStealingList<Integer, TagType>::load() const
+{
+   const auto queued_jobs = queued.load();
+   const auto pending_jobs = pending.load();
+   // the initial job is pending but not in progress by any thread, it doesn't matter here.
+   return std::make_pair(pending_jobs > queued_jobs ? pending_jobs - queued_jobs : 0, queued_jobs);
+}
+
+template <typename Integer, typename TagType>
+panda::WorkStealingList<Integer, TagType>::WorkStealingList(const Names& names_, const std::size_t number_of_deques, const ClassRegistryType registry_type, const OutputWriter& output_)
+:
+   names(names_),
+   deques(number_of_deques),
+   seen(registry_type),
+   output(output_),
+   idle_mutex(),
+   idle(),
+   pending(1),
+   queued(0),
+   counter(0)
+{
+   assert( number_of_deques > 0 );
+}
+
+template <typename Integer, typename TagType>
+std::size_t panda::WorkStealingList<Integer, TagType>::slot() const
+{
+   #if HAS_FEATURE_THREAD_LOCAL != 0
+   return own_slot % deques.size();
+   #else
+   return std::hash<std::thread::id>()(std::this_thread::get_id()) % deques.size();
+   #endif
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::push(const std::vector<const Row<Integer>*>& rows, const bool done) const
+{
+   auto& deque = deques[slot()];
+   {
+      std::lock_guard<std::mutex> lock(deque.mutex);
+      deque.jobs.insert(deque.jobs.end(), rows.cbegin(), rows.cend());
+      deque.discovered.insert(deque.discovered.end(), rows.cbegin(), rows.cend());
+      queued += rows.size();
+      if ( done )
+      {
+         deque.in_progress.erase(std::this_thread::get_id());
+      }
+   }
+   if ( rows.empty() )
+   {
+      return;
+   }
+   {
+      // taking the lock orders this notification after the predicate check of a waiting thread.
+      std::lock_guard<std::mutex> lock(idle_mutex);
+   }
+   if ( rows.size() == 1 )
+   {
+      idle.notify_one();
+   }
+   else
+   {
+      idle.notify_all();
+   }
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::print(const std::vector<const Row<Integer>*>& rows) const
+{
+   if ( rows.empty() )
+   {
+      return;
+   }
+   std::stringstream stream;
+   for ( const auto row : rows )
+   {
+      if ( std::is_same<TagType, tag::facet>::value )
+      {
+         algorithm::prettyPrintln(stream, *row, names, "<=");
+      }
+      else
+      {
+         stream << *row << '\n';
+      }
+   }
+   output.write(stream.str());
+}
+
+template <typename Integer, typename TagType>
+bool panda::WorkStealingList<Integer, TagType>::pop(Row<Integer>& row) const
+{
+   const auto own = slot();
+   const auto id = std::this_thread::get_id();
+   {  // the owner works depth first on its newest job.
+      auto& deque = deques[own];
+      std::lock_guard<std::mutex> lock(deque.mutex);
+      if ( !deque.jobs.empty() )
+      {
+         row = *deque.jobs.back();
+         deque.in_progress[id] = deque.jobs.back();
+         deque.jobs.pop_back();
+         --queued;
+         return true;
+      }
+   }
+   for ( std::size_t i = 1; i < deques.size(); ++i )
+   {  // thieves take the oldest job of a victim.
+      auto& deque = deques[(own + i) % deques.size()];
+      // the own deque is locked as well, such that the stolen job is in progress before it leaves the victim.
+      std::unique_lock<std::mutex> victim_lock(deque.mutex, std::defer_lock);
+      std::unique_lock<std::mutex> own_lock(deques[own].mutex, std::defer_lock);
+      std::lock(victim_lock, own_lock);
+      if ( !deque.jobs.empty() )
+      {
+         row = *deque.jobs.front();
+         deques[own].in_progress[id] = deque.jobs.front();
+         deque.jobs.pop_front();
+         --queued;
+         return true;
+      }
+   }
+   return false;
+}
+
+template <typename Integer, typename TagType>
+void panda::WorkStealingList<Integer, TagType>::wakeAll() const
+{
+   {
+      std::lock_guard<std::mutex> lock(idle_mutex);
+   }
+   idle.notify_all();
+}
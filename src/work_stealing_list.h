@@ -0,0 +1,101 @@
+//-------------------------------------------------------------------------------//
+// Author: Stefan Lörwald, Universität Heidelberg                                //
+// License: CC BY-NC 4.0 http://creativecommons.org/licenses/by-nc/4.0/legalcode //
+//-------------------------------------------------------------------------------//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "class_registry.h"
+#include "class_registry_type.h"
+#include "matrix.h"
+#include "names.h"
+#include "output_writer.h"
+#include "row.h"
+#include "tags.h"
+
+namespace panda
+{
+   /// Job pool with the same interface as List, but every thread pushes to and pops from
+   /// its own deque. Threads without work steal the oldest job of another deque.
+   /// Rows that were ever seen are held in a registry that is guarded independently of the deques.
+   template <typename Integer, typename TagType>
+   class WorkStealingList
+   {
+      public:
+         /// merges rows with the list of rows held in the list.
+         /// Marks the end of one job (the rows are its result). All rows are queued at once.
+         void put(const Matrix<Integer>&) const;
+         /// merges a row with the list of rows held in the list.
+         void put(const Row<Integer>&) const;
+         /// Returns a row that wasn't ever returned here before. Blocks the
+         /// caller until data is available. Returns an empty row once all jobs are done.
+         Row<Integer> get() const;
+         /// Returns all classes found so far and the jobs that are queued or in progress.
+         /// Every other class is completely processed, i.e. all its neighbours are among the classes.
+         /// The rows stay valid as long as the list exists.
+         std::pair<std::vector<const Row<Integer>*>, std::vector<const Row<Integer>*>> snapshot() const;
+         /// Restores the state of a previous run from the classes found (first argument)
+         /// and the jobs that were queued or in progress (second argument).
+         /// Marks the end of the initial job, like put(const Matrix<Integer>&).
+         void restore(const Matrix<Integer>&, const Matrix<Integer>&) const;
+         /// Returns the number of jobs in progress and the number of queued jobs.
+         /// Both numbers are read without locking any deque, hence, they are only estimates.
+         std::pair<std::size_t, std::size_t> load() const;
+         /// Constructor. The second argument is the number of deques (usually the number of threads),
+         /// the third one selects the registry of seen rows, new rows are printed via the fourth one.
+         /// Like in List, one job is considered to be in progress initially (allowing heuristic to fill in once).
+         WorkStealingList(const Names&, const std::size_t, const ClassRegistryType, const OutputWriter&);
+         /// Copy construction is not allowed.
+         WorkStealingList(const WorkStealingList<Integer, TagType>&) = delete;
+         /// Copy assignment is not allowed.
+         WorkStealingList<Integer, TagType>& operator=(const WorkStealingList<Integer, TagType>&) = delete;
+      private:
+         /// A job queue with its own lock.
+         struct Deque
+         {
+            Deque() : mutex(), jobs(), discovered(), in_progress() {}
+            std::mutex mutex;
+            /// queued jobs, pointing into the registry of seen rows.
+            std::deque<const Row<Integer>*> jobs;
+            /// all rows ever queued in this deque.
+            std::vector<const Row<Integer>*> discovered;
+            /// jobs in progress by the threads owning this deque.
+            std::map<std::thread::id, const Row<Integer>*> in_progress;
+         };
+         const Names names;
+         mutable std::vector<Deque> deques;
+         mutable ClassRegistry<Integer> seen;
+         const OutputWriter& output;
+         mutable std::mutex idle_mutex;
+         mutable std::condition_variable idle;
+         /// number of jobs that are queued or in progress. Zero means that all work is done.
+         mutable std::atomic<std::size_t> pending;
+         /// number of jobs that are queued.
+         mutable std::atomic<std::size_t> queued;
+         mutable std::atomic<std::size_t> counter;
+      private:
+         /// Returns the index of the deque owned by the calling thread.
+         std::size_t slot() const;
+         /// Queues new jobs in the deque of the calling thread. If the second argument is true,
+         /// the job in progress of the calling thread is done.
+         void push(const std::vector<const Row<Integer>*>&, const bool) const;
+         /// Formats new rows and hands them to the output.
+         void print(const std::vector<const Row<Integer>*>&) const;
+         /// Takes a job from the own deque or steals one. Returns false if all deques are empty.
+         bool pop(Row<Integer>&) const;
+         /// Wakes up all waiting threads.
+         void wakeAll() const;
+   };
+}
+
+#include "work_stealing_list.eti"